@@ -15,13 +15,45 @@
 *******************************************************************************/
 
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/SectionMemoryManager.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
 
 using namespace ngraph;
 
+// Keeps a tally of the sections handed out so the size of the generated code can be reported
+class codegen::ExecutionEngine::CountingMemoryManager : public llvm::SectionMemoryManager
+{
+public:
+    uint8_t* allocateCodeSection(uintptr_t size,
+                                 unsigned alignment,
+                                 unsigned section_id,
+                                 llvm::StringRef section_name) override
+    {
+        m_allocated += size;
+        return llvm::SectionMemoryManager::allocateCodeSection(
+            size, alignment, section_id, section_name);
+    }
+
+    uint8_t* allocateDataSection(uintptr_t size,
+                                 unsigned alignment,
+                                 unsigned section_id,
+                                 llvm::StringRef section_name,
+                                 bool is_read_only) override
+    {
+        m_allocated += size;
+        return llvm::SectionMemoryManager::allocateDataSection(
+            size, alignment, section_id, section_name, is_read_only);
+    }
+
+    size_t get_allocated() const { return m_allocated; }
+private:
+    size_t m_allocated = 0;
+};
+
 codegen::ExecutionEngine::ExecutionEngine()
     : m_execution_engine{nullptr}
+    , m_memory_manager{nullptr}
 {
 }
 
@@ -39,8 +71,11 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
     {
         if (!m_execution_engine)
         {
+            std::unique_ptr<CountingMemoryManager> memory_manager(new CountingMemoryManager());
+            m_memory_manager = memory_manager.get();
             m_execution_engine.reset(llvm::EngineBuilder(module->take_module())
                                          .setEngineKind(llvm::EngineKind::JIT)
+                                         .setMCJITMemoryManager(std::move(memory_manager))
                                          .setOptLevel(llvm::CodeGenOpt::Aggressive)
                                          .setMCPU(llvm::sys::getHostCPUName())
                                          //  .setCodeModel(llvm::CodeModel::Medium)
@@ -76,6 +111,11 @@ void codegen::ExecutionEngine::finalize()
     }
 }
 
+size_t codegen::ExecutionEngine::get_code_size() const
+{
+    return m_execution_engine ? m_memory_manager->get_allocated() : 0;
+}
+
 void* codegen::ExecutionEngine::get_pointer_to_named_function(const std::string& func_name)
 {
 // For whatever reason, macOS seems to expect that we prefix this with an underscore.
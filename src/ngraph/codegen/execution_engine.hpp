@@ -43,6 +43,8 @@ public:
 
     bool add_module(std::unique_ptr<ngraph::codegen::Module>& module);
     void finalize();
+    /// Bytes of code and data sections the JIT has loaded
+    size_t get_code_size() const;
 
     template <typename ftype>
     std::function<ftype> find_function(const std::string& func_name)
@@ -51,7 +53,11 @@ public:
     }
 
 private:
+    class CountingMemoryManager;
+
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
+    // Owned by m_execution_engine
+    CountingMemoryManager* m_memory_manager;
     std::string m_jit_error;
 
     void* get_pointer_to_named_function(const std::string& func_name);
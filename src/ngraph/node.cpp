@@ -16,6 +16,7 @@
 
 #include "ngraph/node.hpp"
 #include <memory>
+#include <mutex>
 #include <typeindex>
 #include <typeinfo>
 
@@ -35,11 +36,27 @@ using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+static const string* intern_node_type(const string& node_type)
+{
+    static mutex interned_mutex;
+    static unordered_set<string> interned;
+    lock_guard<mutex> lock(interned_mutex);
+    return &*interned.insert(node_type).first;
+}
+
 Node::Node(const std::string& node_type, const NodeVector& arguments)
-    : m_node_type(node_type)
+    : m_node_type(intern_node_type(node_type))
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_unique_name(description() + "_" + to_string(m_instance_id))
 {
+    // Inputs register their address with the outputs they use, so size the storage up front
+    size_t input_count = 0;
+    for (auto arg : arguments)
+    {
+        input_count += arg->get_output_size();
+    }
+    m_inputs.reserve(input_count);
+
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto arg : arguments)
@@ -77,12 +94,12 @@ void Node::set_value_type_checked(const shared_ptr<const TensorViewType>& value_
     set_value_type_checked(value_type->get_element_type(), value_type->get_shape());
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+StableVector<descriptor::Output>& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const StableVector<descriptor::Output>& Node::get_outputs() const
 {
     return m_outputs;
 }
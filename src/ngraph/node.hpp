@@ -17,7 +17,6 @@
 #pragma once
 
 #include <atomic>
-#include <deque>
 #include <iostream>
 #include <memory>
 #include <set>
@@ -33,6 +32,7 @@
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/node_vector.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/type/type.hpp"
 
 namespace ngraph
@@ -84,7 +84,7 @@ namespace ngraph
         virtual void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) {}
     public:
         /// The class name, must not contain spaces
-        std::string description() const { return m_node_type; }
+        std::string description() const { return *m_node_type; }
         const std::string& get_friendly_name() const;
         const std::string& get_name() const;
         void set_name(const std::string& name);
@@ -112,15 +112,15 @@ namespace ngraph
         friend std::ostream& operator<<(std::ostream&, const Node&);
 
         // TODO: Deprecate
-        std::deque<descriptor::Input>& get_inputs() { return m_inputs; }
+        StableVector<descriptor::Input>& get_inputs() { return m_inputs; }
         // TODO: Deprecate
-        const std::deque<descriptor::Input>& get_inputs() const { return m_inputs; }
+        const StableVector<descriptor::Input>& get_inputs() const { return m_inputs; }
         // Deprecated
         // TODO: Remove from unit tests.
-        std::deque<descriptor::Output>& get_outputs();
+        StableVector<descriptor::Output>& get_outputs();
         // Deprecated
         // TODO: Remove from unit tests.
-        const std::deque<descriptor::Output>& get_outputs() const;
+        const StableVector<descriptor::Output>& get_outputs() const;
 
         /// Returns the number of outputs on the for the node.
         size_t get_output_size() const;
@@ -161,9 +161,12 @@ namespace ngraph
         /// Returns the shape of input i
         const Shape& get_input_shape(size_t i) const;
 
-        std::unordered_set<descriptor::Tensor*> liveness_live_list;
-        std::unordered_set<descriptor::Tensor*> liveness_new_list;
-        std::unordered_set<descriptor::Tensor*> liveness_free_list;
+        /// Temporary tensors first written and last read by this node, filled in by
+        /// pass::Liveness. The tensors live across a node are every new tensor of it and of
+        /// the nodes before it that has not been freed by an earlier node; see
+        /// pass::Liveness::get_live_tensors.
+        std::vector<descriptor::Tensor*> liveness_new_list;
+        std::vector<descriptor::Tensor*> liveness_free_list;
 
         virtual NodeVector get_arguments() const;
 
@@ -195,13 +198,14 @@ namespace ngraph
     protected:
         void add_output(const element::Type& element_type, const Shape& shape);
 
-        std::string m_node_type;
+        // Interned, as every node of a type carries the same name
+        const std::string* m_node_type;
         size_t m_instance_id;
         std::string m_name;
         const std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        StableVector<descriptor::Input> m_inputs;
+        StableVector<descriptor::Output> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
         Placement m_placement = Placement::DEFAULT;
     };
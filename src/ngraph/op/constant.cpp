@@ -19,6 +19,7 @@
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/constant_store.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -54,12 +55,25 @@ string to_cpp_string(T value)
 
 op::Constant::~Constant()
 {
-    if (m_data)
+    if (m_data && !m_shared_data)
     {
         aligned_free(m_data);
     }
 }
 
+shared_ptr<const void> op::Constant::share_data()
+{
+    size_t size = shape_size(m_shape) * m_element_type.size();
+    lock_guard<mutex> lock(m_share_mutex);
+    if (!m_shared_data && size > 0)
+    {
+        m_shared_data = runtime::ConstantStore::get().intern(m_data, size);
+        aligned_free(m_data);
+        m_data = const_cast<void*>(m_shared_data.get());
+    }
+    return m_shared_data;
+}
+
 vector<string> op::Constant::get_value_strings() const
 {
     vector<string> rc;
@@ -71,6 +85,20 @@ vector<string> op::Constant::get_value_strings() const
             rc.push_back(to_string(value));
         }
     }
+    else if (m_element_type == element::f16)
+    {
+        for (float value : get_vector<float16>())
+        {
+            rc.push_back(to_cpp_string(value));
+        }
+    }
+    else if (m_element_type == element::bf16)
+    {
+        for (float value : get_vector<bfloat16>())
+        {
+            rc.push_back(to_cpp_string(value));
+        }
+    }
     else if (m_element_type == element::f32)
     {
         for (float value : get_vector<float>())
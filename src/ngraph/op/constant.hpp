@@ -17,11 +17,14 @@
 #pragma once
 
 #include <cstring>
+#include <mutex>
 #include <sstream>
 
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -160,6 +163,16 @@ namespace ngraph
                 return reinterpret_cast<T*>(m_data);
             }
 
+            /// \brief Swaps the data for the identical buffer in runtime::ConstantStore, freeing
+            ///        this Constant's own copy, so equal Constants across Functions and backends
+            ///        share one buffer. Backends call it when they compile, and calls are
+            ///        serialized, so Functions sharing the Constant may compile on several
+            ///        threads at once. A thread must call it before it reads the data while
+            ///        another thread may be compiling.
+            /// \return The shared buffer, which stays valid after the Constant is gone; null
+            ///         for a Constant without elements
+            std::shared_ptr<const void> share_data();
+
             bool is_constant() const override { return true; }
         protected:
             template <typename T>
@@ -193,6 +206,14 @@ namespace ngraph
                 {
                     write_buffer<char, T>(target, source, target_element_count);
                 }
+                else if (target_type == element::f16)
+                {
+                    write_buffer<float16, T>(target, source, target_element_count);
+                }
+                else if (target_type == element::bf16)
+                {
+                    write_buffer<bfloat16, T>(target, source, target_element_count);
+                }
                 else if (target_type == element::f32)
                 {
                     write_buffer<float, T>(target, source, target_element_count);
@@ -242,6 +263,9 @@ namespace ngraph
             element::Type m_element_type;
             Shape m_shape;
             void* m_data;
+            // Owns m_data once it is shared
+            std::shared_ptr<const void> m_shared_data;
+            std::mutex m_share_mutex;
         };
     }
 }
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "ngraph/op/dequantize.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::Dequantize::Dequantize(const shared_ptr<Node>& arg,
+                           const element::Type& element_type,
+                           double scale,
+                           int64_t zero_point)
+    : UnaryElementwise("Dequantize", element_type, arg)
+    , m_scale(scale)
+    , m_zero_point(zero_point)
+{
+    auto& input_et = get_inputs().at(0).get_element_type();
+    if (input_et != element::i8 && input_et != element::u8 && input_et != element::i32)
+    {
+        throw ngraph_error("Dequantize input must be i8, u8 or i32");
+    }
+    if (element_type != element::f32 && element_type != element::f64)
+    {
+        throw ngraph_error("Dequantize output must be f32 or f64");
+    }
+    if (!(scale > 0))
+    {
+        throw ngraph_error("Dequantize scale must be positive");
+    }
+}
+
+shared_ptr<Node> op::Dequantize::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 1)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<Dequantize>(new_args.at(0), get_element_type(), m_scale, m_zero_point);
+}
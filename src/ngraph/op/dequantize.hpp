@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/unary_elementwise.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Elementwise conversion of a quantized tensor back to real values.
+        ///
+        /// Each element is mapped to \f$(q - z) * s\f$, where \f$s\f$ is the scale and \f$z\f$ the
+        /// zero point used to quantize it.
+        class Dequantize : public util::UnaryElementwise
+        {
+        public:
+            /// \brief Constructs a dequantization operation.
+            ///
+            /// \param arg          Node that produces the i8, u8 or i32 input tensor.
+            /// \param element_type Element type for the output tensor: f32 or f64.
+            /// \param scale        Real value of one quantization step, must be positive.
+            /// \param zero_point   Quantized value that represents real zero.
+            Dequantize(const std::shared_ptr<Node>& arg,
+                       const element::Type& element_type,
+                       double scale,
+                       int64_t zero_point = 0);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            double get_scale() const { return m_scale; }
+            int64_t get_zero_point() const { return m_zero_point; }
+        protected:
+            double m_scale;
+            int64_t m_zero_point;
+        };
+    }
+}
@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "ngraph/op/quantize.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::Quantize::Quantize(const shared_ptr<Node>& arg,
+                       const element::Type& element_type,
+                       double scale,
+                       int64_t zero_point)
+    : UnaryElementwise("Quantize", element_type, arg)
+    , m_scale(scale)
+    , m_zero_point(zero_point)
+{
+    auto& input_et = get_inputs().at(0).get_element_type();
+    if (input_et != element::f32 && input_et != element::f64)
+    {
+        throw ngraph_error("Quantize input must be f32 or f64");
+    }
+    if (element_type != element::i8 && element_type != element::u8 &&
+        element_type != element::i32)
+    {
+        throw ngraph_error("Quantize output must be i8, u8 or i32");
+    }
+    if (!(scale > 0))
+    {
+        throw ngraph_error("Quantize scale must be positive");
+    }
+}
+
+shared_ptr<Node> op::Quantize::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 1)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<Quantize>(new_args.at(0), get_element_type(), m_scale, m_zero_point);
+}
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/unary_elementwise.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Elementwise affine quantization of a real tensor.
+        ///
+        /// Each element is mapped to \f$\mathit{clamp}(\mathit{round}(x / s) + z)\f$, where
+        /// \f$s\f$ is the scale and \f$z\f$ the zero point. Rounding is to nearest even, and the
+        /// result saturates to the range of the output element type.
+        class Quantize : public util::UnaryElementwise
+        {
+        public:
+            /// \brief Constructs a quantization operation.
+            ///
+            /// \param arg          Node that produces the f32 or f64 input tensor.
+            /// \param element_type Element type for the output tensor: i8, u8 or i32.
+            /// \param scale        Real value of one quantization step, must be positive.
+            /// \param zero_point   Quantized value that represents real zero.
+            Quantize(const std::shared_ptr<Node>& arg,
+                     const element::Type& element_type,
+                     double scale,
+                     int64_t zero_point = 0);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            double get_scale() const { return m_scale; }
+            int64_t get_zero_point() const { return m_zero_point; }
+        protected:
+            double m_scale;
+            int64_t m_zero_point;
+        };
+    }
+}
@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::QuantizedConvolution::QuantizedConvolution(const shared_ptr<Node>& data_batch,
+                                               const shared_ptr<Node>& filters,
+                                               const Strides& window_movement_strides,
+                                               const Strides& window_dilation_strides,
+                                               const CoordinateDiff& padding_below,
+                                               const CoordinateDiff& padding_above,
+                                               const Strides& data_dilation_strides,
+                                               const element::Type& output_type,
+                                               double input_scale,
+                                               int64_t input_zero_point,
+                                               double filters_scale,
+                                               double output_scale,
+                                               int64_t output_zero_point)
+    : RequiresTensorViewArgs("QuantizedConvolution", {data_batch, filters})
+    , m_window_movement_strides(window_movement_strides)
+    , m_window_dilation_strides(window_dilation_strides)
+    , m_padding_below(padding_below)
+    , m_padding_above(padding_above)
+    , m_data_dilation_strides(data_dilation_strides)
+    , m_input_scale(input_scale)
+    , m_input_zero_point(input_zero_point)
+    , m_filters_scale(filters_scale)
+    , m_output_scale(output_scale)
+    , m_output_zero_point(output_zero_point)
+{
+    auto& data_batch_et = get_inputs().at(0).get_element_type();
+    auto& filters_et = get_inputs().at(1).get_element_type();
+    if (data_batch_et != element::i8 && data_batch_et != element::u8)
+    {
+        throw ngraph_error("QuantizedConvolution data batch must be i8 or u8");
+    }
+    if (filters_et != element::i8)
+    {
+        throw ngraph_error("QuantizedConvolution filters must be i8");
+    }
+    if (output_type != element::f32 && output_type != element::i8 && output_type != element::u8)
+    {
+        throw ngraph_error("QuantizedConvolution output must be f32, i8 or u8");
+    }
+    if (!(input_scale > 0) || !(filters_scale > 0) || !(output_scale > 0))
+    {
+        throw ngraph_error("QuantizedConvolution scales must be positive");
+    }
+
+    set_value_type_checked(output_type,
+                           util::infer_convolution_output_shape(get_inputs().at(0).get_shape(),
+                                                                get_inputs().at(1).get_shape(),
+                                                                window_movement_strides,
+                                                                window_dilation_strides,
+                                                                padding_below,
+                                                                padding_above,
+                                                                data_dilation_strides,
+                                                                0,
+                                                                1,
+                                                                1,
+                                                                0,
+                                                                0,
+                                                                1,
+                                                                "QuantizedConvolution: "));
+}
+
+shared_ptr<Node> op::QuantizedConvolution::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<QuantizedConvolution>(new_args.at(0),
+                                             new_args.at(1),
+                                             m_window_movement_strides,
+                                             m_window_dilation_strides,
+                                             m_padding_below,
+                                             m_padding_above,
+                                             m_data_dilation_strides,
+                                             get_element_type(),
+                                             m_input_scale,
+                                             m_input_zero_point,
+                                             m_filters_scale,
+                                             m_output_scale,
+                                             m_output_zero_point);
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Batched convolution of a quantized data batch with symmetrically quantized i8
+        ///        filters.
+        ///
+        /// The window parameters have the same meaning as for Convolution. Padding and data
+        /// dilation holes stand for real zero. Accumulation and rescaling follow QuantizedDot.
+        class QuantizedConvolution : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs a quantized batched convolution operation.
+            ///
+            /// \param data_batch The node producing the i8 or u8 data batch.<br>
+            /// `[N, C_IN, D1, ... Df]`
+            /// \param filters The node producing the i8 filters.<br>
+            /// `[C_OUT, C_IN, F1, ... Ff]`
+            /// \param window_movement_strides The window movement strides.
+            /// \param window_dilation_strides The window dilation strides.
+            /// \param padding_below The padding-below sizes.
+            /// \param padding_above The padding-above sizes.
+            /// \param data_dilation_strides The data dilation strides.
+            /// \param output_type The output element type: f32, i8 or u8.
+            /// \param input_scale The quantization scale of the data batch.
+            /// \param input_zero_point The quantization zero point of the data batch.
+            /// \param filters_scale The quantization scale of the filters.
+            /// \param output_scale The requantization scale, for integral outputs only.
+            /// \param output_zero_point The requantization zero point, for integral outputs only.
+            ///
+            /// Output `[N, C_OUT, R1, ... Rf]`
+            ///
+            QuantizedConvolution(const std::shared_ptr<Node>& data_batch,
+                                 const std::shared_ptr<Node>& filters,
+                                 const Strides& window_movement_strides,
+                                 const Strides& window_dilation_strides,
+                                 const CoordinateDiff& padding_below,
+                                 const CoordinateDiff& padding_above,
+                                 const Strides& data_dilation_strides,
+                                 const element::Type& output_type,
+                                 double input_scale,
+                                 int64_t input_zero_point,
+                                 double filters_scale,
+                                 double output_scale = 1.0,
+                                 int64_t output_zero_point = 0);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            /// \return The window movement strides.
+            const Strides& get_window_movement_strides() const { return m_window_movement_strides; }
+            /// \return The window dilation strides.
+            const Strides& get_window_dilation_strides() const { return m_window_dilation_strides; }
+            /// \return The padding-below sizes (possibly negative).
+            const CoordinateDiff& get_padding_below() const { return m_padding_below; }
+            /// \return The padding-above sizes (possibly negative).
+            const CoordinateDiff& get_padding_above() const { return m_padding_above; }
+            /// \return The input data dilation strides.
+            const Strides& get_data_dilation_strides() const { return m_data_dilation_strides; }
+            double get_input_scale() const { return m_input_scale; }
+            int64_t get_input_zero_point() const { return m_input_zero_point; }
+            double get_filters_scale() const { return m_filters_scale; }
+            double get_output_scale() const { return m_output_scale; }
+            int64_t get_output_zero_point() const { return m_output_zero_point; }
+        protected:
+            Strides m_window_movement_strides;
+            Strides m_window_dilation_strides;
+            CoordinateDiff m_padding_below;
+            CoordinateDiff m_padding_above;
+            Strides m_data_dilation_strides;
+            double m_input_scale;
+            int64_t m_input_zero_point;
+            double m_filters_scale;
+            double m_output_scale;
+            int64_t m_output_zero_point;
+        };
+    }
+}
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "ngraph/op/quantized_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::QuantizedDot::QuantizedDot(const shared_ptr<Node>& input,
+                               const shared_ptr<Node>& weights,
+                               const element::Type& output_type,
+                               double input_scale,
+                               int64_t input_zero_point,
+                               double weights_scale,
+                               double output_scale,
+                               int64_t output_zero_point)
+    : RequiresTensorViewArgs("QuantizedDot", {input, weights})
+    , m_input_scale(input_scale)
+    , m_input_zero_point(input_zero_point)
+    , m_weights_scale(weights_scale)
+    , m_output_scale(output_scale)
+    , m_output_zero_point(output_zero_point)
+{
+    auto& input_et = get_inputs().at(0).get_element_type();
+    auto& weights_et = get_inputs().at(1).get_element_type();
+    if (input_et != element::i8 && input_et != element::u8)
+    {
+        throw ngraph_error("QuantizedDot input must be i8 or u8");
+    }
+    if (weights_et != element::i8)
+    {
+        throw ngraph_error("QuantizedDot weights must be i8");
+    }
+    if (output_type != element::f32 && output_type != element::i8 && output_type != element::u8)
+    {
+        throw ngraph_error("QuantizedDot output must be f32, i8 or u8");
+    }
+    if (!(input_scale > 0) || !(weights_scale > 0) || !(output_scale > 0))
+    {
+        throw ngraph_error("QuantizedDot scales must be positive");
+    }
+
+    const Shape& input_shape = get_inputs().at(0).get_shape();
+    const Shape& weights_shape = get_inputs().at(1).get_shape();
+    if (input_shape.empty() || weights_shape.empty())
+    {
+        throw ngraph_error("QuantizedDot arguments must not be scalars");
+    }
+    if (input_shape.back() != weights_shape.front())
+    {
+        throw ngraph_error("QuantizedDot axes do not have same length");
+    }
+
+    Shape result_shape(input_shape.begin(), input_shape.end() - 1);
+    result_shape.insert(result_shape.end(), weights_shape.begin() + 1, weights_shape.end());
+    set_value_type_checked(output_type, result_shape);
+}
+
+shared_ptr<Node> op::QuantizedDot::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<QuantizedDot>(new_args.at(0),
+                                     new_args.at(1),
+                                     get_element_type(),
+                                     m_input_scale,
+                                     m_input_zero_point,
+                                     m_weights_scale,
+                                     m_output_scale,
+                                     m_output_zero_point);
+}
@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Dot product of a quantized input with symmetrically quantized i8 weights,
+        ///        contracting the last axis of the input with the first axis of the weights.
+        ///
+        /// Products are accumulated in i32 as \f$\sum (a - z_a) w\f$ and rescaled by
+        /// \f$s_a s_w\f$. An f32 output receives the rescaled value directly. An i8 or u8 output
+        /// is requantized with the output scale and zero point, which fuses the Quantize of a
+        /// following quantized op into this one.
+        class QuantizedDot : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs a quantized dot product operation.
+            ///
+            /// \param input The node producing the i8 or u8 input.
+            /// \param weights The node producing the i8 weights.
+            /// \param output_type The output element type: f32, i8 or u8.
+            /// \param input_scale The quantization scale of the input.
+            /// \param input_zero_point The quantization zero point of the input.
+            /// \param weights_scale The quantization scale of the weights.
+            /// \param output_scale The requantization scale, for integral outputs only.
+            /// \param output_zero_point The requantization zero point, for integral outputs only.
+            QuantizedDot(const std::shared_ptr<Node>& input,
+                         const std::shared_ptr<Node>& weights,
+                         const element::Type& output_type,
+                         double input_scale,
+                         int64_t input_zero_point,
+                         double weights_scale,
+                         double output_scale = 1.0,
+                         int64_t output_zero_point = 0);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            double get_input_scale() const { return m_input_scale; }
+            int64_t get_input_zero_point() const { return m_input_zero_point; }
+            double get_weights_scale() const { return m_weights_scale; }
+            double get_output_scale() const { return m_output_scale; }
+            int64_t get_output_zero_point() const { return m_output_zero_point; }
+        protected:
+            double m_input_scale;
+            int64_t m_input_zero_point;
+            double m_weights_scale;
+            double m_output_scale;
+            int64_t m_output_zero_point;
+        };
+    }
+}
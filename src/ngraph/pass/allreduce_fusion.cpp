@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/allreduce_fusion.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+const size_t pass::AllReduceFusion::s_default_bucket_size = 16 * 1024 * 1024;
+
+static shared_ptr<Node> flatten(const shared_ptr<Node>& node)
+{
+    const Shape& shape = node->get_shape();
+    if (shape.size() == 1)
+    {
+        return node;
+    }
+    AxisVector order(shape.size());
+    iota(begin(order), end(order), 0);
+    return make_shared<op::Reshape>(node, order, Shape{shape_size(shape)});
+}
+
+static void fuse_bucket(const vector<shared_ptr<Node>>& bucket)
+{
+    NodeVector packed_args;
+    for (auto& allreduce : bucket)
+    {
+        packed_args.push_back(flatten(allreduce->get_argument(0)));
+    }
+    auto packed = make_shared<op::Concat>(packed_args, 0);
+    auto fused = make_shared<op::AllReduce>(packed);
+
+    size_t offset = 0;
+    for (auto& allreduce : bucket)
+    {
+        const Shape& shape = allreduce->get_shape();
+        size_t count = shape_size(shape);
+        shared_ptr<Node> unpacked =
+            make_shared<op::Slice>(fused, Coordinate{offset}, Coordinate{offset + count});
+        if (shape.size() != 1)
+        {
+            unpacked = make_shared<op::Reshape>(unpacked, AxisVector{0}, shape);
+        }
+        replace_node(allreduce, unpacked);
+        offset += count;
+    }
+    NGRAPH_DEBUG << "Fused " << bucket.size() << " AllReduce ops into " << fused->get_name()
+                 << " (" << offset << " elements)";
+}
+
+bool pass::AllReduceFusion::run_on_function(shared_ptr<Function> f)
+{
+    // Open bucket per element type. Each type's buckets are numbered in the order they open.
+    struct Bucket
+    {
+        vector<shared_ptr<Node>> m_members;
+        size_t m_number = 1;
+        size_t m_bytes = 0;
+    };
+    map<element::Type, Bucket> open_buckets;
+    vector<vector<shared_ptr<Node>>> buckets;
+
+    auto close_bucket = [&buckets](Bucket& bucket) {
+        if (bucket.m_members.size() > 1)
+        {
+            buckets.push_back(bucket.m_members);
+        }
+        size_t next = bucket.m_number + 1;
+        bucket = Bucket();
+        bucket.m_number = next;
+    };
+
+    // For every node, the highest numbered bucket of each element type that it transitively
+    // consumes a member of. Numbers only grow, so a node depends on the open bucket of a type
+    // exactly when its entry equals that bucket's number. One walk in topological order
+    // computes this for the whole graph.
+    using Reach = map<element::Type, size_t>;
+    unordered_map<Node*, Reach> reach;
+
+    for (auto& n : f->get_ordered_ops())
+    {
+        Reach& node_reach = reach[n.get()];
+        for (auto& arg : n->get_arguments())
+        {
+            for (auto& p : reach[arg.get()])
+            {
+                size_t& number = node_reach[p.first];
+                number = max(number, p.second);
+            }
+        }
+
+        if (!dynamic_pointer_cast<op::AllReduce>(n))
+        {
+            continue;
+        }
+
+        // A bucket this AllReduce depends on cannot take in anything later. Fusing it with
+        // an AllReduce that this one feeds, directly or through a bucket of another element
+        // type, would make the fused ops depend on each other.
+        for (auto& p : open_buckets)
+        {
+            auto it = node_reach.find(p.first);
+            if (!p.second.m_members.empty() && it != node_reach.end() &&
+                it->second == p.second.m_number)
+            {
+                close_bucket(p.second);
+            }
+        }
+
+        size_t bytes = shape_size(n->get_shape()) * n->get_element_type().size();
+        Bucket& bucket = open_buckets[n->get_element_type()];
+        if (!bucket.m_members.empty() && bucket.m_bytes + bytes > m_bucket_size)
+        {
+            close_bucket(bucket);
+        }
+        bucket.m_members.push_back(n);
+        bucket.m_bytes += bytes;
+        node_reach[n->get_element_type()] = bucket.m_number;
+    }
+    for (auto& p : open_buckets)
+    {
+        close_bucket(p.second);
+    }
+
+    for (auto& bucket : buckets)
+    {
+        fuse_bucket(bucket);
+    }
+    return !buckets.empty();
+}
@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class AllReduceFusion;
+    }
+}
+
+/// @brief Packs independent AllReduce ops into size-bounded buckets.
+///
+/// AllReduce ops of the same element type are visited in topological order and grouped until
+/// a bucket would exceed bucket_size bytes. Each bucket with more than one member becomes a
+/// Concat of the flattened arguments, a single AllReduce over the packed buffer, and a
+/// Slice/Reshape per original result. An AllReduce whose argument depends on a member of the
+/// open bucket starts a new bucket so the rewrite never introduces a cycle.
+class ngraph::pass::AllReduceFusion : public FunctionPass
+{
+public:
+    AllReduceFusion(size_t bucket_size = s_default_bucket_size)
+        : FunctionPass()
+        , m_bucket_size(bucket_size)
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+
+    static const size_t s_default_bucket_size;
+
+private:
+    size_t m_bucket_size;
+};
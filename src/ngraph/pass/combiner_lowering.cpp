@@ -0,0 +1,232 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <numeric>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/greater.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/min.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/product.hpp"
+#include "ngraph/op/reduce.hpp"
+#include "ngraph/op/reduce_window.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/select_and_scatter.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/pass/combiner_lowering.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// True if the result of f is a T applied to the parameters of f, in order unless commutative
+template <typename T>
+static bool is_combiner(const shared_ptr<Function>& f, bool commutative)
+{
+    auto body = dynamic_pointer_cast<T>(f->get_results().at(0)->get_argument(0));
+    if (!body)
+    {
+        return false;
+    }
+    auto& params = f->get_parameters();
+    auto a = body->get_argument(0);
+    auto b = body->get_argument(1);
+    return (a == params.at(0) && b == params.at(1)) ||
+           (commutative && a == params.at(1) && b == params.at(0));
+}
+
+static shared_ptr<Node> broadcast_init(const shared_ptr<Node>& init, const Shape& shape)
+{
+    if (shape.empty())
+    {
+        return init;
+    }
+    AxisSet axes;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        axes.insert(i);
+    }
+    return make_shared<op::Broadcast>(init, shape, axes);
+}
+
+static shared_ptr<Node> reshape(const shared_ptr<Node>& node, const Shape& shape)
+{
+    AxisVector order(node->get_shape().size());
+    iota(order.begin(), order.end(), 0);
+    return make_shared<op::Reshape>(node, order, shape);
+}
+
+// Pooling ops window over every axis but the first two. When a windowed op does not leave
+// those alone, the arguments get two unit axes prepended instead.
+static bool has_pooling_layout(const Shape& window_shape, const Strides& strides)
+{
+    return window_shape.size() >= 3 && window_shape[0] == 1 && window_shape[1] == 1 &&
+           strides[0] == 1 && strides[1] == 1;
+}
+
+static Shape to_pooling_shape(const Shape& shape, bool pooling_layout)
+{
+    if (pooling_layout)
+    {
+        return Shape(shape.begin() + 2, shape.end());
+    }
+    return shape;
+}
+
+static Strides to_pooling_strides(const Strides& strides, bool pooling_layout)
+{
+    if (pooling_layout)
+    {
+        return Strides(strides.begin() + 2, strides.end());
+    }
+    return strides;
+}
+
+static shared_ptr<Node> to_pooling_arg(const shared_ptr<Node>& node, bool pooling_layout)
+{
+    if (pooling_layout)
+    {
+        return node;
+    }
+    Shape shape{1, 1};
+    shape.insert(shape.end(), node->get_shape().begin(), node->get_shape().end());
+    return reshape(node, shape);
+}
+
+static shared_ptr<Node> lower_reduce(const shared_ptr<op::Reduce>& reduce)
+{
+    auto f = reduce->get_functions().at(0);
+    auto arg = reduce->get_argument(0);
+    auto init = broadcast_init(reduce->get_argument(1), reduce->get_shape());
+    const AxisSet& axes = reduce->get_reduction_axes();
+
+    if (is_combiner<op::Add>(f, true))
+    {
+        return make_shared<op::Add>(make_shared<op::Sum>(arg, axes), init);
+    }
+    if (is_combiner<op::Multiply>(f, true))
+    {
+        return make_shared<op::Multiply>(make_shared<op::Product>(arg, axes), init);
+    }
+    if (is_combiner<op::Maximum>(f, true))
+    {
+        return make_shared<op::Maximum>(make_shared<op::Max>(arg, axes), init);
+    }
+    if (is_combiner<op::Minimum>(f, true))
+    {
+        return make_shared<op::Minimum>(make_shared<op::Min>(arg, axes), init);
+    }
+    return nullptr;
+}
+
+static shared_ptr<Node> lower_reduce_window(const shared_ptr<op::ReduceWindow>& reduce_window)
+{
+    if (!is_combiner<op::Maximum>(reduce_window->get_functions().at(0), true))
+    {
+        return nullptr;
+    }
+    const Shape& window_shape = reduce_window->get_window_shape();
+    const Strides& strides = reduce_window->get_window_movement_strides();
+    if (window_shape.empty())
+    {
+        return nullptr;
+    }
+    bool pooling_layout = has_pooling_layout(window_shape, strides);
+
+    shared_ptr<Node> pool =
+        make_shared<op::MaxPool>(to_pooling_arg(reduce_window->get_argument(0), pooling_layout),
+                                 to_pooling_shape(window_shape, pooling_layout),
+                                 to_pooling_strides(strides, pooling_layout));
+    if (!pooling_layout)
+    {
+        pool = reshape(pool, reduce_window->get_shape());
+    }
+    return make_shared<op::Maximum>(
+        pool, broadcast_init(reduce_window->get_argument(1), reduce_window->get_shape()));
+}
+
+static shared_ptr<Node>
+    lower_select_and_scatter(const shared_ptr<op::SelectAndScatter>& select_and_scatter)
+{
+    // Strictly greater keeps the first maximum of each window, as MaxPoolBackprop does
+    auto functions = select_and_scatter->get_functions();
+    if (!is_combiner<op::Greater>(functions.at(0), false) ||
+        !is_combiner<op::Add>(functions.at(1), true))
+    {
+        return nullptr;
+    }
+    const Shape& window_shape = select_and_scatter->get_window_shape();
+    const Strides& strides = select_and_scatter->get_window_movement_strides();
+    if (window_shape.empty())
+    {
+        return nullptr;
+    }
+    bool pooling_layout = has_pooling_layout(window_shape, strides);
+    Shape pooling_window_shape = to_pooling_shape(window_shape, pooling_layout);
+
+    shared_ptr<Node> backprop = make_shared<op::MaxPoolBackprop>(
+        to_pooling_arg(select_and_scatter->get_argument(0), pooling_layout),
+        to_pooling_arg(select_and_scatter->get_argument(1), pooling_layout),
+        pooling_window_shape,
+        to_pooling_strides(strides, pooling_layout),
+        Shape(pooling_window_shape.size(), 0),
+        Shape(pooling_window_shape.size(), 0));
+    if (!pooling_layout)
+    {
+        backprop = reshape(backprop, select_and_scatter->get_shape());
+    }
+    return make_shared<op::Add>(
+        backprop,
+        broadcast_init(select_and_scatter->get_argument(2), select_and_scatter->get_shape()));
+}
+
+bool pass::CombinerLowering::run_on_function(shared_ptr<Function> f)
+{
+    bool modified = false;
+    for (shared_ptr<Node> n : f->get_ordered_ops())
+    {
+        if (n->get_outputs().size() != 1 || n->get_element_type() == element::boolean)
+        {
+            continue;
+        }
+
+        shared_ptr<Node> replacement;
+        if (auto reduce = dynamic_pointer_cast<op::Reduce>(n))
+        {
+            replacement = lower_reduce(reduce);
+        }
+        else if (auto reduce_window = dynamic_pointer_cast<op::ReduceWindow>(n))
+        {
+            replacement = lower_reduce_window(reduce_window);
+        }
+        else if (auto select_and_scatter = dynamic_pointer_cast<op::SelectAndScatter>(n))
+        {
+            replacement = lower_select_and_scatter(select_and_scatter);
+        }
+
+        if (replacement)
+        {
+            replace_node(n, replacement);
+            modified = true;
+        }
+    }
+    return modified;
+}
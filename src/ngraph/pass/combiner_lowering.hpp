@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class CombinerLowering;
+    }
+}
+
+/// @brief Replaces Reduce, ReduceWindow and SelectAndScatter ops whose nested functions
+///        (combiners) are recognised with the equivalent native ops.
+///
+/// A combiner is recognised when its result is a single binary op applied to its two
+/// parameters. The lowerings are:
+///
+/// | Op               | Combiner                                | Replacement            |
+/// | ---------------- | --------------------------------------- | ---------------------- |
+/// | Reduce           | `a+b`, `a*b`, `max(a,b)`, `min(a,b)`    | Sum, Product, Max, Min |
+/// | ReduceWindow     | `max(a,b)`                              | MaxPool                |
+/// | SelectAndScatter | select `a>b`, scatter `a+b`             | MaxPoolBackprop        |
+///
+/// The init value is folded into the result with the combiner itself, so the replacement
+/// computes the same fold as the reference kernel up to reassociation. Windowed ops whose two
+/// leading axes are not unit windows with unit strides are reshaped so that they are.
+class ngraph::pass::CombinerLowering : public FunctionPass
+{
+public:
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+};
@@ -0,0 +1,156 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <iomanip>
+#include <sys/resource.h>
+
+#include "ngraph/op/constant.hpp"
+#include "ngraph/pass/compile_profile.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+pass::CompileProfile::GraphSize
+    pass::CompileProfile::measure(const vector<shared_ptr<Function>>& functions)
+{
+    GraphSize size;
+    for (const shared_ptr<Function>& f : functions)
+    {
+        for (const shared_ptr<Node>& node : f->get_ops())
+        {
+            size.nodes++;
+            size.tensors += node->get_output_size();
+            if (auto constant = dynamic_cast<op::Constant*>(node.get()))
+            {
+                size.constant_bytes +=
+                    shape_size(constant->get_shape()) * constant->get_element_type().size();
+            }
+        }
+    }
+    return size;
+}
+
+size_t pass::CompileProfile::get_peak_rss()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+    // Linux reports kilobytes
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+}
+
+void pass::CompileProfile::set_initial_graph_size(const GraphSize& graph_size)
+{
+    m_last_graph_size = graph_size;
+}
+
+void pass::CompileProfile::add_phase(const string& name, size_t microseconds)
+{
+    m_phases.push_back({name, microseconds, false, GraphSize(), 0, get_peak_rss()});
+}
+
+void pass::CompileProfile::add_phase(const string& name,
+                                     size_t microseconds,
+                                     const GraphSize& graph_size)
+{
+    int64_t node_delta = static_cast<int64_t>(graph_size.nodes) -
+                         static_cast<int64_t>(m_last_graph_size.nodes);
+    m_phases.push_back({name, microseconds, true, graph_size, node_delta, get_peak_rss()});
+    m_last_graph_size = graph_size;
+}
+
+void pass::CompileProfile::append(const CompileProfile& other)
+{
+    m_phases.insert(m_phases.end(), other.m_phases.begin(), other.m_phases.end());
+    for (const Phase& phase : other.m_phases)
+    {
+        if (phase.has_graph_size)
+        {
+            m_last_graph_size = phase.graph_size;
+        }
+    }
+}
+
+void pass::CompileProfile::clear()
+{
+    m_phases.clear();
+    m_last_graph_size = GraphSize();
+}
+
+size_t pass::CompileProfile::get_total_microseconds() const
+{
+    size_t total = 0;
+    for (const Phase& phase : m_phases)
+    {
+        total += phase.microseconds;
+    }
+    return total;
+}
+
+void pass::CompileProfile::write_json(ostream& out) const
+{
+    nlohmann::json phases = nlohmann::json::array();
+    for (const Phase& phase : m_phases)
+    {
+        nlohmann::json p;
+        p["name"] = phase.name;
+        p["microseconds"] = phase.microseconds;
+        if (phase.has_graph_size)
+        {
+            p["nodes"] = phase.graph_size.nodes;
+            p["node_delta"] = phase.node_delta;
+            p["tensors"] = phase.graph_size.tensors;
+            p["constant_bytes"] = phase.graph_size.constant_bytes;
+        }
+        p["peak_rss_bytes"] = phase.peak_rss;
+        phases.push_back(p);
+    }
+    nlohmann::json report;
+    report["total_microseconds"] = get_total_microseconds();
+    report["phases"] = phases;
+    out << report.dump(4) << "\n";
+}
+
+void pass::CompileProfile::write_table(ostream& out) const
+{
+    size_t name_width = 5;
+    for (const Phase& phase : m_phases)
+    {
+        name_width = max(name_width, phase.name.size());
+    }
+    out << left << setw(name_width) << "phase" << right << setw(12) << "time(us)" << setw(10)
+        << "nodes" << setw(10) << "delta" << setw(10) << "tensors" << setw(14) << "constants"
+        << setw(14) << "peak rss" << "\n";
+    for (const Phase& phase : m_phases)
+    {
+        out << left << setw(name_width) << phase.name << right << setw(12) << phase.microseconds;
+        if (phase.has_graph_size)
+        {
+            out << setw(10) << phase.graph_size.nodes << setw(10) << phase.node_delta << setw(10)
+                << phase.graph_size.tensors << setw(14) << phase.graph_size.constant_bytes;
+        }
+        else
+        {
+            out << setw(44) << "";
+        }
+        out << setw(14) << phase.peak_rss << "\n";
+    }
+    out << left << setw(name_width) << "total" << right << setw(12) << get_total_microseconds()
+        << "\n";
+}
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class CompileProfile;
+    }
+}
+
+/// \brief Where the time and memory of compiling a module went: one phase per pass or backend
+///        step, in the order they ran.
+///
+/// Graph phases also record the size of the module after they ran, so a pass that blows up or
+/// shrinks the graph shows in the node delta.
+class ngraph::pass::CompileProfile
+{
+public:
+    struct GraphSize
+    {
+        size_t nodes = 0;
+        size_t tensors = 0;
+        size_t constant_bytes = 0;
+    };
+
+    struct Phase
+    {
+        std::string name;
+        size_t microseconds;
+        bool has_graph_size;
+        GraphSize graph_size;
+        int64_t node_delta;
+        size_t peak_rss;
+    };
+
+    /// \brief Counts the nodes, output tensors and constant bytes of every function.
+    static GraphSize measure(const std::vector<std::shared_ptr<Function>>& functions);
+    /// \return The peak resident set size of the process in bytes, or 0 if unknown.
+    static size_t get_peak_rss();
+
+    /// \brief Records the size of the module before the first graph phase.
+    void set_initial_graph_size(const GraphSize& graph_size);
+    void add_phase(const std::string& name, size_t microseconds);
+    void add_phase(const std::string& name, size_t microseconds, const GraphSize& graph_size);
+    /// \brief Appends the phases of another profile, e.g. a pass manager's, to this one.
+    void append(const CompileProfile& other);
+    void clear();
+
+    const std::vector<Phase>& get_phases() const { return m_phases; }
+    size_t get_total_microseconds() const;
+
+    void write_json(std::ostream& out) const;
+    /// \brief Writes one aligned line per phase.
+    void write_table(std::ostream& out) const;
+
+private:
+    std::vector<Phase> m_phases;
+    GraphSize m_last_graph_size;
+};
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cmath>
 #include <unordered_set>
 
 #include "ngraph/pass/core_fusion.hpp"
@@ -27,6 +28,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
@@ -178,19 +180,128 @@ void pass::CoreFusion::construct_sigmoid_bprop()
     this->add_matcher(m);
 }
 
+// Scale gamma / sqrt(variance + eps) and shift beta - mean * scale of an inference BatchNorm,
+// so that bn(x) = x * scale + shift per channel. When gamma, beta, mean and variance are f32
+// Constants the values are computed here; otherwise they are built as ops.
+static void get_batch_norm_scale_and_shift(const std::shared_ptr<op::BatchNorm>& bn,
+                                           std::shared_ptr<Node>& scale,
+                                           std::shared_ptr<Node>& shift)
+{
+    auto gamma = bn->get_argument(0);
+    auto beta = bn->get_argument(1);
+    auto mean = bn->get_argument(3);
+    auto var = bn->get_argument(4);
+
+    auto c_gamma = std::dynamic_pointer_cast<op::Constant>(gamma);
+    auto c_beta = std::dynamic_pointer_cast<op::Constant>(beta);
+    auto c_mean = std::dynamic_pointer_cast<op::Constant>(mean);
+    auto c_var = std::dynamic_pointer_cast<op::Constant>(var);
+    if (c_gamma && c_beta && c_mean && c_var && bn->get_element_type() == element::f32)
+    {
+        auto gamma_values = c_gamma->get_vector<float>();
+        auto beta_values = c_beta->get_vector<float>();
+        auto mean_values = c_mean->get_vector<float>();
+        auto var_values = c_var->get_vector<float>();
+        std::vector<float> scale_values(gamma_values.size());
+        std::vector<float> shift_values(gamma_values.size());
+        for (size_t c = 0; c < gamma_values.size(); c++)
+        {
+            scale_values[c] = static_cast<float>(gamma_values[c] /
+                                                 std::sqrt(var_values[c] + bn->get_eps_value()));
+            shift_values[c] = beta_values[c] - mean_values[c] * scale_values[c];
+        }
+        scale = op::Constant::create(element::f32, gamma->get_shape(), scale_values);
+        shift = op::Constant::create(element::f32, gamma->get_shape(), shift_values);
+        return;
+    }
+
+    auto bn_eps = op::Constant::create(bn->get_element_type(), Shape{}, {bn->get_eps_value()});
+    auto var_eps = std::make_shared<op::Add>(
+        var, std::make_shared<op::Broadcast>(bn_eps, var->get_shape(), AxisSet{0}));
+    auto sqrt_var_eps = std::make_shared<op::Sqrt>(var_eps);
+    scale = std::make_shared<op::Divide>(gamma, sqrt_var_eps);
+    shift = std::make_shared<op::Subtract>(beta, std::make_shared<op::Multiply>(mean, scale));
+}
+
+// weights with every slice along channel_axis multiplied by its element of scale
+static std::shared_ptr<Node> scale_weights(const std::shared_ptr<Node>& weights,
+                                           const std::shared_ptr<Node>& scale,
+                                           size_t channel_axis)
+{
+    const Shape& shape = weights->get_shape();
+    auto c_weights = std::dynamic_pointer_cast<op::Constant>(weights);
+    auto c_scale = std::dynamic_pointer_cast<op::Constant>(scale);
+    if (c_weights && c_scale && weights->get_element_type() == element::f32)
+    {
+        auto values = c_weights->get_vector<float>();
+        auto scale_values = c_scale->get_vector<float>();
+        size_t stride = shape_size(Shape(shape.begin() + channel_axis + 1, shape.end()));
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] *= scale_values[(i / stride) % shape[channel_axis]];
+        }
+        return op::Constant::create(element::f32, shape, values);
+    }
+
+    AxisSet broadcast_axes;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        if (i != channel_axis)
+        {
+            broadcast_axes.insert(i);
+        }
+    }
+    return std::make_shared<op::Multiply>(
+        weights, std::make_shared<op::Broadcast>(scale, shape, broadcast_axes));
+}
+
+// bias * scale + shift, or just shift without a bias
+static std::shared_ptr<Node> fold_bias(const std::shared_ptr<Node>& bias,
+                                       const std::shared_ptr<Node>& scale,
+                                       const std::shared_ptr<Node>& shift)
+{
+    if (!bias)
+    {
+        return shift;
+    }
+    auto c_bias = std::dynamic_pointer_cast<op::Constant>(bias);
+    auto c_scale = std::dynamic_pointer_cast<op::Constant>(scale);
+    auto c_shift = std::dynamic_pointer_cast<op::Constant>(shift);
+    if (c_bias && c_scale && c_shift && bias->get_element_type() == element::f32)
+    {
+        auto values = c_bias->get_vector<float>();
+        auto scale_values = c_scale->get_vector<float>();
+        auto shift_values = c_shift->get_vector<float>();
+        for (size_t c = 0; c < values.size(); c++)
+        {
+            values[c] = values[c] * scale_values[c] + shift_values[c];
+        }
+        return op::Constant::create(element::f32, bias->get_shape(), values);
+    }
+    return std::make_shared<op::Add>(std::make_shared<op::Multiply>(bias, scale), shift);
+}
+
+// Every axis of shape but the channel axis 1, along which a per-channel vector is broadcast
+static AxisSet get_non_channel_axes(const Shape& shape)
+{
+    AxisSet axes;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        if (i != 1)
+        {
+            axes.insert(i);
+        }
+    }
+    return axes;
+}
+
+// Folds an inference BatchNorm into the weights and bias of the Convolution or matrix Dot in
+// front of it, with or without a bias added through a Broadcast. A Dot with a bias is what
+// CPUFusion later turns into MatmulBias, so this also covers MatmulBias followed by BatchNorm.
 void pass::CoreFusion::construct_folded_batch_norm()
 {
     Shape shape{2, 2, 1, 1};
     auto input = std::make_shared<pattern::op::Label>(element::f32, shape);
-    auto filters = std::make_shared<pattern::op::Label>(element::f32, shape);
-
-    auto pconv = std::make_shared<op::Convolution>(input,
-                                                   filters,
-                                                   Strides{1, 1},
-                                                   Strides{1, 1},
-                                                   CoordinateDiff{0, 0},
-                                                   CoordinateDiff{0, 0},
-                                                   Strides{1, 1});
     auto mean_shape = Shape{2};
     auto mean = std::make_shared<pattern::op::Label>(element::f32, mean_shape);
     auto var_shape = Shape{2};
@@ -200,59 +311,86 @@ void pass::CoreFusion::construct_folded_batch_norm()
     auto beta_shape = Shape{2};
     auto beta = std::make_shared<pattern::op::Label>(element::f32, beta_shape);
     double eps = 0.001;
-    auto shape_r = Shape{1, 2, 2, 2};
-    auto bn = std::make_shared<op::BatchNorm>(eps, gamma, beta, pconv, mean, var);
+    auto bn = std::make_shared<op::BatchNorm>(eps, gamma, beta, input, mean, var);
 
-    ngraph::pattern::graph_rewrite_callback callback = [input, filters, mean, var, gamma, beta](
-        pattern::Matcher& m) {
+    ngraph::pattern::graph_rewrite_callback callback = [](pattern::Matcher& m) {
         NGRAPH_DEBUG << "In callback for folded batch norm against node = "
                      << m.get_match_root()->get_name();
-        auto pattern_map = m.get_pattern_map();
 
         auto m_bn = std::dynamic_pointer_cast<op::BatchNorm>(m.get_match_root());
-        auto m_conv = std::dynamic_pointer_cast<op::Convolution>(m_bn->get_argument(2));
-
-        if (m_conv->get_users().size() > 1)
+        if (m_bn->get_training_flag())
         {
             return false;
         }
 
-        if (m_conv->get_shape().size() != 4)
+        auto product = m_bn->get_argument(2);
+        if (product->get_users().size() > 1)
         {
             return false;
         }
 
-        // new weights = old weights * gamma / sqrt(variance + epsilon)
-        // new biases = -mean * gamma / sqrt(variance + epsilon) + beta
-
-        auto bn_eps = op::Constant::create(element::f32, Shape{}, {m_bn->get_eps_value()});
-        auto var_eps = std::make_shared<op::Add>(
-            pattern_map[var],
-            std::make_shared<op::Broadcast>(bn_eps, pattern_map[var]->get_shape(), AxisSet{0}));
-        auto sqrt_var_eps = std::make_shared<op::Sqrt>(var_eps);
-
-        auto mean_gamma = std::make_shared<op::Multiply>(pattern_map[mean], pattern_map[gamma]);
-        auto new_biases = std::make_shared<op::Subtract>(
-            pattern_map[beta], std::make_shared<op::Divide>(mean_gamma, sqrt_var_eps));
-        auto weight_scaling = std::make_shared<op::Divide>(pattern_map[gamma], sqrt_var_eps);
-        auto new_weights = std::make_shared<op::Multiply>(
-            pattern_map[filters],
-            std::make_shared<op::Broadcast>(
-                weight_scaling, pattern_map[filters]->get_shape(), AxisSet{1, 2, 3}));
-
-        auto conv = std::make_shared<op::Convolution>(pattern_map[input],
-                                                      new_weights,
-                                                      m_conv->get_window_movement_strides(),
-                                                      m_conv->get_window_dilation_strides(),
-                                                      m_conv->get_padding_below(),
-                                                      m_conv->get_padding_above(),
-                                                      m_conv->get_data_dilation_strides());
-        auto conv_bias =
-            conv + std::make_shared<op::Broadcast>(new_biases, conv->get_shape(), AxisSet{0, 2, 3});
-        ngraph::replace_node(m.get_match_root(), conv_bias);
+        AxisSet bias_axes = get_non_channel_axes(m_bn->get_shape());
+        std::shared_ptr<Node> bias;
+        if (auto add = std::dynamic_pointer_cast<op::Add>(product))
+        {
+            for (size_t i = 0; i < 2 && !bias; i++)
+            {
+                auto broadcast = std::dynamic_pointer_cast<op::Broadcast>(add->get_argument(i));
+                if (broadcast && broadcast->get_broadcast_axes() == bias_axes &&
+                    broadcast->get_argument(0)->get_shape().size() == 1)
+                {
+                    bias = broadcast->get_argument(0);
+                    product = add->get_argument(1 - i);
+                }
+            }
+            if (!bias || product->get_users().size() > 1)
+            {
+                return false;
+            }
+        }
+
+        std::shared_ptr<Node> scale;
+        std::shared_ptr<Node> shift;
+        std::shared_ptr<Node> new_product;
+        if (auto m_conv = std::dynamic_pointer_cast<op::Convolution>(product))
+        {
+            if (m_conv->get_shape().size() != 4)
+            {
+                return false;
+            }
+            // Output channels are the first axis of the filters
+            get_batch_norm_scale_and_shift(m_bn, scale, shift);
+            new_product =
+                std::make_shared<op::Convolution>(m_conv->get_argument(0),
+                                                  scale_weights(m_conv->get_argument(1), scale, 0),
+                                                  m_conv->get_window_movement_strides(),
+                                                  m_conv->get_window_dilation_strides(),
+                                                  m_conv->get_padding_below(),
+                                                  m_conv->get_padding_above(),
+                                                  m_conv->get_data_dilation_strides());
+        }
+        else if (auto m_dot = std::dynamic_pointer_cast<op::Dot>(product))
+        {
+            if (m_dot->get_reduction_axes_count() != 1 || m_dot->get_shape().size() != 2 ||
+                m_dot->get_argument(1)->get_shape().size() != 2)
+            {
+                return false;
+            }
+            // Output channels are the columns of the weights
+            get_batch_norm_scale_and_shift(m_bn, scale, shift);
+            new_product = std::make_shared<op::Dot>(
+                m_dot->get_argument(0), scale_weights(m_dot->get_argument(1), scale, 1));
+        }
+        else
+        {
+            return false;
+        }
 
+        auto new_bias = fold_bias(bias, scale, shift);
+        auto folded = new_product + std::make_shared<op::Broadcast>(
+                                        new_bias, new_product->get_shape(), bias_axes);
+        ngraph::replace_node(m.get_match_root(), folded);
         return true;
-
     };
 
     auto m = std::make_shared<ngraph::pattern::Matcher>(bn, callback);
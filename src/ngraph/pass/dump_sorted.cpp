@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <fstream>
 
 #include "ngraph/descriptor/input.hpp"
@@ -39,6 +40,8 @@ bool pass::DumpSorted::run_on_module(vector<shared_ptr<Function>>& functions)
             out << "=====================================================================\n";
             out << f->get_name() << " start\n";
             out << "=====================================================================\n";
+            // Printing the live set is linear in its size anyway, so replay it with a vector
+            vector<descriptor::Tensor*> live;
             for (const shared_ptr<Node>& node : f->get_ordered_ops())
             {
                 out << node->get_name() << "(";
@@ -58,7 +61,9 @@ bool pass::DumpSorted::run_on_module(vector<shared_ptr<Function>>& functions)
                 out << join(outputs);
                 out << "\n";
 
-                for (const descriptor::Tensor* tensor : node->liveness_live_list)
+                live.insert(
+                    live.end(), node->liveness_new_list.begin(), node->liveness_new_list.end());
+                for (const descriptor::Tensor* tensor : live)
                 {
                     out << "    L " << tensor->get_name() << "\n";
                 }
@@ -66,9 +71,10 @@ bool pass::DumpSorted::run_on_module(vector<shared_ptr<Function>>& functions)
                 {
                     out << "    N " << tensor->get_name() << "\n";
                 }
-                for (const descriptor::Tensor* tensor : node->liveness_free_list)
+                for (descriptor::Tensor* tensor : node->liveness_free_list)
                 {
                     out << "    F " << tensor->get_name() << "\n";
+                    live.erase(find(live.begin(), live.end(), tensor));
                 }
             }
             out << "=====================================================================\n";
@@ -14,8 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <exception>
 #include <sstream>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "ngraph/descriptor/input.hpp"
@@ -37,144 +39,124 @@ bool pass::Liveness::run_on_function(shared_ptr<ngraph::Function> function)
 {
     list<shared_ptr<Node>> ops = function->get_ordered_ops();
 
+    // Parameters, results and constants outlive the call and are never part of a live set
     unordered_set<descriptor::Tensor*> persistent_tensors;
-    unordered_set<descriptor::Tensor*> output_tensors;
     for (shared_ptr<op::Parameter> node : function->get_parameters())
     {
         for (size_t i = 0; i < node->get_output_size(); ++i)
         {
-            descriptor::Tensor& tensor = node->get_output_tensor(i);
-            persistent_tensors.insert(&tensor);
+            persistent_tensors.insert(&node->get_output_tensor(i));
         }
     }
     for (shared_ptr<op::Result> node : function->get_results())
     {
         for (size_t i = 0; i < node->get_output_size(); ++i)
         {
-            descriptor::Tensor& tensor = node->get_output_tensor(i);
-            persistent_tensors.insert(&tensor);
-            output_tensors.insert(&tensor);
+            persistent_tensors.insert(&node->get_output_tensor(i));
         }
     }
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+
+    // Every temporary is the output of exactly one op, so numbering outputs in order gives
+    // each tensor a dense id
+    unordered_map<descriptor::Tensor*, size_t> tensor_ids;
+    for (shared_ptr<Node> node : ops)
     {
-        if (auto constant_node = dynamic_pointer_cast<op::Constant>(node))
+        bool constant = dynamic_pointer_cast<op::Constant>(node) != nullptr;
+        for (size_t i = 0; i < node->get_output_size(); ++i)
         {
-            for (size_t i = 0; i < constant_node->get_output_size(); ++i)
+            descriptor::Tensor* tensor = &node->get_output_tensor(i);
+            if (constant)
+            {
+                persistent_tensors.insert(tensor);
+            }
+            else if (persistent_tensors.count(tensor) == 0)
             {
-                descriptor::Tensor& tensor = constant_node->get_output_tensor(i);
-                persistent_tensors.insert(&tensor);
+                tensor_ids.insert({tensor, tensor_ids.size()});
             }
         }
     }
 
-    unordered_set<descriptor::Tensor*> currently_live;
+    // Walking backwards, the first time a tensor is seen is its last use
+    vector<bool> currently_live(tensor_ids.size(), false);
     for (auto it = ops.rbegin(); it != ops.rend(); it++)
     {
         shared_ptr<Node> node = *it;
-        node->liveness_live_list.clear();
         node->liveness_new_list.clear();
         node->liveness_free_list.clear();
-        unordered_set<descriptor::Tensor*> input_tensor_decls;
         for (descriptor::Input& input_decl : node->get_inputs())
         {
-            descriptor::Tensor& tensor = input_decl.get_tensor();
-            if (!contains(persistent_tensors, &tensor))
+            auto id = tensor_ids.find(&input_decl.get_tensor());
+            if (id != tensor_ids.end() && !currently_live[id->second])
             {
-                input_tensor_decls.insert(&tensor);
+                currently_live[id->second] = true;
+                node->liveness_free_list.push_back(id->first);
             }
         }
-
-        unordered_set<descriptor::Tensor*> output_tensor_decls;
         for (size_t i = 0; i < node->get_output_size(); ++i)
         {
-            descriptor::Tensor& tensor = node->get_output_tensor(i);
-            if (!contains(persistent_tensors, &tensor))
-            {
-                output_tensor_decls.insert(&tensor);
-            }
-        }
-
-        unordered_set<descriptor::Tensor*> free_tensor_decls;
-        unordered_set<descriptor::Tensor*> new_tensor_decls;
-        unordered_set<descriptor::Tensor*> all_tensor_decls = input_tensor_decls;
-        all_tensor_decls.insert(output_tensor_decls.begin(), output_tensor_decls.end());
-
-        for (descriptor::Tensor* tensor_decl : all_tensor_decls)
-        {
-            if (!contains(currently_live, tensor_decl))
+            auto id = tensor_ids.find(&node->get_output_tensor(i));
+            if (id == tensor_ids.end())
             {
-                // this is the last node that value is seen in
-                // delete it at the end of the op
-                currently_live.insert(tensor_decl);
-                free_tensor_decls.insert(tensor_decl);
+                continue;
             }
-        }
-
-        node->liveness_live_list = currently_live;
-        for (descriptor::Tensor* output_decl : output_tensor_decls)
-        {
-            if (contains(currently_live, output_decl))
+            if (!currently_live[id->second])
             {
-                new_tensor_decls.insert(output_decl);
-                currently_live.erase(output_decl);
+                // Never read, so it dies with the op that writes it
+                node->liveness_free_list.push_back(id->first);
             }
+            currently_live[id->second] = false;
+            node->liveness_new_list.push_back(id->first);
         }
-        node->liveness_free_list = free_tensor_decls;
-        node->liveness_new_list = new_tensor_decls;
     }
 
-    // Anything marked as output must remain live for the remainder of the graph
-    // Add outputs to live_list and remove from free_list
-    unordered_set<descriptor::Tensor*> outputs;
-    unordered_set<descriptor::Tensor*> seen;
-    for (shared_ptr<Node> node : ops)
+    // validate_liveness(ops);
+    return false;
+}
+
+vector<descriptor::Tensor*> pass::Liveness::get_live_tensors(const list<shared_ptr<Node>>& ops,
+                                                             const Node* node)
+{
+    vector<descriptor::Tensor*> live;
+    unordered_map<descriptor::Tensor*, size_t> position;
+    for (const shared_ptr<Node>& op : ops)
     {
-        for (descriptor::Tensor* tensor : node->liveness_live_list)
+        for (descriptor::Tensor* tensor : op->liveness_new_list)
         {
-            if (contains(output_tensors, tensor))
-            {
-                outputs.insert(tensor);
-            }
+            position[tensor] = live.size();
+            live.push_back(tensor);
         }
-        for (descriptor::Tensor* tensor : outputs)
+        if (op.get() == node)
         {
-            node->liveness_live_list.insert(tensor);
-            node->liveness_free_list.erase(tensor);
-
-            if (contains(node->liveness_new_list, tensor))
-            {
-                if (contains(seen, tensor))
-                {
-                    node->liveness_new_list.erase(tensor);
-                }
-                else
-                {
-                    seen.insert(tensor);
-                }
-            }
+            break;
+        }
+        for (descriptor::Tensor* tensor : op->liveness_free_list)
+        {
+            live[position.at(tensor)] = nullptr;
         }
     }
-
-    // validate_liveness(ops);
-    return false;
+    live.erase(remove(live.begin(), live.end(), nullptr), live.end());
+    return live;
 }
 
-void pass::Liveness::validate_liveness(const list<Node*>& ops)
+void pass::Liveness::validate_liveness(const list<shared_ptr<Node>>& ops)
 {
+    unordered_set<descriptor::Tensor*> created;
     unordered_set<descriptor::Tensor*> dead_tensors;
-    for (const Node* node : ops)
+    for (const shared_ptr<Node>& node : ops)
     {
-        auto active = node->liveness_live_list;
-        active.insert(node->liveness_new_list.begin(), node->liveness_new_list.end());
-        active.insert(node->liveness_free_list.begin(), node->liveness_free_list.end());
-        for (const descriptor::Tensor* tensor : active)
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            if (!created.insert(tensor).second || contains(dead_tensors, tensor))
+            {
+                throw runtime_error("Liveness: Tensor created twice or after it was freed");
+            }
+        }
+        for (descriptor::Tensor* tensor : node->liveness_free_list)
         {
-            if (contains(dead_tensors, tensor))
+            if (!contains(created, tensor) || !dead_tensors.insert(tensor).second)
             {
-                throw runtime_error("Liveness: Dead tensors intersect active tensors");
+                throw runtime_error("Liveness: Tensor freed before creation or twice");
             }
         }
-        dead_tensors.insert(node->liveness_free_list.begin(), node->liveness_free_list.end());
     }
 }
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <list>
+#include <memory>
+#include <vector>
+
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/pass/pass.hpp"
 
@@ -27,11 +31,22 @@ namespace ngraph
     }
 }
 
+/// \brief Fills in the liveness_new_list and liveness_free_list of every node
+///
+/// Tensors get dense ids and the backward walk keeps the live set as a bitset, so the pass
+/// is linear in the size of the graph. Live sets are not stored per node; they are replayed
+/// from the new and free lists when needed.
 class ngraph::pass::Liveness : public FunctionPass
 {
 public:
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+    bool is_function_local() const override { return true; }
+    /// \brief The temporary tensors live across node, in order of creation
+    ///
+    /// Replays the new and free lists of ops up to node, so it costs one walk of ops.
+    static std::vector<descriptor::Tensor*>
+        get_live_tensors(const std::list<std::shared_ptr<Node>>& ops, const Node* node);
 
 private:
-    void validate_liveness(const std::list<Node*>& ops);
+    void validate_liveness(const std::list<std::shared_ptr<Node>>& ops);
 };
@@ -15,8 +15,14 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <exception>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -27,6 +33,7 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -43,6 +50,67 @@ ngraph::pass::Manager::Manager()
     {
         m_serialize = true;
     }
+    static const auto npt = std::getenv("NGRAPH_PASS_THREADS");
+    if (npt)
+    {
+        m_function_concurrency = std::max(1, std::atoi(npt));
+    }
+    static const auto npp = std::getenv("NGRAPH_PASS_PROFILE");
+    if (npp)
+    {
+        m_profile_passes = true;
+    }
+}
+
+static string demangle(const string& name)
+{
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    string rc = (status == 0 ? demangled : name);
+    free(demangled);
+    return rc;
+}
+
+// Calls func(i) for every i < count on up to `threads` threads, the caller included. The first
+// exception thrown stops further calls and is rethrown once all threads are done.
+static void parallel_for(size_t threads, size_t count, const function<void(size_t)>& func)
+{
+    atomic<size_t> next(0);
+    exception_ptr error;
+    mutex error_mutex;
+    auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++)
+        {
+            try
+            {
+                func(i);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(error_mutex);
+                if (!error)
+                {
+                    error = current_exception();
+                }
+                next = count;
+            }
+        }
+    };
+
+    vector<thread> workers;
+    for (size_t i = 1; i < min(threads, count); i++)
+    {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (thread& t : workers)
+    {
+        t.join();
+    }
+    if (error)
+    {
+        rethrow_exception(error);
+    }
 }
 
 ngraph::pass::Manager::~Manager()
@@ -62,9 +130,20 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func)
     set<shared_ptr<Function>> tfs(begin(fs), end(fs));
     get_state().set_functions(tfs);
 
+    m_pass_times.clear();
+    m_profile.clear();
+    if (m_profile_passes)
+    {
+        m_profile.set_initial_graph_size(CompileProfile::measure(fs));
+    }
     size_t index = 0;
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        stopwatch pass_timer;
+        pass_timer.start();
+        // Functions are disjoint graphs, so a pass that touches nothing else can run on all of
+        // them at once
+        size_t threads = pass->is_function_local() ? m_function_concurrency : 1;
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
         auto function_pass = dynamic_pointer_cast<FunctionPass>(pass);
@@ -76,10 +155,9 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func)
         }
         else if (function_pass)
         {
-            for (shared_ptr<Function> f : fs)
-            {
-                function_pass->run_on_function(f);
-            }
+            parallel_for(threads, fs.size(), [&](size_t i) {
+                function_pass->run_on_function(fs[i]);
+            });
         }
         else if (node_pass)
         {
@@ -93,10 +171,24 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func)
         }
         else if (call_graph_pass)
         {
-            for (shared_ptr<Function> f : fs)
-            {
-                call_graph_pass->run_on_call_graph(f->get_ordered_ops());
-            }
+            parallel_for(threads, fs.size(), [&](size_t i) {
+                call_graph_pass->run_on_call_graph(fs[i]->get_ordered_ops());
+            });
+        }
+        pass_timer.stop();
+        m_pass_times.push_back(pass_timer.get_microseconds());
+        if (m_profile_passes)
+        {
+            // Lowering passes can drop nested functions, so look them up again
+            vector<shared_ptr<Function>> current;
+            traverse_functions(func, [&](shared_ptr<Function> f) { current.push_back(f); });
+            m_profile.add_phase(demangle(m_pass_names.at(index)),
+                                m_pass_times.back(),
+                                CompileProfile::measure(current));
+        }
+        else
+        {
+            m_profile.add_phase(demangle(m_pass_names.at(index)), m_pass_times.back());
         }
 
         if (m_visualize || m_serialize)
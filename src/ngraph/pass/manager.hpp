@@ -21,6 +21,7 @@
 #include <typeinfo>
 #include <vector>
 
+#include "ngraph/pass/compile_profile.hpp"
 #include "ngraph/pass/manager_state.hpp"
 #include "ngraph/pass/pass.hpp"
 
@@ -48,10 +49,7 @@ public:
         auto pass = std::make_shared<T>(std::forward<Args>(args)...);
         auto pass_base = std::static_pointer_cast<PassBase>(pass);
         m_pass_list.push_back(pass_base);
-        if (m_visualize || m_serialize)
-        {
-            m_pass_names.push_back(typeid(T).name());
-        }
+        m_pass_names.push_back(typeid(T).name());
     }
 
     void run_passes(std::shared_ptr<Function>);
@@ -59,10 +57,29 @@ public:
     ManagerState& get_state();
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
+    /// \brief Runs function-local passes on up to `threads` functions at once. The default of
+    ///        1, or NGRAPH_PASS_THREADS when set, keeps every pass serial.
+    void set_function_concurrency(size_t threads) { m_function_concurrency = threads; }
+    size_t get_function_concurrency() const { return m_function_concurrency; }
+    /// \return The registered pass names, in registration order.
+    const std::vector<std::string>& get_pass_names() const { return m_pass_names; }
+    /// \return The wall time in microseconds each pass took in the last run_passes, in
+    ///         registration order.
+    const std::vector<size_t>& get_pass_times() const { return m_pass_times; }
+    /// \brief Also records the module size and peak RSS after each pass. Defaults to on when
+    ///        NGRAPH_PASS_PROFILE is set.
+    void set_pass_profiling(bool new_state) { m_profile_passes = new_state; }
+    /// \return One phase per pass of the last run_passes. Graph sizes are only filled in when
+    ///         profiling is on.
+    const CompileProfile& get_profile() const { return m_profile; }
 private:
     std::vector<std::string> m_pass_names;
+    std::vector<size_t> m_pass_times;
+    CompileProfile m_profile;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     ManagerState m_state;
     bool m_visualize = false;
     bool m_serialize = false;
+    size_t m_function_concurrency = 1;
+    bool m_profile_passes = false;
 };
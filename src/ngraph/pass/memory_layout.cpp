@@ -50,8 +50,8 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
                     auto output = &node->get_outputs().at(oi_pair.first).get_tensor();
                     auto input = &node->get_inputs().at(oi_pair.second).get_tensor();
 
-                    if (node->liveness_free_list.count(input) != 0 &&
-                        node->liveness_new_list.count(output) != 0)
+                    if (contains(node->liveness_free_list, input) &&
+                        contains(node->liveness_new_list, output))
                     {
                         NGRAPH_DEBUG << input->get_name() << " will be reused for "
                                      << output->get_name();
@@ -37,6 +37,7 @@ class ngraph::pass::MemoryLayout : public FunctionPass
 public:
     MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+    bool is_function_local() const override { return true; }
 
 private:
     size_t m_alignment;
@@ -24,6 +24,7 @@
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/pass/liveness.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -66,7 +67,7 @@ bool pass::MemoryVisualize::run_on_module(vector<shared_ptr<ngraph::Function>>&
             size_t temp_max_size = 0;
             for (shared_ptr<Node> node : nodes)
             {
-                tensors.insert(node->liveness_live_list.begin(), node->liveness_live_list.end());
+                tensors.insert(node->liveness_new_list.begin(), node->liveness_new_list.end());
             }
             for (descriptor::Tensor* tensor : tensors)
             {
@@ -99,10 +100,10 @@ shared_ptr<Node> pass::MemoryVisualize::find_largest_op(const list<shared_ptr<No
 {
     shared_ptr<Node> largest_op = nullptr;
     size_t largest_size = 0;
+    size_t size = 0;
     for (shared_ptr<Node> exop : nodes)
     {
-        size_t size = 0;
-        for (const descriptor::Tensor* tensor : exop->liveness_live_list)
+        for (const descriptor::Tensor* tensor : exop->liveness_new_list)
         {
             size += tensor->size();
         }
@@ -111,6 +112,10 @@ shared_ptr<Node> pass::MemoryVisualize::find_largest_op(const list<shared_ptr<No
             largest_size = size;
             largest_op = exop;
         }
+        for (const descriptor::Tensor* tensor : exop->liveness_free_list)
+        {
+            size -= tensor->size();
+        }
     }
     return largest_op;
 }
@@ -122,7 +127,7 @@ void pass::MemoryVisualize::draw_tensor_weight(ostream& file, const list<shared_
     if (largest_op)
     {
         unordered_set<descriptor::Tensor*> largest_live;
-        for (descriptor::Tensor* tensor : largest_op->liveness_live_list)
+        for (descriptor::Tensor* tensor : pass::Liveness::get_live_tensors(nodes, largest_op.get()))
         {
             largest_live.insert(tensor);
         }
@@ -26,6 +26,7 @@ namespace ngraph
         {
         public:
             bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+            bool is_function_local() const override { return true; }
         };
     }
 }
@@ -43,6 +43,9 @@ class ngraph::pass::PassBase
 
 public:
     virtual ~PassBase() {}
+    /// \brief True if the pass only reads and writes the function it is given and keeps no
+    ///        state between calls, so the manager may run it on several functions at once.
+    virtual bool is_function_local() const { return false; }
 protected:
     ManagerState& get_state();
     void set_state(ManagerState&);
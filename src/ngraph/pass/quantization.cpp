@@ -0,0 +1,218 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/quantized_dot.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/pass/quantization.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    class QuantizationParameters
+    {
+    public:
+        element::Type m_type;
+        double m_scale;
+    };
+}
+
+static QuantizationParameters choose_parameters(const runtime::TensorRange& range)
+{
+    if (range.m_min >= 0)
+    {
+        return {element::u8, range.m_max > 0 ? range.m_max / 255.0 : 1.0};
+    }
+    double limit = max(-static_cast<double>(range.m_min), static_cast<double>(range.m_max));
+    return {element::i8, limit > 0 ? limit / 127.0 : 1.0};
+}
+
+// Symmetric per-tensor i8 quantization of f32 weights, returns the scale
+static shared_ptr<Node> quantize_weights(const shared_ptr<op::Constant>& weights, double& scale)
+{
+    vector<float> values = weights->get_vector<float>();
+    double limit = 0;
+    for (float value : values)
+    {
+        limit = max(limit, fabs(static_cast<double>(value)));
+    }
+    scale = limit > 0 ? limit / 127.0 : 1.0;
+
+    vector<int8_t> quantized(values.size());
+    runtime::reference::quantize<float, int8_t>(
+        values.data(), quantized.data(), values.size(), scale, 0);
+    return make_shared<op::Constant>(element::i8, weights->get_shape(), quantized);
+}
+
+static bool fold_requantization(const shared_ptr<op::Quantize>& quantize)
+{
+    shared_ptr<Node> producer = quantize->get_argument(0);
+    if (producer->get_users().size() != 1)
+    {
+        return false;
+    }
+    if (dynamic_pointer_cast<op::Relu>(producer))
+    {
+        // Saturating to u8 around zero point 0 already clamps at zero
+        if (quantize->get_element_type() != element::u8 || quantize->get_zero_point() != 0)
+        {
+            return false;
+        }
+        producer = producer->get_argument(0);
+        if (producer->get_users().size() != 1)
+        {
+            return false;
+        }
+    }
+    if (producer->get_element_type() != element::f32 ||
+        quantize->get_element_type() == element::i32)
+    {
+        return false;
+    }
+
+    shared_ptr<Node> replacement;
+    if (auto qdot = dynamic_pointer_cast<op::QuantizedDot>(producer))
+    {
+        replacement = make_shared<op::QuantizedDot>(qdot->get_argument(0),
+                                                    qdot->get_argument(1),
+                                                    quantize->get_element_type(),
+                                                    qdot->get_input_scale(),
+                                                    qdot->get_input_zero_point(),
+                                                    qdot->get_weights_scale(),
+                                                    quantize->get_scale(),
+                                                    quantize->get_zero_point());
+    }
+    else if (auto qconv = dynamic_pointer_cast<op::QuantizedConvolution>(producer))
+    {
+        replacement =
+            make_shared<op::QuantizedConvolution>(qconv->get_argument(0),
+                                                  qconv->get_argument(1),
+                                                  qconv->get_window_movement_strides(),
+                                                  qconv->get_window_dilation_strides(),
+                                                  qconv->get_padding_below(),
+                                                  qconv->get_padding_above(),
+                                                  qconv->get_data_dilation_strides(),
+                                                  quantize->get_element_type(),
+                                                  qconv->get_input_scale(),
+                                                  qconv->get_input_zero_point(),
+                                                  qconv->get_filters_scale(),
+                                                  quantize->get_scale(),
+                                                  quantize->get_zero_point());
+    }
+    else
+    {
+        return false;
+    }
+    replace_node(quantize, replacement);
+    return true;
+}
+
+bool pass::Quantization::run_on_function(shared_ptr<Function> f)
+{
+    bool modified = false;
+    // Keyed on the f32 tensor being quantized
+    unordered_map<Node*, shared_ptr<op::Quantize>> quantized_inputs;
+
+    auto quantize_input = [&](const shared_ptr<Node>& input) -> shared_ptr<op::Quantize> {
+        auto it = quantized_inputs.find(input.get());
+        if (it != quantized_inputs.end())
+        {
+            return it->second;
+        }
+        QuantizationParameters parameters = choose_parameters(m_ranges.at(input.get()));
+        auto quantize = make_shared<op::Quantize>(input, parameters.m_type, parameters.m_scale);
+        quantized_inputs.insert({input.get(), quantize});
+        return quantize;
+    };
+
+    for (shared_ptr<Node> n : f->get_ordered_ops())
+    {
+        if (n->get_outputs().size() != 1 || n->get_element_type() != element::f32)
+        {
+            continue;
+        }
+        auto dot = dynamic_pointer_cast<op::Dot>(n);
+        auto conv = dynamic_pointer_cast<op::Convolution>(n);
+        if ((!dot || dot->get_reduction_axes_count() != 1) && !conv)
+        {
+            continue;
+        }
+        shared_ptr<Node> input = n->get_argument(0);
+        auto weights = dynamic_pointer_cast<op::Constant>(n->get_argument(1));
+        if (!weights || input->get_shape().empty() || m_ranges.count(input.get()) == 0)
+        {
+            continue;
+        }
+
+        shared_ptr<op::Quantize> quantized_input = quantize_input(input);
+        double weights_scale;
+        shared_ptr<Node> quantized_weights = quantize_weights(weights, weights_scale);
+
+        shared_ptr<Node> replacement;
+        if (dot)
+        {
+            replacement = make_shared<op::QuantizedDot>(quantized_input,
+                                                        quantized_weights,
+                                                        element::f32,
+                                                        quantized_input->get_scale(),
+                                                        quantized_input->get_zero_point(),
+                                                        weights_scale);
+        }
+        else
+        {
+            replacement =
+                make_shared<op::QuantizedConvolution>(quantized_input,
+                                                      quantized_weights,
+                                                      conv->get_window_movement_strides(),
+                                                      conv->get_window_dilation_strides(),
+                                                      conv->get_padding_below(),
+                                                      conv->get_padding_above(),
+                                                      conv->get_data_dilation_strides(),
+                                                      element::f32,
+                                                      quantized_input->get_scale(),
+                                                      quantized_input->get_zero_point(),
+                                                      weights_scale);
+        }
+        replace_node(n, replacement);
+        // Consumers now see the replacement, which computes the same tensor
+        auto range = m_ranges.find(n.get());
+        if (range != m_ranges.end())
+        {
+            m_ranges.insert({replacement.get(), range->second});
+        }
+        modified = true;
+    }
+
+    for (auto& entry : quantized_inputs)
+    {
+        if (fold_requantization(entry.second))
+        {
+            modified = true;
+        }
+    }
+    return modified;
+}
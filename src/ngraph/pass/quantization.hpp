@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/calibration.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class Quantization;
+    }
+}
+
+/// @brief Post-training int8 quantization of Dot and Convolution ops with constant weights.
+///
+/// An f32 Dot contracting one axis or an f32 Convolution is rewritten when its second argument
+/// is a Constant and a range was calibrated for its first argument. The weights are quantized
+/// to symmetric i8 at compile time. The input is quantized to u8 when its range is non-negative
+/// and to symmetric i8 otherwise, with one Quantize shared by every consumer of that tensor.
+/// The quantized op produces f32 directly, so the rest of the graph is untouched.
+///
+/// A Quantize that is the only consumer of a quantized op, possibly through a Relu when the
+/// Quantize is to u8 with zero point 0, is then folded into that op, which keeps the chain
+/// between consecutive quantized layers in int8.
+class ngraph::pass::Quantization : public FunctionPass
+{
+public:
+    /// @param ranges Calibrated ranges keyed on the nodes of the Function this pass runs on,
+    ///               as returned by runtime::calibrate.
+    Quantization(const runtime::TensorRanges& ranges)
+        : FunctionPass()
+        , m_ranges(ranges)
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+
+private:
+    runtime::TensorRanges m_ranges;
+};
@@ -35,4 +35,5 @@ public:
     }
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+    bool is_function_local() const override { return true; }
 };
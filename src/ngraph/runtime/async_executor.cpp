@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/async_executor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::AsyncExecutor::AsyncExecutor()
+    : m_active_tasks(0)
+    , m_stop(false)
+    , m_thread(&AsyncExecutor::worker, this)
+{
+}
+
+runtime::AsyncExecutor::~AsyncExecutor()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_task_available.notify_all();
+    m_thread.join();
+}
+
+future<bool> runtime::AsyncExecutor::submit(function<bool()> task)
+{
+    packaged_task<bool()> packaged(move(task));
+    future<bool> result = packaged.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_queue.push_back(move(packaged));
+    }
+    m_task_available.notify_one();
+    return result;
+}
+
+void runtime::AsyncExecutor::wait_all()
+{
+    unique_lock<mutex> lock(m_mutex);
+    m_queue_empty.wait(lock, [this]() { return m_queue.empty() && m_active_tasks == 0; });
+}
+
+void runtime::AsyncExecutor::worker()
+{
+    while (true)
+    {
+        packaged_task<bool()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_task_available.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty())
+            {
+                // m_stop is set and all queued work has drained
+                return;
+            }
+            task = move(m_queue.front());
+            m_queue.pop_front();
+            m_active_tasks++;
+        }
+
+        // packaged_task captures any exception in the associated future
+        task();
+
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_active_tasks--;
+            if (m_queue.empty() && m_active_tasks == 0)
+            {
+                m_queue_empty.notify_all();
+            }
+        }
+    }
+}
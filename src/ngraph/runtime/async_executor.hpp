@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class AsyncExecutor;
+    }
+}
+
+/// @brief A single worker thread that runs submitted tasks one at a time in submission order.
+///
+/// Backends use this to run asynchronous calls. Because tasks never overlap each other the
+/// backend's per-Function state (call frames, temporary pools, mkldnn primitives) needs no
+/// additional locking; the overlap comes from the submitting thread being free to prepare
+/// the next request while the current one executes.
+class ngraph::runtime::AsyncExecutor
+{
+public:
+    AsyncExecutor();
+    ~AsyncExecutor();
+
+    AsyncExecutor(const AsyncExecutor&) = delete;
+    AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+    /// @brief Queue a task for execution.
+    /// @returns A future that becomes ready when the task has run. Exceptions thrown by the
+    ///   task are rethrown from future::get().
+    std::future<bool> submit(std::function<bool()> task);
+
+    /// @brief Block until every task submitted so far has completed.
+    void wait_all();
+
+private:
+    void worker();
+
+    std::mutex m_mutex;
+    std::condition_variable m_task_available;
+    std::condition_variable m_queue_empty;
+    std::deque<std::packaged_task<bool()>> m_queue;
+    size_t m_active_tasks;
+    bool m_stop;
+    std::thread m_thread;
+};
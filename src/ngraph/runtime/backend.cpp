@@ -18,6 +18,7 @@
 #include <sstream>
 
 #include "ngraph/file_util.hpp"
+#include "ngraph/runtime/async_executor.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/util.hpp"
@@ -39,6 +40,10 @@ unordered_map<string, shared_ptr<runtime::Backend>>& runtime::Backend::get_backe
     return backend_map;
 }
 
+runtime::Backend::Backend()
+{
+}
+
 runtime::Backend::~Backend()
 {
 }
@@ -134,12 +139,49 @@ void runtime::Backend::remove_compiled_function(shared_ptr<Function> func)
 {
 }
 
+runtime::AsyncExecutor& runtime::Backend::get_async_executor()
+{
+    lock_guard<mutex> lock(m_async_executor_mutex);
+    if (m_async_executor == nullptr)
+    {
+        m_async_executor.reset(new AsyncExecutor());
+    }
+    return *m_async_executor;
+}
+
+future<bool> runtime::Backend::async_call(shared_ptr<Function> func,
+                                          const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                          const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    // The lambda holds copies of the tensor vectors so the tensors outlive the call
+    return get_async_executor().submit(
+        [this, func, outputs, inputs]() { return call(func, outputs, inputs); });
+}
+
+void runtime::Backend::wait_for_async_calls()
+{
+    AsyncExecutor* executor = nullptr;
+    {
+        lock_guard<mutex> lock(m_async_executor_mutex);
+        executor = m_async_executor.get();
+    }
+    if (executor != nullptr)
+    {
+        executor->wait_all();
+    }
+}
+
 vector<ngraph::runtime::PerformanceCounter>
     runtime::Backend::get_performance_data(shared_ptr<Function> func) const
 {
     return vector<PerformanceCounter>();
 }
 
+runtime::MemoryUsage runtime::Backend::get_memory_usage(shared_ptr<Function> func) const
+{
+    return MemoryUsage();
+}
+
 void runtime::Backend::validate_call(shared_ptr<const Function> function,
                                      const vector<shared_ptr<runtime::TensorView>>& outputs,
                                      const vector<shared_ptr<runtime::TensorView>>& inputs)
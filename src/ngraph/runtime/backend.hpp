@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/memory_usage.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -27,6 +30,7 @@ namespace ngraph
 {
     namespace runtime
     {
+        class AsyncExecutor;
         class ExternalFunction;
         class TensorView;
 
@@ -36,6 +40,7 @@ namespace ngraph
         class Backend
         {
         public:
+            Backend();
             virtual ~Backend();
             /// @brief Create a new Backend object
             /// @param type The name of a registered backend, such as "CPU" or "GPU".
@@ -69,12 +74,40 @@ namespace ngraph
                               const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                               const std::vector<std::shared_ptr<runtime::TensorView>>& inputs) = 0;
 
+            /// @brief Queue an execution of func and return without waiting for it to finish.
+            ///
+            /// Asynchronous calls run one at a time, in submission order, on a worker thread
+            /// owned by this backend, so the caller can stage the inputs of the next request
+            /// while the current one executes. The backend keeps a reference to every tensor
+            /// in outputs and inputs until the call completes, but the caller must not write
+            /// to the input tensors or read from the output tensors until the returned future
+            /// is ready.
+            ///
+            /// The CPU and INTERPRETER backends lock their table of compiled Functions for the
+            /// whole of call(), compile() and remove_compiled_function(), so these may be
+            /// issued from other threads while asynchronous calls are pending. They wait for
+            /// the call the worker is running.
+            /// @returns A future holding the result of call(). Errors raised during validation
+            ///   or execution are rethrown from future::get().
+            virtual std::future<bool>
+                async_call(std::shared_ptr<Function> func,
+                           const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
+
+            /// @brief Block until all calls queued with async_call have completed.
+            void wait_for_async_calls();
+
             virtual void remove_compiled_function(std::shared_ptr<Function> func);
 
             virtual void enable_performance_data(std::shared_ptr<Function> func, bool enable) {}
             virtual std::vector<PerformanceCounter>
                 get_performance_data(std::shared_ptr<Function> func) const;
 
+            /// @brief Memory held for func once it is compiled, for capacity planning.
+            /// @returns All zero if func is not compiled or the backend does not account for
+            ///   its memory.
+            virtual MemoryUsage get_memory_usage(std::shared_ptr<Function> func) const;
+
             static bool register_backend(const std::string& name, std::shared_ptr<Backend>);
 
         protected:
@@ -82,7 +115,12 @@ namespace ngraph
                                const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                                const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
 
+            AsyncExecutor& get_async_executor();
+
         private:
+            std::mutex m_async_executor_mutex;
+            std::unique_ptr<AsyncExecutor> m_async_executor;
+
             static void* open_shared_library(std::string type);
             static std::unordered_map<std::string, std::shared_ptr<Backend>>& get_backend_map();
             static std::unordered_map<std::string, void*> s_open_backends;
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/calibration.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::TensorRanges
+    runtime::calibrate(const shared_ptr<Backend>& backend,
+                       const shared_ptr<Function>& function,
+                       const vector<vector<shared_ptr<TensorView>>>& samples)
+{
+    NodeMap node_map;
+    shared_ptr<Function> clone = clone_function(*function, node_map);
+
+    NodeVector observed;
+    NodeVector probes;
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        if (node->get_outputs().size() != 1 || node->get_element_type() != element::f32 ||
+            node->is_constant() || dynamic_pointer_cast<op::Result>(node))
+        {
+            continue;
+        }
+        observed.push_back(node);
+        probes.push_back(node_map.get(node));
+    }
+
+    TensorRanges ranges;
+    if (observed.empty())
+    {
+        return ranges;
+    }
+
+    auto probe = make_shared<Function>(probes, clone->get_parameters());
+    vector<shared_ptr<TensorView>> outputs;
+    for (const shared_ptr<Node>& node : probes)
+    {
+        outputs.push_back(backend->create_tensor(element::f32, node->get_shape()));
+    }
+
+    vector<float> values;
+    for (const vector<shared_ptr<TensorView>>& inputs : samples)
+    {
+        if (!backend->call(probe, outputs, inputs))
+        {
+            throw ngraph_error("Calibration call failed");
+        }
+        for (size_t i = 0; i < observed.size(); i++)
+        {
+            size_t count = shape_size(observed[i]->get_shape());
+            if (count == 0)
+            {
+                continue;
+            }
+            values.resize(count);
+            outputs[i]->read(values.data(), 0, count * sizeof(float));
+            auto minmax = minmax_element(values.begin(), values.end());
+
+            auto it = ranges.find(observed[i].get());
+            if (it == ranges.end())
+            {
+                ranges.insert({observed[i].get(), TensorRange{*minmax.first, *minmax.second}});
+            }
+            else
+            {
+                it->second.m_min = min(it->second.m_min, *minmax.first);
+                it->second.m_max = max(it->second.m_max, *minmax.second);
+            }
+        }
+    }
+    backend->remove_compiled_function(probe);
+    return ranges;
+}
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+
+        /// @brief Observed real range of a tensor.
+        class TensorRange
+        {
+        public:
+            float m_min;
+            float m_max;
+        };
+
+        using TensorRanges = std::unordered_map<const Node*, TensorRange>;
+
+        /// @brief Runs a Function over a set of representative inputs and records the min and
+        ///        max of every f32 tensor computed along the way.
+        ///
+        /// The Function is cloned and every single-output f32 op other than a Constant is made
+        /// an output of the clone, which is then called once per sample on backend. The returned
+        /// ranges are keyed on the nodes of function, so they can be handed straight to
+        /// pass::Quantization. Keys are raw pointers so the ranges do not keep nodes alive;
+        /// they are only meaningful while function is. function itself is not modified.
+        ///
+        /// @param samples One set of input tensors per sample, in Parameter order.
+        TensorRanges
+            calibrate(const std::shared_ptr<Backend>& backend,
+                      const std::shared_ptr<Function>& function,
+                      const std::vector<std::vector<std::shared_ptr<TensorView>>>& samples);
+    }
+}
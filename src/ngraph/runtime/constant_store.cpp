@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "ngraph/runtime/constant_store.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Every element type and vector load is satisfied by cache line alignment
+static const size_t s_buffer_alignment = 64;
+
+// FNV-1a over 64 bit words; the tail bytes go in one at a time
+static size_t content_hash(const void* data, size_t size)
+{
+    const uint64_t prime = 1099511628211ULL;
+    uint64_t hash = 14695981039346656037ULL ^ size;
+    const char* bytes = static_cast<const char*>(data);
+    size_t words = size / sizeof(uint64_t);
+    for (size_t i = 0; i < words; i++)
+    {
+        uint64_t word;
+        memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (size_t i = words * sizeof(uint64_t); i < size; i++)
+    {
+        hash = (hash ^ static_cast<unsigned char>(bytes[i])) * prime;
+    }
+    return static_cast<size_t>(hash);
+}
+
+runtime::ConstantStore& runtime::ConstantStore::get()
+{
+    // Never destroyed, so buffers released during static destruction still find it
+    static ConstantStore* store = new ConstantStore();
+    return *store;
+}
+
+shared_ptr<const void> runtime::ConstantStore::intern(const void* data, size_t size)
+{
+    size_t hash = content_hash(data, size);
+    // Declared before the lock so they are destroyed after it is released: dropping the last
+    // handle to a buffer calls release(), which takes the lock
+    vector<shared_ptr<const void>> candidates;
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.size == size)
+        {
+            shared_ptr<const void> buffer = it->second.buffer.lock();
+            if (buffer && memcmp(buffer.get(), data, size) == 0)
+            {
+                return register_handle(hash, it->second, buffer);
+            }
+            candidates.push_back(buffer);
+        }
+    }
+
+    void* copy = ngraph::aligned_alloc(s_buffer_alignment,
+                                       round_up(max<size_t>(size, 1), s_buffer_alignment));
+    memcpy(copy, data, size);
+    shared_ptr<const void> buffer(copy, [this, hash](const void* released) {
+        release(hash, released);
+        ngraph::aligned_free(const_cast<void*>(released));
+    });
+    auto it = m_entries.emplace(hash, Entry{size, copy, 0, buffer});
+    return register_handle(hash, it->second, buffer);
+}
+
+// Each intern() call gets a handle of its own, so the report counts the Constants sharing a
+// buffer rather than the copies of their handles. Called with m_mutex held.
+shared_ptr<const void> runtime::ConstantStore::register_handle(size_t hash,
+                                                               Entry& entry,
+                                                               shared_ptr<const void> buffer)
+{
+    entry.registrations++;
+    return shared_ptr<const void>(buffer.get(), [this, hash, buffer](const void* data) mutable {
+        unregister_handle(hash, data);
+        // Outside the lock, as dropping the last handle calls release()
+        buffer.reset();
+    });
+}
+
+void runtime::ConstantStore::unregister_handle(size_t hash, const void* buffer)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.address == buffer)
+        {
+            it->second.registrations--;
+            break;
+        }
+    }
+}
+
+void runtime::ConstantStore::release(size_t hash, const void* buffer)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.address == buffer)
+        {
+            m_entries.erase(it);
+            break;
+        }
+    }
+}
+
+runtime::ConstantStore::Report runtime::ConstantStore::get_report() const
+{
+    Report report;
+    lock_guard<mutex> lock(m_mutex);
+    for (auto& entry : m_entries)
+    {
+        size_t references = entry.second.registrations;
+        if (references > 0)
+        {
+            report.buffers++;
+            report.bytes += entry.second.size;
+            report.references += references;
+            report.referenced_bytes += references * entry.second.size;
+        }
+    }
+    return report;
+}
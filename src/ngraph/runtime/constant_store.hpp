@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// @brief Process wide store of constant data, addressed by content.
+        ///
+        /// Constants with the same bytes intern to one buffer, whichever Function or backend
+        /// they belong to, so variants of a model compiled for several batch sizes, or its
+        /// forward and backward Functions, hold their weights once. A buffer lives as long as
+        /// a handle to it does and leaves the store with the last one.
+        class ConstantStore
+        {
+        public:
+            struct Report
+            {
+                /// Distinct buffers held and their total size
+                size_t buffers = 0;
+                size_t bytes = 0;
+                /// intern() calls whose handles are still held, and the bytes they would take
+                /// if each had its own copy. Copies of a handle do not count again.
+                size_t references = 0;
+                size_t referenced_bytes = 0;
+            };
+
+            static ConstantStore& get();
+
+            /// @brief A buffer with the same size and bytes as data. It is copied into the
+            ///        store unless an identical buffer is already there. The buffer must not
+            ///        be written to.
+            std::shared_ptr<const void> intern(const void* data, size_t size);
+
+            Report get_report() const;
+
+        private:
+            ConstantStore() = default;
+
+            struct Entry
+            {
+                size_t size;
+                // Identifies the entry once the buffer has expired
+                const void* address;
+                // Handles returned by intern() that are still held
+                size_t registrations;
+                std::weak_ptr<const void> buffer;
+            };
+
+            std::shared_ptr<const void>
+                register_handle(size_t hash, Entry& entry, std::shared_ptr<const void> buffer);
+            void unregister_handle(size_t hash, const void* buffer);
+            void release(size_t hash, const void* buffer);
+
+            mutable std::mutex m_mutex;
+            std::unordered_multimap<size_t, Entry> m_entries;
+        };
+    }
+}
@@ -33,6 +33,12 @@ extern "C" void create_backend()
     runtime::Backend::register_backend("CPU", make_shared<runtime::cpu::CPU_Backend>());
 };
 
+runtime::cpu::CPU_Backend::~CPU_Backend()
+{
+    // Pending asynchronous calls reference m_function_map
+    wait_for_async_calls();
+}
+
 shared_ptr<runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Backend::make_call_frame(
     const shared_ptr<runtime::cpu::CPU_ExternalFunction>& external_function)
 {
@@ -53,12 +59,18 @@ shared_ptr<runtime::TensorView> runtime::cpu::CPU_Backend::create_tensor(
 
 bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
 {
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     if (instance.m_external_function == nullptr)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
         instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
-        auto cf = instance.m_external_function->make_call_frame();
+        if (instance.m_fast_math_enabled)
+        {
+            instance.m_external_function->set_fast_math(true);
+        }
+        auto cf = instance.m_external_function->make_call_frame(instance.m_numa_placement,
+                                                                instance.m_page_policy);
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
     }
     return true;
@@ -72,6 +84,7 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
 
     validate_call(func, outputs, inputs);
 
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     if (instance.m_external_function == nullptr)
     {
@@ -85,11 +98,13 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
 
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
     m_function_map.erase(func);
 }
 
 void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> func, bool enable)
 {
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     if (instance.m_external_function != nullptr)
     {
@@ -98,10 +113,60 @@ void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> fun
     instance.m_performance_counters_enabled = enable;
 }
 
+void runtime::cpu::CPU_Backend::enable_fast_math(shared_ptr<Function> func, bool enable)
+{
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
+    FunctionInstance& instance = m_function_map[func];
+    if (instance.m_external_function != nullptr)
+    {
+        throw runtime_error("Fast math must be enabled prior to compiling.");
+    }
+    instance.m_fast_math_enabled = enable;
+}
+
+void runtime::cpu::CPU_Backend::set_numa_placement(shared_ptr<Function> func,
+                                                   const NumaPlacement& placement)
+{
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
+    FunctionInstance& instance = m_function_map[func];
+    instance.m_numa_placement = placement;
+    if (instance.m_external_function != nullptr)
+    {
+        // Reallocates the temporaries and constants on the new node
+        instance.m_call_frame = nullptr;
+        instance.m_call_frame =
+            instance.m_external_function->make_call_frame(placement, instance.m_page_policy);
+    }
+}
+
+void runtime::cpu::CPU_Backend::set_page_policy(shared_ptr<Function> func, const PagePolicy& pages)
+{
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
+    FunctionInstance& instance = m_function_map[func];
+    instance.m_page_policy = pages;
+    if (instance.m_external_function != nullptr)
+    {
+        instance.m_call_frame = nullptr;
+        instance.m_call_frame =
+            instance.m_external_function->make_call_frame(instance.m_numa_placement, pages);
+    }
+}
+
+void runtime::cpu::CPU_Backend::set_threading_config(const ThreadingConfig& config)
+{
+    runtime::cpu::set_threading_config(config);
+}
+
+runtime::cpu::ThreadingConfig runtime::cpu::CPU_Backend::get_threading_config() const
+{
+    return runtime::cpu::get_threading_config();
+}
+
 vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
     auto it = m_function_map.find(func);
     if (it != m_function_map.end())
     {
@@ -131,3 +196,32 @@ vector<runtime::PerformanceCounter>
     }
     return rc;
 }
+
+runtime::MemoryUsage runtime::cpu::CPU_Backend::get_memory_usage(shared_ptr<Function> func) const
+{
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
+    MemoryUsage usage;
+    auto it = m_function_map.find(func);
+    if (it == m_function_map.end() || it->second.m_external_function == nullptr)
+    {
+        return usage;
+    }
+    const FunctionInstance& instance = it->second;
+    const auto& external_function = instance.m_external_function;
+    for (size_t size : external_function->get_memory_buffer_sizes())
+    {
+        usage.temporaries += size;
+    }
+    usage.workspaces = external_function->get_mkldnn_emitter()->get_workspace_bytes();
+    usage.constants = external_function->get_constant_bytes();
+    if (external_function->m_execution_engine)
+    {
+        usage.code = external_function->m_execution_engine->get_code_size();
+    }
+    if (instance.m_call_frame)
+    {
+        usage.constants += instance.m_call_frame->get_constant_replica_size();
+        usage.call_frames = instance.m_call_frame->get_context_size();
+    }
+    return usage;
+}
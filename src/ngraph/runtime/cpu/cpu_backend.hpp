@@ -18,8 +18,11 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/cpu/cpu_threading.hpp"
 
 namespace ngraph
 {
@@ -33,6 +36,8 @@ namespace ngraph
             class CPU_Backend : public runtime::Backend
             {
             public:
+                ~CPU_Backend() override;
+
                 std::shared_ptr<CPU_CallFrame>
                     make_call_frame(const std::shared_ptr<CPU_ExternalFunction>& external_function);
 
@@ -55,6 +60,25 @@ namespace ngraph
                 void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
                 std::vector<PerformanceCounter>
                     get_performance_data(std::shared_ptr<Function> func) const override;
+                /// Code is 0 for functions run by direct execution, whose kernels are part of
+                /// this library
+                MemoryUsage get_memory_usage(std::shared_ptr<Function> func) const override;
+                /// Compile func with the approximate f32 transcendentals. Must be called before
+                /// func is compiled.
+                void enable_fast_math(std::shared_ptr<Function> func, bool enable);
+
+                /// Threading is process wide, so this affects every CPU backend; see
+                /// cpu_threading.hpp. No call may be in flight while it changes.
+                void set_threading_config(const ThreadingConfig& config);
+                ThreadingConfig get_threading_config() const;
+                /// Binds the call frame of func to a NUMA node; see cpu_numa.hpp. Takes effect
+                /// at once if func is compiled, so no call of func may be in flight.
+                void set_numa_placement(std::shared_ptr<Function> func,
+                                        const NumaPlacement& placement);
+                /// Backs the temporary pools and the constants of func with huge pages and
+                /// optionally faults them in when the call frame is built. Takes effect like
+                /// set_numa_placement.
+                void set_page_policy(std::shared_ptr<Function> func, const PagePolicy& pages);
 
             private:
                 class FunctionInstance
@@ -63,8 +87,15 @@ namespace ngraph
                     std::shared_ptr<CPU_ExternalFunction> m_external_function;
                     std::shared_ptr<CPU_CallFrame> m_call_frame;
                     bool m_performance_counters_enabled = false;
+                    bool m_fast_math_enabled = false;
+                    NumaPlacement m_numa_placement;
+                    PagePolicy m_page_policy;
                 };
 
+                // Held for the whole of each method that uses m_function_map, call() included,
+                // so synchronous calls from any thread and the asynchronous worker are
+                // serialized and never share a call frame. Recursive because call() compiles.
+                mutable std::recursive_mutex m_function_map_mutex;
                 std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
             };
         }
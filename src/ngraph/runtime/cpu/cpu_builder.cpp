@@ -95,20 +95,32 @@
 #include "ngraph/runtime/cpu/kernel/abs.hpp"
 #include "ngraph/runtime/cpu/kernel/add.hpp"
 #include "ngraph/runtime/cpu/kernel/ceil.hpp"
+#include "ngraph/runtime/cpu/kernel/convert.hpp"
+#include "ngraph/runtime/cpu/kernel/dot.hpp"
+#include "ngraph/runtime/cpu/kernel/exp.hpp"
+#include "ngraph/runtime/cpu/kernel/log.hpp"
 #include "ngraph/runtime/cpu/kernel/multiply.hpp"
 #include "ngraph/runtime/cpu/kernel/relu.hpp"
 #include "ngraph/runtime/cpu/kernel/result.hpp"
+#include "ngraph/runtime/cpu/kernel/sigmoid.hpp"
+#include "ngraph/runtime/cpu/kernel/softmax.hpp"
+#include "ngraph/runtime/cpu/kernel/tanh.hpp"
+#include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/layer_norm.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
+#include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 
 #ifdef NGRAPH_DISTRIBUTED
@@ -133,6 +145,14 @@ using namespace ngraph;
     {                                                                                              \
         KV = K<double>;                                                                            \
     }                                                                                              \
+    else if (ET == element::f16)                                                                   \
+    {                                                                                              \
+        KV = K<float16>;                                                                           \
+    }                                                                                              \
+    else if (ET == element::bf16)                                                                  \
+    {                                                                                              \
+        KV = K<bfloat16>;                                                                          \
+    }                                                                                              \
     else if (ET == element::i8)                                                                    \
     {                                                                                              \
         KV = K<int8_t>;                                                                            \
@@ -199,6 +219,69 @@ using namespace ngraph;
     };                                                                                             \
     functors.emplace_back(functor);
 
+// f32 goes to the vectorized approximations in functions compiled with fast math
+#define BUILD_TRANSCENDENTAL_FUNCTOR(OP, FAST_OP)                                                  \
+    auto& functors = external_function->get_functors();                                            \
+    auto& tensor_data = external_function->get_tensor_data();                                      \
+    std::function<void(void*, void*, size_t)> kernel;                                              \
+                                                                                                   \
+    auto& element_type = out[0].get_element_type();                                                \
+    if (element_type == element::f32 && external_function->is_fast_math())                         \
+    {                                                                                              \
+        kernel = [](void* input, void* output, size_t count) {                                     \
+            FAST_OP(static_cast<float*>(input), static_cast<float*>(output), count);               \
+        };                                                                                         \
+    }                                                                                              \
+    else if (element_type == element::f32)                                                         \
+    {                                                                                              \
+        kernel = OP<float>;                                                                        \
+    }                                                                                              \
+    else if (element_type == element::f64)                                                         \
+    {                                                                                              \
+        kernel = OP<double>;                                                                       \
+    }                                                                                              \
+    else if (element_type == element::f16)                                                         \
+    {                                                                                              \
+        kernel = OP<float16>;                                                                      \
+    }                                                                                              \
+    else if (element_type == element::bf16)                                                        \
+    {                                                                                              \
+        kernel = OP<bfloat16>;                                                                     \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        throw ngraph_error("Unsupported element type for " + node->description() +                 \
+                           " in CPU builder");                                                     \
+    }                                                                                              \
+                                                                                                   \
+    auto element_count = out[0].get_size();                                                        \
+    auto& arg0_tensor = tensor_data[args[0].get_name()];                                           \
+    auto& out0_tensor = tensor_data[out[0].get_name()];                                            \
+                                                                                                   \
+    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {                            \
+        kernel(arg0_tensor, out0_tensor, element_count);                                           \
+    };                                                                                             \
+    functors.emplace_back(functor);
+
+// Convert kernels depend on two element types. SELECT_KERNEL on the output type picks the
+// instance of select_convert_kernel that runs SELECT_KERNEL again on the input type.
+template <typename OutputElementType>
+struct ConvertTo
+{
+    template <typename InputElementType>
+    static void from(void* input, void* output, size_t count)
+    {
+        runtime::cpu::kernel::convert<InputElementType, OutputElementType>(input, output, count);
+    }
+};
+
+template <typename OutputElementType>
+static void select_convert_kernel(std::function<void(void*, void*, size_t)>& kernel,
+                                  const element::Type& input_type)
+{
+    SELECT_KERNEL(kernel, input_type, ConvertTo<OutputElementType>::template from);
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -235,12 +318,100 @@ namespace ngraph
                 BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::relu);
             }
 
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Exp)
+            {
+                BUILD_TRANSCENDENTAL_FUNCTOR(runtime::cpu::kernel::exp,
+                                             runtime::cpu::kernel::fast_exp_float32);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Log)
+            {
+                BUILD_TRANSCENDENTAL_FUNCTOR(runtime::cpu::kernel::log,
+                                             runtime::cpu::kernel::fast_log_float32);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Tanh)
+            {
+                BUILD_TRANSCENDENTAL_FUNCTOR(runtime::cpu::kernel::tanh,
+                                             runtime::cpu::kernel::fast_tanh_float32);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sigmoid)
+            {
+                BUILD_TRANSCENDENTAL_FUNCTOR(runtime::cpu::kernel::sigmoid,
+                                             runtime::cpu::kernel::fast_sigmoid_float32);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Result)
             {
                 BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::result);
             }
 
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Convert)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+                std::function<void(void*, void*, size_t)> kernel;
+
+                void (*select)(std::function<void(void*, void*, size_t)>&,
+                               const element::Type&) = nullptr;
+                SELECT_KERNEL(select, out[0].get_element_type(), select_convert_kernel);
+                if (select)
+                {
+                    select(kernel, args[0].get_element_type());
+                }
+                if (!kernel)
+                {
+                    throw ngraph_error("Unsupported element types for " + node->description() +
+                                       " in CPU builder");
+                }
+
+                auto element_count = out[0].get_size();
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {
+                    kernel(arg0_tensor, out0_tensor, element_count);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Dot)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+                std::function<void(void*, void*, void*, size_t, size_t, size_t)> kernel;
+
+                SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::dot);
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                const ngraph::op::Dot* dot = static_cast<const ngraph::op::Dot*>(node);
+                const Shape& arg0_shape = args[0].get_shape();
+                const Shape& arg1_shape = args[1].get_shape();
+                size_t reduction_axes_count = dot->get_reduction_axes_count();
+                size_t m =
+                    shape_size(Shape(arg0_shape.begin(), arg0_shape.end() - reduction_axes_count));
+                size_t k =
+                    shape_size(Shape(arg0_shape.end() - reduction_axes_count, arg0_shape.end()));
+                size_t n = shape_size(
+                    Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+
+                auto functor = [&, kernel, m, n, k](CPURuntimeContext* ctx) {
+                    kernel(arg0_tensor, arg1_tensor, out0_tensor, m, n, k);
+                };
+                functors.emplace_back(functor);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::MatmulBias)
             {
@@ -386,6 +557,131 @@ namespace ngraph
                 functors.emplace_back(functor);
             }
 
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Softmax)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                const ngraph::op::Softmax* softmax = static_cast<const ngraph::op::Softmax*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    if (softmax->get_axes().size() != 1)
+                    {
+                        throw ngraph_error("MKLDNN supports softmax only across single axis");
+                    }
+                    int softmax_axis = static_cast<int>(*(softmax->get_axes().begin()));
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[0], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0));
+                    auto result_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[0], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0));
+
+                    size_t softmax_index = mkldnn_emitter->build_softmax_forward(
+                        input_desc, result_desc, softmax_axis);
+                    auto& deps = mkldnn_emitter->get_primitive_deps(softmax_index);
+
+                    auto functor = [&, softmax_index, deps](CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out0_tensor);
+                        cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, softmax_index);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                std::function<void(void*, void*, const Shape&, const AxisSet&)> kernel;
+                if (out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::softmax<float>;
+                }
+                else if (out[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::softmax<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type for Softmax in CPU builder");
+                }
+
+                auto shape = args[0].get_shape();
+                auto axes = softmax->get_axes();
+                auto functor = [&, kernel, shape, axes](CPURuntimeContext* ctx) {
+                    kernel(arg0_tensor, out0_tensor, shape, axes);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Attention)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& arg2_tensor = tensor_data[args[2].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                const ngraph::op::Attention* attention =
+                    static_cast<const ngraph::op::Attention*>(node);
+                size_t m = args[0].get_shape()[0];
+                size_t d = args[0].get_shape()[1];
+                size_t n = args[2].get_shape()[0];
+                size_t dv = args[2].get_shape()[1];
+                float scale = static_cast<float>(attention->get_scale());
+                bool key_transposed = attention->get_is_key_transposed();
+
+                auto functor = [&, m, n, d, dv, scale, key_transposed](CPURuntimeContext* ctx) {
+                    runtime::cpu::kernel::attention_float32(static_cast<float*>(arg0_tensor),
+                                                            static_cast<float*>(arg1_tensor),
+                                                            static_cast<float*>(arg2_tensor),
+                                                            static_cast<float*>(out0_tensor),
+                                                            m,
+                                                            n,
+                                                            d,
+                                                            dv,
+                                                            scale,
+                                                            key_transposed);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::LayerNorm)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& arg2_tensor = tensor_data[args[2].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                const ngraph::op::LayerNorm* layer_norm =
+                    static_cast<const ngraph::op::LayerNorm*>(node);
+                auto& input_shape = args[0].get_shape();
+                size_t begin = layer_norm->get_begin_norm_axis();
+                size_t rows = shape_size(Shape(input_shape.begin(), input_shape.begin() + begin));
+                size_t n = shape_size(Shape(input_shape.begin() + begin, input_shape.end()));
+                double eps = layer_norm->get_eps_value();
+
+                auto functor = [&, rows, n, eps](CPURuntimeContext* ctx) {
+                    runtime::cpu::kernel::layer_norm_float32(static_cast<float*>(arg0_tensor),
+                                                             static_cast<float*>(arg1_tensor),
+                                                             static_cast<float*>(arg2_tensor),
+                                                             static_cast<float*>(out0_tensor),
+                                                             rows,
+                                                             n,
+                                                             eps);
+                };
+                functors.emplace_back(functor);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Constant)
             {
@@ -416,12 +712,21 @@ namespace ngraph
             const BuildOpMap build_dispatcher{
                 {TI(ngraph::op::Add), &runtime::cpu::Builder::build<ngraph::op::Add>},
                 {TI(ngraph::op::Multiply), &runtime::cpu::Builder::build<ngraph::op::Multiply>},
+                {TI(ngraph::op::Dot), &runtime::cpu::Builder::build<ngraph::op::Dot>},
                 {TI(ngraph::op::Parameter), &runtime::cpu::Builder::nop},
                 {TI(ngraph::op::Abs), &runtime::cpu::Builder::build<ngraph::op::Abs>},
                 {TI(ngraph::op::Ceiling), &runtime::cpu::Builder::build<ngraph::op::Ceiling>},
+                {TI(ngraph::op::Exp), &runtime::cpu::Builder::build<ngraph::op::Exp>},
+                {TI(ngraph::op::Log), &runtime::cpu::Builder::build<ngraph::op::Log>},
+                {TI(ngraph::op::Tanh), &runtime::cpu::Builder::build<ngraph::op::Tanh>},
+                {TI(ngraph::op::Sigmoid), &runtime::cpu::Builder::build<ngraph::op::Sigmoid>},
                 {TI(ngraph::op::Relu), &runtime::cpu::Builder::build<ngraph::op::Relu>},
                 {TI(ngraph::op::Result), &runtime::cpu::Builder::build<ngraph::op::Result>},
+                {TI(ngraph::op::Convert), &runtime::cpu::Builder::build<ngraph::op::Convert>},
                 {TI(ngraph::op::MatmulBias), &runtime::cpu::Builder::build<ngraph::op::MatmulBias>},
+                {TI(ngraph::op::Softmax), &runtime::cpu::Builder::build<ngraph::op::Softmax>},
+                {TI(ngraph::op::Attention), &runtime::cpu::Builder::build<ngraph::op::Attention>},
+                {TI(ngraph::op::LayerNorm), &runtime::cpu::Builder::build<ngraph::op::LayerNorm>},
                 {TI(ngraph::op::Constant), &runtime::cpu::Builder::build<ngraph::op::Constant>}};
         }
     }
@@ -16,19 +16,23 @@
 
 #include <algorithm>
 
-#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_threading.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
-                                           EntryPoint compiled_function)
+                                           EntryPoint compiled_function,
+                                           const NumaPlacement& placement,
+                                           const PagePolicy& pages)
     : m_external_function(external_function)
     , m_compiled_function(compiled_function)
+    , m_numa_placement(placement)
+    , m_page_policy(pages)
 {
     setup_runtime_context();
 }
@@ -42,6 +46,9 @@ void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::TensorView>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::TensorView>>& input_tvs)
 {
+    apply_threading_config();
+    NumaNodeBinding binding(m_numa_placement.node);
+
     vector<void*> inputs;
     vector<void*> outputs;
 
@@ -100,6 +107,23 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
 }
 
+size_t runtime::cpu::CPU_CallFrame::get_context_size() const
+{
+    size_t size = sizeof(CPURuntimeContext);
+    if (ctx->op_durations)
+    {
+        size += m_external_function->get_op_attrs().size() * sizeof(int64_t);
+    }
+    size += m_external_function->get_parameter_layout_descriptors().size() * sizeof(bool);
+    size += ctx->memory_buffers.capacity() * sizeof(NumaBuffer*);
+    return size;
+}
+
+size_t runtime::cpu::CPU_CallFrame::get_constant_replica_size() const
+{
+    return m_constant_replica ? m_constant_replica->size() : 0;
+}
+
 void runtime::cpu::CPU_CallFrame::setup_runtime_context()
 {
     ctx = new CPURuntimeContext;
@@ -110,13 +134,23 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
         ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
     }
     ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
-    // Create temporary buffer pools
-    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    // Create temporary buffer pools. The mappings are page aligned, which covers
+    // CPU_ExternalFunction::s_memory_pool_alignment.
     for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
     {
-        auto buffer = new AlignedBuffer(buffer_size, alignment);
+        auto buffer = new NumaBuffer(buffer_size, m_numa_placement.node, m_page_policy);
         ctx->memory_buffers.push_back(buffer);
     }
+    if (m_numa_placement.node >= 0 || m_page_policy.huge_pages != PagePolicy::HugePages::None)
+    {
+        m_constant_replica = m_external_function->get_constant_replica(
+            m_numa_placement.node, m_numa_placement.share_constants, m_page_policy);
+        ctx->constants = m_constant_replica->get_constant_ptrs().data();
+    }
+    else
+    {
+        ctx->constants = m_external_function->get_constant_ptrs().data();
+    }
     const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
     ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
     ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
@@ -131,4 +165,5 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         delete buffer;
     }
     delete ctx;
+    m_constant_replica = nullptr;
 }
@@ -22,6 +22,7 @@
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
 
@@ -43,7 +44,9 @@ namespace ngraph
             {
             public:
                 CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
-                              EntryPoint compiled_function);
+                              EntryPoint compiled_function,
+                              const NumaPlacement& placement = NumaPlacement(),
+                              const PagePolicy& pages = PagePolicy());
                 ~CPU_CallFrame();
 
                 /// @brief Invoke the function with values matching the signature of the function.
@@ -58,9 +61,21 @@ namespace ngraph
                 void setup_runtime_context();
                 void cleanup_runtime_context();
 
+                const NumaPlacement& get_numa_placement() const { return m_numa_placement; }
+                const PagePolicy& get_page_policy() const { return m_page_policy; }
+                /// Bytes of the runtime context and the arrays it owns, not counting the memory
+                /// buffers it points at
+                size_t get_context_size() const;
+                /// Bytes of the constant copy the frame reads, 0 if it reads the graph's own
+                size_t get_constant_replica_size() const;
+
             protected:
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
+                NumaPlacement m_numa_placement;
+                PagePolicy m_page_policy;
+                // Holds the constants ctx points at when they are copied out of the graph
+                std::shared_ptr<NumaConstantReplica> m_constant_replica;
                 CPURuntimeContext* ctx;
             };
         }
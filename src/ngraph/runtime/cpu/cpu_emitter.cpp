@@ -17,6 +17,8 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
+#include <limits>
 #include <numeric>
 #include <string>
 #include <typeindex>
@@ -40,6 +42,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -68,6 +71,9 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/quantized_dot.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -92,6 +98,7 @@
 #include "ngraph/runtime/cpu/cpu_kernel_emitters.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
@@ -99,6 +106,8 @@
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/grouped_dot.hpp"
+#include "ngraph/runtime/cpu/op/layer_norm.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
@@ -134,6 +143,193 @@ static string eigen_matrix_format(const ngraph::Shape& shape, const ngraph::Stri
     return ss.str();
 }
 
+// Quantization parameters are baked into the generated code, so they must round trip exactly
+static string emit_double(double value)
+{
+    stringstream ss;
+    ss << setprecision(numeric_limits<double>::max_digits10) << value;
+    return ss.str();
+}
+
+// With fast math, f32 transcendentals call the vectorized approximations instead
+static bool emit_fast_math_kernel(runtime::cpu::CPU_ExternalFunction* external_function,
+                                  codegen::CodeWriter& writer,
+                                  const string& kernel,
+                                  const vector<runtime::cpu::TensorViewWrapper>& args,
+                                  const vector<runtime::cpu::TensorViewWrapper>& out)
+{
+    if (!external_function->is_fast_math() || out[0].get_element_type() != element::f32)
+    {
+        return false;
+    }
+    writer << "cpu::kernel::" << kernel << "_float32(" << args[0].get_name() << ", "
+           << out[0].get_name() << ", " << out[0].get_size() << ");\n";
+    return true;
+}
+
+// f16 and bf16 elementwise ops call the library kernels that widen each element to f32
+static bool emit_widening_kernel(codegen::CodeWriter& writer,
+                                 const string& kernel,
+                                 const vector<runtime::cpu::TensorViewWrapper>& args,
+                                 const vector<runtime::cpu::TensorViewWrapper>& out)
+{
+    const element::Type& type = out[0].get_element_type();
+    if (type != element::f16 && type != element::bf16)
+    {
+        return false;
+    }
+    writer << "cpu::kernel::widening_" << kernel << "<" << type.c_type_string() << ">(";
+    for (const runtime::cpu::TensorViewWrapper& arg : args)
+    {
+        writer << arg.get_name() << ", ";
+    }
+    writer << out[0].get_name() << ", " << out[0].get_size() << ");\n";
+    return true;
+}
+
+// Convolutions that mkldnn does not take run on the im2col/GEMM and direct kernels for
+// floating point types. Both take the same arguments as reference::convolution.
+static string convolution_kernel(const string& type)
+{
+    if (type == "float")
+    {
+        return "cpu::kernel::convolution_float32";
+    }
+    if (type == "double")
+    {
+        return "cpu::kernel::convolution_float64";
+    }
+    return "reference::convolution<" + type + ">";
+}
+
+// Builds a C++ expression in x and y computing the scalar function rooted at node, whose
+// parameters are x and y. Fails on anything but a small set of elementwise ops.
+static bool emit_combiner_expression(const shared_ptr<Node>& node,
+                                     const op::ParameterVector& params,
+                                     string& expr)
+{
+    static const unordered_map<string, string> infix_ops{{"Add", "+"},
+                                                         {"Subtract", "-"},
+                                                         {"Multiply", "*"},
+                                                         {"Divide", "/"},
+                                                         {"Equal", "=="},
+                                                         {"NotEqual", "!="},
+                                                         {"Greater", ">"},
+                                                         {"GreaterEq", ">="},
+                                                         {"Less", "<"},
+                                                         {"LessEq", "<="},
+                                                         {"And", "&&"},
+                                                         {"Or", "||"}};
+
+    if (node == params.at(0) || node == params.at(1))
+    {
+        expr = (node == params.at(0) ? "x" : "y");
+        return true;
+    }
+    if (auto constant = dynamic_pointer_cast<ngraph::op::Constant>(node))
+    {
+        auto& type = constant->get_element_type();
+        if (shape_size(constant->get_shape()) != 1)
+        {
+            return false;
+        }
+        if (type == element::f32 || type == element::f64)
+        {
+            double value = (type == element::f32 ? constant->get_vector<float>()[0]
+                                                 : constant->get_vector<double>()[0]);
+            if (!std::isfinite(value))
+            {
+                return false;
+            }
+            expr = "static_cast<" + type.c_type_string() + ">(" + emit_double(value) + ")";
+            return true;
+        }
+        if (type.is_real())
+        {
+            return false;
+        }
+        expr = "static_cast<" + type.c_type_string() + ">(" +
+               constant->get_value_strings()[0] + ")";
+        return true;
+    }
+
+    vector<string> operands;
+    for (const shared_ptr<Node>& arg : node->get_arguments())
+    {
+        string operand;
+        if (!emit_combiner_expression(arg, params, operand))
+        {
+            return false;
+        }
+        operands.push_back(operand);
+    }
+
+    const string& op = node->description();
+    auto infix = infix_ops.find(op);
+    if (infix != infix_ops.end())
+    {
+        expr = "(" + operands.at(0) + " " + infix->second + " " + operands.at(1) + ")";
+    }
+    else if (op == "Maximum")
+    {
+        expr = "(" + operands.at(0) + " > " + operands.at(1) + " ? " + operands.at(0) + " : " +
+               operands.at(1) + ")";
+    }
+    else if (op == "Minimum")
+    {
+        expr = "(" + operands.at(0) + " < " + operands.at(1) + " ? " + operands.at(0) + " : " +
+               operands.at(1) + ")";
+    }
+    else if (op == "Negative")
+    {
+        expr = "(-" + operands.at(0) + ")";
+    }
+    else if (op == "Not")
+    {
+        expr = "(!" + operands.at(0) + ")";
+    }
+    else if (op == "Select")
+    {
+        expr = "(" + operands.at(0) + " ? " + operands.at(1) + " : " + operands.at(2) + ")";
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// Emits a lambda named name for a nested scalar function such as a reduction or selection
+// function. Simple bodies are inlined so the kernel loop has no call through the compiled
+// function per element.
+static void emit_combiner(codegen::CodeWriter& writer,
+                          const string& name,
+                          const shared_ptr<Function>& function,
+                          const string& type,
+                          const string& result_type)
+{
+    string expr;
+    if (emit_combiner_expression(
+            function->get_results().at(0)->get_argument(0), function->get_parameters(), expr))
+    {
+        writer << "auto " << name << " = [](" << type << " x, " << type << " y) -> "
+               << result_type << " { return static_cast<" << result_type << ">(" << expr
+               << "); };\n";
+        return;
+    }
+
+    writer << "auto " << name << " = [&](" << type << " x, " << type << " y) -> " << result_type
+           << " {\n";
+    writer.indent++;
+    writer << result_type << " result;\n";
+    writer << "void* args[] = {&x, &y};\n";
+    writer << "void* out[] = {&result};\n";
+    writer << function->get_name() << "(args, out, ctx);\n";
+    writer << "return result;\n";
+    writer.indent--;
+    writer << "};\n";
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -143,6 +339,10 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Add)
             {
+                if (emit_widening_kernel(writer, "add", args, out))
+                {
+                    return;
+                }
                 // TODO: Audit all uses of Add and fix this to use
                 // the right alignment instead of Eigen::Unaligned
                 writer.block_begin();
@@ -226,9 +426,29 @@ namespace ngraph
                 }
 
                 writer.block_begin();
-                writer << "MPI_Allreduce(" << args[0].get_name() << ", " << out[0].get_name()
-                       << ", " << out[0].get_size() << ", " << data_type
-                       << ", MPI_SUM, MPI_COMM_WORLD);\n";
+                auto& requests = external_function->get_allreduce_requests();
+                auto request = requests.find(node);
+                if (request != requests.end())
+                {
+                    // Non-blocking: the external function emits the matching MPI_Wait ahead
+                    // of the first consumer of the result. Reducing in place on the output
+                    // lets the argument's buffer be reused while the reduction is in flight.
+                    if (args[0].get_name() != out[0].get_name())
+                    {
+                        writer << "memcpy(" << out[0].get_name() << ", " << args[0].get_name()
+                               << ", " << out[0].get_size() * element_type.size() << ");\n";
+                    }
+                    writer << "MPI_Iallreduce(MPI_IN_PLACE, " << out[0].get_name() << ", "
+                           << out[0].get_size() << ", " << data_type
+                           << ", MPI_SUM, MPI_COMM_WORLD, &allreduce_requests[" << request->second
+                           << "]);\n";
+                }
+                else
+                {
+                    writer << "MPI_Allreduce(" << args[0].get_name() << ", " << out[0].get_name()
+                           << ", " << out[0].get_size() << ", " << data_type
+                           << ", MPI_SUM, MPI_COMM_WORLD);\n";
+                }
                 writer.block_end();
             }
 #endif
@@ -457,6 +677,54 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::GroupedDot)
+            {
+                const Shape& shape_a = args[0].get_shape();
+                const Shape& shape_b = args[1].get_shape();
+                size_t m = shape_a[0];
+                size_t k = shape_a[1];
+                size_t n = shape_b[1];
+                size_t group_size = out.size();
+
+                auto populate_array = [&writer, group_size](
+                    const std::vector<TensorViewWrapper>& tvs, size_t first, size_t step) {
+                    for (size_t i = 0; i < group_size; ++i)
+                    {
+                        writer << tvs[first + i * step].get_name()
+                               << ((i < group_size - 1) ? ", " : "");
+                    }
+                };
+
+                writer.block_begin();
+                writer << "cblas::Transpose transa_array[] = {cblas::Transpose::None};\n";
+                writer << "cblas::Transpose transb_array[] = {cblas::Transpose::None};\n";
+                writer << "int64_t m_array[] = {" << m << "};\n";
+                writer << "int64_t n_array[] = {" << n << "};\n";
+                writer << "int64_t k_array[] = {" << k << "};\n";
+                writer << "float alpha_array[] = {1.0f};\n";
+                writer << "const float* a_array[] = {";
+                populate_array(args, 0, 2);
+                writer << "};\n";
+                writer << "int64_t lda_array[] = {" << std::max(1UL, k) << "};\n";
+                writer << "const float* b_array[] = {";
+                populate_array(args, 1, 2);
+                writer << "};\n";
+                writer << "int64_t ldb_array[] = {" << std::max(1UL, n) << "};\n";
+                writer << "float beta_array[] = {0.0f};\n";
+                writer << "float* c_array[] = {";
+                populate_array(out, 0, 1);
+                writer << "};\n";
+                writer << "int64_t ldc_array[] = {" << std::max(1UL, n) << "};\n";
+                writer << "int64_t group_size[] = {" << group_size << "};\n";
+
+                writer << "cblas_sgemm_batch(cblas::Layout::RowMajor, ";
+                writer << "transa_array, transb_array, m_array, n_array, k_array, \n";
+                writer << "alpha_array, a_array, lda_array, b_array, ldb_array, beta_array, \n";
+                writer << "c_array, ldc_array, 1, group_size);\n";
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Lstm)
             {
@@ -928,7 +1196,10 @@ namespace ngraph
 
                 const Shape& arg0_shape = args[0].get_shape();
                 const Shape& arg1_shape = args[1].get_shape();
-                if (arg0_shape.empty() || arg1_shape.empty())
+                // Eigen has no f16 or bf16 scalar types, so those always take the GEMM kernel
+                const element::Type& type = out[0].get_element_type();
+                bool eigen_type = type != element::f16 && type != element::bf16;
+                if (eigen_type && (arg0_shape.empty() || arg1_shape.empty()))
                 {
                     auto& first = (arg0_shape.empty() ? args[0] : args[1]);
                     auto& second = (arg0_shape.empty() ? args[1] : args[0]);
@@ -938,7 +1209,7 @@ namespace ngraph
                     writer << first.get_name() << "[0]\n    * " << emit_vector(second) << ";\n";
                     writer.block_end();
                 }
-                else if ((arg0_shape.size() == 1) && (arg1_shape.size() == 1) &&
+                else if (eigen_type && (arg0_shape.size() == 1) && (arg1_shape.size() == 1) &&
                          dot->get_reduction_axes_count() == 1)
                 {
                     writer.block_begin();
@@ -947,7 +1218,7 @@ namespace ngraph
                            << ");\n";
                     writer.block_end();
                 }
-                else if ((arg0_shape.size() == 2) && (arg1_shape.size() == 1) &&
+                else if (eigen_type && (arg0_shape.size() == 2) && (arg1_shape.size() == 1) &&
                          dot->get_reduction_axes_count() == 1)
                 {
                     writer.block_begin();
@@ -956,112 +1227,32 @@ namespace ngraph
                            << ";\n";
                     writer.block_end();
                 }
-                else if ((arg0_shape.size() == 2) && (arg1_shape.size() == 2) &&
-                         dot->get_reduction_axes_count() == 1)
-                {
-                    // Emit an MKL SGEMM call if possible
-                    if (args[0].get_element_type() == element::f32)
-                    {
-                        writer.block_begin();
-                        writer << "cblas::cblas_sgemm("
-                               << "cblas::Layout::RowMajor, "
-                               << "cblas::Transpose::None, "
-                               << "cblas::Transpose::None, " << arg0_shape[0] << ", "
-                               << arg1_shape[1] << ", " << arg0_shape[1] << ",\n"
-                               << "        1.0f, " << args[0].get_name() << ", "
-                               << max(1UL, arg0_shape[1]) << ", " << args[1].get_name() << ", "
-                               << max(1UL, arg1_shape[1]) << ", 0.0f,\n"
-                               << "        " << out[0].get_name() << ", " << max(1UL, arg1_shape[1])
-                               << ");\n";
-                        writer.block_end();
-                    }
-                    else
-                    {
-                        writer.block_begin();
-                        writer << emit_matrix(out[0]) << " = \n"
-                               << "    " << emit_matrix(args[0]) << " * " << emit_matrix(args[1])
-                               << ";\n";
-                        writer.block_end();
-                    }
-                }
-                // Specialized handling of rank 3 tensor multiply rank 2 tensor where
-                // each of the
-                else if ((arg0_shape.size() == 3) && (arg1_shape.size() == 2) &&
-                         dot->get_reduction_axes_count() == 1 &&
-                         args[0].get_element_type() == element::f32)
-                {
-                    auto mat_a = args[0];
-                    auto mat_b = args[1];
-                    auto mat_c = out[0];
-                    const Shape& shape_a = mat_a.get_shape();
-                    const Shape& shape_b = mat_b.get_shape();
-
-                    const size_t m = shape_a[1];
-                    const size_t k = shape_a[2];
-                    const size_t n = shape_b[1];
-
-                    // this also works when mat_a is shape (1, m, k)
-                    const size_t offset_a = m * k;
-                    // we do not offset mat_b
-                    const size_t offset_b = 0;
-                    const size_t offset_c = m * n;
-
-                    const size_t group_count = 1;
-                    const size_t group_size = shape_a[0];
-                    auto populate_array =
-                        [&writer](const std::string& var, size_t size, size_t offset) {
-                            for (size_t i = 0; i < size; ++i)
-                            {
-                                writer << var << "+" << i * offset << ((i < size - 1) ? ", " : "");
-                            }
-                        };
-
-                    writer.block_begin();
-                    writer << "cblas::Transpose transa_array[] = {cblas::Transpose::None};\n";
-                    writer << "cblas::Transpose transb_array[] = {cblas::Transpose::None};\n";
-                    writer << "int64_t m_array[] = {" << m << "};\n";
-                    writer << "int64_t n_array[] = {" << n << "};\n";
-                    writer << "int64_t k_array[] = {" << k << "};\n";
-                    writer << "float alpha_array[] = {1.0f};\n";
-                    writer << "std::vector<const float*> a{";
-                    populate_array(mat_a.get_name(), group_size, offset_a);
-                    writer << "};\n";
-                    writer << "const float** a_array = &a[0];\n";
-                    writer << "int64_t lda_array[] = {" << std::max(1UL, k) << "};\n";
-                    writer << "std::vector<const float*> b{";
-                    populate_array(mat_b.get_name(), group_size, offset_b);
-                    writer << "};\n";
-                    writer << "const float** b_array = &b[0];\n";
-                    writer << "int64_t ldb_array[] = {" << std::max(1UL, n) << "};\n";
-                    writer << "float beta_array[] = {0.0f};\n";
-                    writer << "std::vector<float*> c{";
-                    populate_array(mat_c.get_name(), group_size, offset_c);
-                    writer << "};\n";
-                    writer << "float** c_array = &c[0];\n";
-                    writer << "int64_t ldc_array[] = {" << std::max(1UL, n) << "};\n";
-                    writer << "int64_t group_size[] = {" << group_size << "};\n";
-
-                    writer << "cblas_sgemm_batch(cblas::Layout::RowMajor, ";
-                    writer << "transa_array, transb_array, m_array, n_array, k_array, \n";
-                    writer << "alpha_array, a_array, lda_array, b_array, ldb_array, beta_array, \n";
-                    writer << "c_array, ldc_array, " << group_count << ", group_size);\n";
-                    writer.block_end();
-                }
                 else
                 {
-                    writer << "reference::dot(" << args[0].get_name() << ",\n";
-                    writer << "            " << args[1].get_name() << ",\n";
-                    writer << "            " << out[0].get_name() << ",\n";
-                    writer << "            {" << join(args[0].get_shape()) << "},\n";
-                    writer << "            {" << join(args[1].get_shape()) << "},\n";
-                    writer << "            {" << join(out[0].get_shape()) << "},\n";
-                    writer << "            " << dot->get_reduction_axes_count() << ");\n";
+                    // Any other contraction is a single GEMM over the row-major buffers
+                    size_t reduction_axes_count = dot->get_reduction_axes_count();
+                    size_t m = shape_size(
+                        Shape(arg0_shape.begin(), arg0_shape.end() - reduction_axes_count));
+                    size_t k = shape_size(
+                        Shape(arg0_shape.end() - reduction_axes_count, arg0_shape.end()));
+                    size_t n = shape_size(
+                        Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+
+                    writer << "cpu::kernel::dot<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                 " << args[1].get_name() << ",\n";
+                    writer << "                 " << out[0].get_name() << ",\n";
+                    writer << "                 " << m << ", " << n << ", " << k << ");\n";
                 }
             }
 
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Multiply)
             {
+                if (emit_widening_kernel(writer, "multiply", args, out))
+                {
+                    return;
+                }
                 writer.block_begin();
 #if USE_EIGEN_CORE_INLINE == 1
                 writer << emit_array1d(out[0]) << " =\n"
@@ -1093,6 +1284,10 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Abs)
             {
+                if (emit_widening_kernel(writer, "abs", args, out))
+                {
+                    return;
+                }
                 writer.block_begin();
 #if USE_EIGEN_CORE_INLINE == 1
                 writer << emit_array1d(out[0]) << " =\n";
@@ -1397,6 +1592,14 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Log)
             {
+                if (emit_widening_kernel(writer, "log", args, out))
+                {
+                    return;
+                }
+                if (emit_fast_math_kernel(external_function, writer, "fast_log", args, out))
+                {
+                    return;
+                }
                 writer.block_begin();
 #if USE_EIGEN_CORE_INLINE == 1
                 writer << emit_array1d(out[0]) << " =\n"
@@ -1641,8 +1844,9 @@ namespace ngraph
                     if (result.get() == node)
                     {
                         const descriptor::Tensor& tensor = node->get_output_tensor(0);
-                        writer << "memcpy(outputs[" << output_index << "], " << tensor.get_name()
-                               << ", " << tensor.size() << ");\n";
+                        writer << "memcpy(outputs[" << output_index << "], ctx->constants["
+                               << external_function->get_constant_index(node) << "], "
+                               << tensor.size() << ");\n";
                     }
                     output_index++;
                 }
@@ -2014,16 +2218,7 @@ namespace ngraph
                 writer.block_begin();
 
                 string type = f_result_element_type.c_type_string();
-
-                writer << "auto f = [&](" << type << " x, " << type << " y) -> " << type << " {\n";
-                writer.indent++;
-                writer << type << " result;\n";
-                writer << "void* args[] = {&x, &y};\n";
-                writer << "void* out[] = {&result};\n";
-                writer << reduction_function->get_name() << "(args, out, ctx);\n";
-                writer << "return result;\n";
-                writer.indent--;
-                writer << "};\n";
+                emit_combiner(writer, "f", reduction_function, type, type);
 
                 kernel::emit_reduce(writer,
                                     args[0].get_element_type().c_type_string(),
@@ -2250,6 +2445,14 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Exp)
             {
+                if (emit_widening_kernel(writer, "exp", args, out))
+                {
+                    return;
+                }
+                if (emit_fast_math_kernel(external_function, writer, "fast_exp", args, out))
+                {
+                    return;
+                }
                 writer.block_begin();
 #if USE_EIGEN_CORE_INLINE == 1
                 writer << emit_array1d(out[0]) << " =\n"
@@ -2352,10 +2555,16 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Tanh)
             {
+                if (emit_widening_kernel(writer, "tanh", args, out))
+                {
+                    return;
+                }
+                if (emit_fast_math_kernel(external_function, writer, "fast_tanh", args, out))
+                {
+                    return;
+                }
                 // Eigen's generic_fast_tanh_float<float> is currently miscompiled by Clang/LLVM
                 // so we fall-back to tanh
-                // TODO: Implement our own internal fast/approximate tanh if this actually gets used
-                // by models
                 writer.block_begin();
 #if USE_EIGEN_CORE_INLINE == 0
                 writer << "#pragma omp parallel for\n";
@@ -2610,6 +2819,10 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Ceiling)
             {
+                if (emit_widening_kernel(writer, "ceil", args, out))
+                {
+                    return;
+                }
                 writer.block_begin();
                 size_t element_count = out[0].get_size();
 #if USE_EIGEN_CORE_INLINE == 0
@@ -2905,7 +3118,7 @@ namespace ngraph
                 }
                 else
                 {
-                    writer << "reference::convolution<" << out[0].get_type() << ">("
+                    writer << convolution_kernel(out[0].get_type()) << "("
                            << args[0].get_name() << ",\n";
                     writer << "                         " << args[1].get_name() << ",\n";
                     writer << "                         " << out[0].get_name() << ",\n";
@@ -2975,7 +3188,7 @@ namespace ngraph
                 }
                 else
                 {
-                    writer << "reference::convolution<" << out[0].get_type() << ">("
+                    writer << convolution_kernel(out[0].get_type()) << "("
                            << args[0].get_name() << ",\n";
                     writer << "                         " << args[1].get_name() << ",\n";
                     writer << "                         " << out[0].get_name() << ",\n";
@@ -3052,7 +3265,7 @@ namespace ngraph
                 else
                 {
                     // Note that args[1] and args[0] are switched here from the usual order.
-                    writer << "reference::convolution<" << out[0].get_type() << ">("
+                    writer << convolution_kernel(out[0].get_type()) << "("
                            << args[1].get_name() << ",\n";
                     writer << "                         " << args[0].get_name() << ",\n";
                     writer << "                         " << out[0].get_name() << ",\n";
@@ -3578,15 +3791,7 @@ namespace ngraph
                 writer.block_begin();
 
                 string type = f_result_element_type.c_type_string();
-                writer << "auto f = [&](" << type << " x, " << type << " y) -> " << type << " {\n";
-                writer.indent++;
-                writer << type << " result;\n";
-                writer << "void* args[] = {&x, &y};\n";
-                writer << "void* out[] = {&result};\n";
-                writer << reduction_function->get_name() << "(args, out, ctx);\n";
-                writer << "return result;\n";
-                writer.indent--;
-                writer << "};\n";
+                emit_combiner(writer, "f", reduction_function, type, type);
 
                 writer << "reference::reduce_window<" << out[0].get_type() << ">("
                        << args[0].get_name() << ",\n";
@@ -3618,26 +3823,8 @@ namespace ngraph
 
                 string type = node->get_output_element_type(0).c_type_string();
 
-                writer << "auto f_select = [&](" << type << " x, " << type << " y) -> char {\n";
-                writer.indent++;
-                writer << "char result;\n";
-                writer << "void* args[] = {&x, &y};\n";
-                writer << "void* out[] = {&result};\n";
-                writer << selection_function->get_name() << "(args, out, ctx);\n";
-                writer << "return result;\n";
-                writer.indent--;
-                writer << "};\n";
-
-                writer << "auto f_scatter = [&](" << type << " x, " << type << " y) -> " << type
-                       << " {\n";
-                writer.indent++;
-                writer << type << " result;\n";
-                writer << "void* args[] = {&x, &y};\n";
-                writer << "void* out[] = {&result};\n";
-                writer << scatter_function->get_name() << "(args, out, ctx);\n";
-                writer << "return result;\n";
-                writer.indent--;
-                writer << "};\n";
+                emit_combiner(writer, "f_select", selection_function, type, "char");
+                emit_combiner(writer, "f_scatter", scatter_function, type, type);
 
                 writer << "reference::select_and_scatter<" << out[0].get_type() << ">("
                        << args[0].get_name() << ",\n";
@@ -4222,6 +4409,10 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Relu)
             {
+                if (emit_widening_kernel(writer, "relu", args, out))
+                {
+                    return;
+                }
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
@@ -4293,6 +4484,14 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Sigmoid)
             {
+                if (emit_widening_kernel(writer, "sigmoid", args, out))
+                {
+                    return;
+                }
+                if (emit_fast_math_kernel(external_function, writer, "fast_sigmoid", args, out))
+                {
+                    return;
+                }
                 auto input_shape = args[0].get_shape();
                 auto result_shape = out[0].get_shape();
                 int input_1d_size = static_cast<int>(shape_size(input_shape));
@@ -4365,13 +4564,28 @@ namespace ngraph
                                           const std::string& input,
                                           const std::string& out_numer,
                                           const std::string& out_denom,
-                                          bool derivative)
+                                          bool derivative,
+                                          bool fast_math)
             {
                 std::string func_block;
+                std::string exp_function = fast_math ? "cpu::kernel::fast_expf" : "exp";
+                if (fast_math && !derivative &&
+                    type != ngraph::op::SigmoidMultiply::FunctionType::Identity)
+                {
+                    // The forward pass needs no intermediate terms, and the fused kernels do
+                    // not overflow in exp for large inputs
+                    func_block = out_numer + " = cpu::kernel::fast_" +
+                                 (type == ngraph::op::SigmoidMultiply::FunctionType::Logistic
+                                      ? "sigmoidf("
+                                      : "tanhf(") +
+                                 input + ");\n";
+                    func_block += out_denom + " = 1;\n";
+                    return func_block;
+                }
                 switch (type)
                 {
                 case ngraph::op::SigmoidMultiply::FunctionType::Logistic:
-                    func_block = "auto e_x = exp(" + input + ");\n";
+                    func_block = "auto e_x = " + exp_function + "(" + input + ");\n";
                     func_block += out_numer + " = e_x;\n";
                     func_block += out_denom + " = e_x+1;\n";
                     if (derivative)
@@ -4382,7 +4596,7 @@ namespace ngraph
                     }
                     break;
                 case ngraph::op::SigmoidMultiply::FunctionType::Tanh:
-                    func_block = "auto e_2x = exp(2.0*" + input + ");\n";
+                    func_block = "auto e_2x = " + exp_function + "(2.0*" + input + ");\n";
                     func_block += out_numer + " = e_2x-1;\n";
                     func_block += out_denom + " = e_2x+1;\n";
                     if (derivative)
@@ -4413,6 +4627,8 @@ namespace ngraph
             void CPU_Emitter::EMITTER_DECL(ngraph::op::SigmoidMultiply)
             {
                 auto sigmoid_mul = static_cast<const ngraph::op::SigmoidMultiply*>(node);
+                bool fast_math = external_function->is_fast_math() &&
+                                 out[0].get_element_type() == element::f32;
                 std::string numer_0 = "numer_0";
                 std::string denom_0 = "denom_0";
                 std::string numer_1 = "numer_1";
@@ -4422,13 +4638,15 @@ namespace ngraph
                                               args[0].get_name() + "[i]",
                                               numer_0,
                                               denom_0,
-                                              false);
+                                              false,
+                                              fast_math);
                 std::string input_1_func_string =
                     generate_sigmoid_mul_func(sigmoid_mul->get_input_func_type(1),
                                               args[1].get_name() + "[i]",
                                               numer_1,
                                               denom_1,
-                                              false);
+                                              false,
+                                              fast_math);
 
                 writer.block_begin();
                 writer << "#pragma omp parallel for simd\n";
@@ -4459,6 +4677,8 @@ namespace ngraph
                 // dz/dy = dz/dg * dg/dy = f(x) * g'(y)
                 auto sigmoid_mul_backprop =
                     static_cast<const ngraph::op::SigmoidMultiplyBackprop*>(node);
+                bool fast_math = external_function->is_fast_math() &&
+                                 out[0].get_element_type() == element::f32;
                 const TensorViewWrapper& data_0 = args[0];
                 const TensorViewWrapper& data_1 = args[1];
                 const TensorViewWrapper& delta = args[2];
@@ -4477,13 +4697,15 @@ namespace ngraph
                                               data_0.get_name() + "[i]",
                                               numer_0,
                                               denom_0,
-                                              true);
+                                              true,
+                                              fast_math);
                 std::string input_1_func_string =
                     generate_sigmoid_mul_func(sigmoid_mul_backprop->get_input_func_type(1),
                                               data_1.get_name() + "[i]",
                                               numer_1,
                                               denom_1,
-                                              true);
+                                              true,
+                                              fast_math);
                 writer.block_begin();
                 writer << "#pragma omp parallel for simd\n";
                 writer << "for (size_t i=0; i<" << input_0_delta.get_size() << "; i++)\n";
@@ -4544,188 +4766,62 @@ namespace ngraph
                 }
                 else
                 {
-                    writer.block_begin();
-                    const ngraph::op::Softmax* softmax =
-                        static_cast<const ngraph::op::Softmax*>(node);
-                    auto type = out[0].get_type();
-                    auto shape = out[0].get_shape();
-                    auto dims = out[0].get_shape().size();
-                    auto axes = softmax->get_axes();
-
-                    // create arg/out if 1d
-                    if (dims < 1)
+                    auto softmax = static_cast<const ngraph::op::Softmax*>(node);
+                    auto& et = args[0].get_element_type();
+                    if (et == element::f32 || et == element::f64)
                     {
-                        writer << type << "* arg = " << args[0].get_name() << "\n";
-                        writer << type << "* out = " << out[0].get_name() << "\n";
+                        writer << "cpu::kernel::softmax_"
+                               << (et == element::f32 ? "float32" : "float64") << "("
+                               << args[0].get_name() << ", " << out[0].get_name() << ", "
+                               << "{" << join(args[0].get_shape()) << "}, "
+                               << "{" << join(softmax->get_axes()) << "}"
+                               << ");\n";
                     }
-                    // else cast arg/out to an Nd array
                     else
                     {
-                        std::string shape1toN;
-                        for (size_t d = 1; d < dims; ++d)
-                        {
-                            shape1toN += "[";
-                            shape1toN += std::to_string(shape[d]);
-                            shape1toN += "]";
-                        }
-
-                        writer << type << " (*arg)" << shape1toN << " = (" << type << " (*)"
-                               << shape1toN << ") " << args[0].get_name() << ";\n";
-                        writer << type << " (*out)" << shape1toN << " = (" << type << " (*)"
-                               << shape1toN << ") " << out[0].get_name() << ";\n";
-                    }
-
-                    // build arg/out index
-                    std::string index;
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        index += "[i";
-                        index += std::to_string(d);
-                        index += "]";
-                    }
-
-                    // calculate e ^ (arg - max)
-                    // outer loop(s) - for axis not in axes
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) == axes.end())
-                        {
-                            writer << "#pragma omp parallel for\n";
-                            writer << "for (size_t i" << d << " = 0; i" << d << " < " << shape[d]
-                                   << "; ++i" << d << ")\n";
-                            writer.block_begin();
-                        }
-                    }
-
-                    // max inner loop(s)
-                    writer << type << " m = 0;\n"; // TODO: needs to be minval for the type
-
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) != axes.end())
-                        {
-                            writer << "for (size_t i" << d << " = 0; i" << d << " < " << shape[d]
-                                   << "; ++i" << d << ")\n";
-                            writer.block_begin();
-                        }
-                    }
-
-                    writer << "if (arg" << index << " > m)\n";
-                    writer.block_begin();
-                    writer << "m = arg" << index << ";\n";
-                    writer.block_end();
-
-                    // end max inner loop(s)
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) != axes.end())
-                        {
-                            writer.block_end();
-                        }
-                    }
-
-                    // e ^ (arg - max) inner loop
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) != axes.end())
-                        {
-                            writer << "for (size_t i" << d << " = 0; i" << d << " < " << shape[d]
-                                   << "; ++i" << d << ")\n";
-                            writer.block_begin();
-                        }
-                    }
-
-                    writer << "out" << index << " = exp(arg" << index << " - m);\n";
-
-                    // end e ^ (arg - max) inner loop
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) != axes.end())
-                        {
-                            writer.block_end();
-                        }
-                    }
-
-                    // end e ^ (arg - max) outer loop(s)
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) == axes.end())
-                        {
-                            writer.block_end();
-                        }
-                    }
-
-                    // calculate softmax = e ^ (arg - max) / sum (e ^ (arg - max))
-                    // outer loop(s) - for axis not in axes
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) == axes.end())
-                        {
-                            writer << "#pragma omp parallel for\n";
-                            writer << "for (size_t i" << d << " = 0; i" << d << " < " << shape[d]
-                                   << "; ++i" << d << ")\n";
-                            writer.block_begin();
-                        }
-                    }
-
-                    // sum (e ^ (arg - max) inner loop(s)
-                    writer << type << " d = 0;\n";
-
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) != axes.end())
-                        {
-                            writer << "for (size_t i" << d << " = 0; i" << d << " < " << shape[d]
-                                   << "; ++i" << d << ")\n";
-                            writer.block_begin();
-                        }
-                    }
-
-                    writer << "d += out" << index << ";\n";
-
-                    // end sum (e ^ (arg - max) inner loop(s)
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) != axes.end())
-                        {
-                            writer.block_end();
-                        }
-                    }
-
-                    writer << "d = 1 / d;\n";
-
-                    // softmax inner loop(s)
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) != axes.end())
-                        {
-                            writer << "for (size_t i" << d << " = 0; i" << d << " < " << shape[d]
-                                   << "; ++i" << d << ")\n";
-                            writer.block_begin();
-                        }
+                        writer << "reference::softmax<" << out[0].get_type() << ">("
+                               << args[0].get_name() << ", " << out[0].get_name() << ", "
+                               << "{" << join(args[0].get_shape()) << "}, "
+                               << "{" << join(softmax->get_axes()) << "}"
+                               << ");\n";
                     }
+                }
+            }
 
-                    writer << "out" << index << " *= d;\n";
-
-                    // end softmax inner loop(s)
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) != axes.end())
-                        {
-                            writer.block_end();
-                        }
-                    }
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Attention)
+            {
+                auto attention = static_cast<const ngraph::op::Attention*>(node);
+                auto& query_shape = args[0].get_shape();
+                auto& value_shape = args[2].get_shape();
+
+                writer << "cpu::kernel::attention_float32(" << args[0].get_name() << ",\n";
+                writer << "                               " << args[1].get_name() << ",\n";
+                writer << "                               " << args[2].get_name() << ",\n";
+                writer << "                               " << out[0].get_name() << ",\n";
+                writer << "                               " << query_shape[0] << ", "
+                       << value_shape[0] << ", " << query_shape[1] << ", " << value_shape[1]
+                       << ",\n";
+                writer << "                               " << emit_double(attention->get_scale())
+                       << ", "
+                       << (attention->get_is_key_transposed() ? "true" : "false") << ");\n";
+            }
 
-                    // end softmax outer loop(s)
-                    for (size_t d = 0; d < dims; ++d)
-                    {
-                        if (axes.find(d) == axes.end())
-                        {
-                            writer.block_end();
-                        }
-                    }
-                    writer.block_end();
-                }
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::LayerNorm)
+            {
+                auto layer_norm = static_cast<const ngraph::op::LayerNorm*>(node);
+                auto& input_shape = args[0].get_shape();
+                size_t begin = layer_norm->get_begin_norm_axis();
+                size_t rows = shape_size(Shape(input_shape.begin(), input_shape.begin() + begin));
+                size_t n = shape_size(Shape(input_shape.begin() + begin, input_shape.end()));
+
+                writer << "cpu::kernel::layer_norm_float32(" << args[0].get_name() << ",\n";
+                writer << "                                " << args[1].get_name() << ",\n";
+                writer << "                                " << args[2].get_name() << ",\n";
+                writer << "                                " << out[0].get_name() << ",\n";
+                writer << "                                " << rows << ", " << n << ", "
+                       << emit_double(layer_norm->get_eps_value()) << ");\n";
             }
 
             template <>
@@ -4762,6 +4858,85 @@ namespace ngraph
                        << "                      " << out[0].get_size() << ");\n";
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Quantize)
+            {
+                auto quantize = static_cast<const ngraph::op::Quantize*>(node);
+                writer << "reference::quantize<" << args[0].get_type() << ", "
+                       << out[0].get_type() << ">(" << args[0].get_name() << ",\n";
+                writer << "                   " << out[0].get_name() << ",\n";
+                writer << "                   " << out[0].get_size() << ",\n";
+                writer << "                   " << emit_double(quantize->get_scale()) << ",\n";
+                writer << "                   " << quantize->get_zero_point() << ");\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Dequantize)
+            {
+                auto dequantize = static_cast<const ngraph::op::Dequantize*>(node);
+                writer << "reference::dequantize<" << args[0].get_type() << ", "
+                       << out[0].get_type() << ">(" << args[0].get_name() << ",\n";
+                writer << "                     " << out[0].get_name() << ",\n";
+                writer << "                     " << out[0].get_size() << ",\n";
+                writer << "                     " << emit_double(dequantize->get_scale())
+                       << ",\n";
+                writer << "                     " << dequantize->get_zero_point() << ");\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedDot)
+            {
+                auto qdot = static_cast<const ngraph::op::QuantizedDot*>(node);
+                auto& input_shape = args[0].get_shape();
+                auto& weights_shape = args[1].get_shape();
+                size_t k = input_shape.back();
+                size_t m = shape_size(input_shape) / k;
+                size_t n = shape_size(weights_shape) / k;
+
+                writer << "cpu::kernel::quantized_dot<" << args[0].get_type() << ", "
+                       << args[1].get_type() << ", " << out[0].get_type() << ">("
+                       << args[0].get_name() << ",\n";
+                writer << "                           " << args[1].get_name() << ",\n";
+                writer << "                           " << out[0].get_name() << ",\n";
+                writer << "                           " << m << ", " << n << ", " << k << ",\n";
+                writer << "                           " << emit_double(qdot->get_input_scale())
+                       << ",\n";
+                writer << "                           " << qdot->get_input_zero_point() << ",\n";
+                writer << "                           " << emit_double(qdot->get_weights_scale())
+                       << ",\n";
+                writer << "                           " << emit_double(qdot->get_output_scale())
+                       << ",\n";
+                writer << "                           " << qdot->get_output_zero_point()
+                       << ");\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedConvolution)
+            {
+                auto qconv = static_cast<const ngraph::op::QuantizedConvolution*>(node);
+
+                writer << "cpu::kernel::quantized_convolution<" << args[0].get_type() << ", "
+                       << args[1].get_type() << ", " << out[0].get_type() << ">(\n";
+                writer.indent++;
+                writer << args[0].get_name() << ",\n";
+                writer << args[1].get_name() << ",\n";
+                writer << out[0].get_name() << ",\n";
+                writer << "{" << join(args[0].get_shape()) << "},\n";
+                writer << "{" << join(args[1].get_shape()) << "},\n";
+                writer << "{" << join(out[0].get_shape()) << "},\n";
+                writer << "{" << join(qconv->get_window_movement_strides()) << "},\n";
+                writer << "{" << join(qconv->get_window_dilation_strides()) << "},\n";
+                writer << "{" << join(qconv->get_padding_below()) << "},\n";
+                writer << "{" << join(qconv->get_padding_above()) << "},\n";
+                writer << "{" << join(qconv->get_data_dilation_strides()) << "},\n";
+                writer << emit_double(qconv->get_input_scale()) << ",\n";
+                writer << qconv->get_input_zero_point() << ",\n";
+                writer << emit_double(qconv->get_filters_scale()) << ",\n";
+                writer << emit_double(qconv->get_output_scale()) << ",\n";
+                writer << qconv->get_output_zero_point() << ");\n";
+                writer.indent--;
+            }
+
 #define TI(x) std::type_index(typeid(x))
 
             static std::string emit_infix_operator(const std::string& opname,
@@ -4800,14 +4975,42 @@ namespace ngraph
                 auto nege =
                     std::bind(emit_prefix_operator, std::string("-"), std::placeholders::_1);
                 auto sube = std::bind(emit_infix_operator, std::string("-"), std::placeholders::_1);
+                auto expe =
+                    std::bind(emit_function_call, std::string("exp"), std::placeholders::_1);
+                auto loge =
+                    std::bind(emit_function_call, std::string("log"), std::placeholders::_1);
+                auto tanhe =
+                    std::bind(emit_function_call, std::string("tanh"), std::placeholders::_1);
 
                 return std::unordered_map<
                     std::type_index,
                     std::function<std::string(const std::vector<std::string>&)>>{
                     {TI(ngraph::op::Abs), abse},
                     {TI(ngraph::op::Add), adde},
+                    {TI(ngraph::op::Exp), expe},
+                    {TI(ngraph::op::Log), loge},
                     {TI(ngraph::op::Negative), nege},
                     {TI(ngraph::op::Subtract), sube},
+                    {TI(ngraph::op::Tanh), tanhe},
+                };
+            }
+
+            // Overrides for f32 loop kernels in functions compiled with fast math
+            static std::unordered_map<std::type_index,
+                                      std::function<std::string(const std::vector<std::string>&)>>
+                initialize_fast_math_inline_emitters()
+            {
+                auto call = [](const std::string& name) {
+                    return std::bind(emit_function_call, name, std::placeholders::_1);
+                };
+
+                return std::unordered_map<
+                    std::type_index,
+                    std::function<std::string(const std::vector<std::string>&)>>{
+                    {TI(ngraph::op::Exp), call("cpu::kernel::fast_expf")},
+                    {TI(ngraph::op::Log), call("cpu::kernel::fast_logf")},
+                    {TI(ngraph::op::Tanh), call("cpu::kernel::fast_tanhf")},
+                    {TI(ngraph::op::Sigmoid), call("cpu::kernel::fast_sigmoidf")},
                 };
             }
 
@@ -4815,6 +5018,10 @@ namespace ngraph
                                       std::function<std::string(const std::vector<std::string>&)>>
                 inline_emitters = initialize_inline_emitters();
 
+            static std::unordered_map<std::type_index,
+                                      std::function<std::string(const std::vector<std::string>&)>>
+                fast_math_inline_emitters = initialize_fast_math_inline_emitters();
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::runtime::cpu::op::LoopKernel)
             {
@@ -4877,6 +5084,14 @@ namespace ngraph
                     }
 
                     const Node& n = *op;
+                    auto fast_emitter = fast_math_inline_emitters.find(TI(n));
+                    if (external_function->is_fast_math() &&
+                        op->get_element_type() == element::f32 &&
+                        fast_emitter != fast_math_inline_emitters.end())
+                    {
+                        writer << tmp << " = " << fast_emitter->second(sargs) << ";\n";
+                        continue;
+                    }
                     auto emitter = inline_emitters.at(TI(n));
                     writer << tmp << " = " << emitter(sargs) << ";\n";
                 }
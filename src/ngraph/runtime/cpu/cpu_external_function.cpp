@@ -50,6 +50,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -78,6 +79,9 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/quantized_dot.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -100,6 +104,7 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/combiner_lowering.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/cse.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
@@ -118,6 +123,7 @@
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
@@ -125,6 +131,8 @@
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/grouped_dot.hpp"
+#include "ngraph/runtime/cpu/op/layer_norm.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
@@ -133,17 +141,23 @@
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_attention_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_constant_reorder_folding.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_layer_norm_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_reduced_precision.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_shuffle_folding.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
+#include "ngraph/util.hpp"
 
 #ifdef NGRAPH_DISTRIBUTED
 #include "ngraph/op/allreduce.hpp"
+#include "ngraph/pass/allreduce_fusion.hpp"
 #endif
 
 using namespace std;
@@ -219,6 +233,9 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Parameter), &runtime::cpu::CPU_Emitter::nop},
     {TI(ngraph::op::Abs), &runtime::cpu::CPU_Emitter::emit<op::Abs>},
     {TI(ngraph::op::BatchDot), &runtime::cpu::CPU_Emitter::emit<op::BatchDot>},
+    {TI(ngraph::op::GroupedDot), &runtime::cpu::CPU_Emitter::emit<op::GroupedDot>},
+    {TI(ngraph::op::Attention), &runtime::cpu::CPU_Emitter::emit<op::Attention>},
+    {TI(ngraph::op::LayerNorm), &runtime::cpu::CPU_Emitter::emit<op::LayerNorm>},
     {TI(ngraph::op::Concat), &runtime::cpu::CPU_Emitter::emit<op::Concat>},
     {TI(ngraph::op::Divide), &runtime::cpu::CPU_Emitter::emit<op::Divide>},
     {TI(ngraph::op::Equal), &runtime::cpu::CPU_Emitter::emit<op::Equal>},
@@ -308,6 +325,11 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::SigmoidBackprop), &runtime::cpu::CPU_Emitter::emit<op::SigmoidBackprop>},
     {TI(ngraph::op::And), &runtime::cpu::CPU_Emitter::emit<op::And>},
     {TI(ngraph::op::Or), &runtime::cpu::CPU_Emitter::emit<op::Or>},
+    {TI(ngraph::op::Quantize), &runtime::cpu::CPU_Emitter::emit<op::Quantize>},
+    {TI(ngraph::op::Dequantize), &runtime::cpu::CPU_Emitter::emit<op::Dequantize>},
+    {TI(ngraph::op::QuantizedDot), &runtime::cpu::CPU_Emitter::emit<op::QuantizedDot>},
+    {TI(ngraph::op::QuantizedConvolution),
+     &runtime::cpu::CPU_Emitter::emit<op::QuantizedConvolution>},
     {TI(ngraph::runtime::cpu::op::LoopKernel),
      &runtime::cpu::CPU_Emitter::emit<runtime::cpu::op::LoopKernel>},
 };
@@ -326,6 +348,8 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_function_name(function->get_name())
     , m_is_built(false)
     , m_direct_execution(std::getenv("NGRAPH_DEX") != nullptr)
+    , m_profile_compile(std::getenv("NGRAPH_CPU_COMPILE_PROFILE") != nullptr)
+    , m_fast_math(std::getenv("NGRAPH_CPU_FAST_MATH") != nullptr)
 {
 }
 
@@ -343,10 +367,22 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
 
     ngraph::pass::Manager pass_manager;
+    if (m_profile_compile)
+    {
+        pass_manager.set_pass_profiling(true);
+    }
 
     //nv_cwi is required only by some frontends
     //in which case they should run this pass(CPUWorkspaceInsertion) explicitly
     NodeVector nv_cwi;
+#ifdef NGRAPH_DISTRIBUTED
+    const char* bucket_size = std::getenv("NGRAPH_ALLREDUCE_BUCKET_SIZE");
+    pass_manager.register_pass<ngraph::pass::AllReduceFusion>(
+        bucket_size ? std::stoul(bucket_size)
+                    : ngraph::pass::AllReduceFusion::s_default_bucket_size);
+#endif
+    pass_manager.register_pass<runtime::cpu::pass::CPUReducedPrecision>();
+    pass_manager.register_pass<ngraph::pass::CombinerLowering>();
     pass_manager.register_pass<ngraph::pass::NopElimination>();
     pass_manager.register_pass<runtime::cpu::pass::LSTMFusion>();
     pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
@@ -355,6 +391,9 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<runtime::cpu::pass::ConcatInputs>();
     pass_manager.register_pass<runtime::cpu::pass::CPUBatchFusion>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUAttentionFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPULayerNormFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUHorizontalFusion>();
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
@@ -362,11 +401,16 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<runtime::cpu::pass::CPULayout>(this);
     pass_manager.register_pass<runtime::cpu::pass::CPUPostLayoutOptimizations>();
     pass_manager.register_pass<runtime::cpu::pass::CPUShuffleFolding>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUConstantReorderFolding>();
     pass_manager.register_pass<ngraph::pass::ResultCopyElimination>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
     pass_manager.register_pass<ngraph::pass::MemoryLayout>(s_memory_pool_alignment, true);
     pass_manager.run_passes(m_function);
+    m_compile_profile.clear();
+    m_compile_profile.append(pass_manager.get_profile());
+    stopwatch phase_timer;
+    phase_timer.start();
 
     unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
@@ -380,10 +424,12 @@ void runtime::cpu::CPU_ExternalFunction::compile()
         R"(// Generated by the nGraph CPU backend
 #include <cmath>
 #include "ngraph/except.hpp"
-#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_eigen_utils.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/kernel/dot.hpp"
+#include "ngraph/runtime/cpu/kernel/fast_math.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/avg_pool.hpp"
@@ -400,6 +446,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/or.hpp"
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
 #include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -410,9 +457,12 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
 #include "ngraph/runtime/reference/select_and_scatter.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/strides.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph::runtime::cpu::eigen;
@@ -492,23 +542,49 @@ using namespace ngraph::runtime;
         writer << "\n";
     }
 
-    writer << "// Declare all constants\n";
+    // Constants are read through the call frame, which may point them at a copy on its NUMA
+    // node
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
         for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
         {
-            const ngraph::op::Constant* c = dynamic_cast<ngraph::op::Constant*>(node.get());
-            if (c)
+            if (dynamic_cast<ngraph::op::Constant*>(node.get()))
             {
-                m_active_constants.push_back(node);
                 shared_ptr<descriptor::TensorView> tv = node->get_outputs()[0].get_tensor_view();
                 string type = tv->get_tensor().get_element_type().c_type_string();
-                writer << "static " << type << "* " << tv->get_tensor().get_name() << " = (("
-                       << type << "*)(" << c->get_data_ptr() << "));\n";
-                m_variable_name_map[tv->get_tensor().get_name()] = tv->get_tensor().get_name();
+                stringstream ss;
+                ss << "((" << type << "*)(ctx->constants[" << add_active_constant(node)
+                   << "]))";
+                m_variable_name_map[tv->get_tensor().get_name()] = ss.str();
+            }
+        }
+    }
+
+#ifdef NGRAPH_DISTRIBUTED
+    // AllReduce is issued with MPI_Iallreduce and completed just before its result is first
+    // used so communication overlaps the remaining computation. The TBB flow graph does not
+    // preserve emission order, so it keeps the blocking form.
+    if (!m_use_tbb)
+    {
+        vector<string> request_inits;
+        for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
+        {
+            for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
+            {
+                if (dynamic_cast<ngraph::op::AllReduce*>(node.get()))
+                {
+                    m_allreduce_requests.insert({node.get(), request_inits.size()});
+                    request_inits.push_back("MPI_REQUEST_NULL");
+                }
             }
         }
+        if (!request_inits.empty())
+        {
+            writer << "static MPI_Request allreduce_requests[" << request_inits.size()
+                   << "] = {" << join(request_inits) << "};\n\n";
+        }
     }
+#endif
 
     writer << "// Declare all functions\n";
     for (shared_ptr<Function> f : pass_manager.get_state().get_functions())
@@ -720,6 +796,7 @@ using namespace ngraph::runtime;
             }
         }
 
+        set<const Node*> completed_allreduces;
         for (shared_ptr<Node> node : ordered_ops)
         {
             auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
@@ -729,6 +806,20 @@ using namespace ngraph::runtime;
             {
                 throw ngraph_error("Unhandled op during code generation : " + node->description());
             }
+
+            // Complete any non-blocking AllReduce whose result this node is the first to use
+            for (const descriptor::Input& input : node->get_inputs())
+            {
+                const Node* producer = input.get_output().get_node().get();
+                auto request = m_allreduce_requests.find(producer);
+                if (request != m_allreduce_requests.end() &&
+                    completed_allreduces.insert(producer).second)
+                {
+                    writer << "MPI_Wait(&allreduce_requests[" << request->second
+                           << "], MPI_STATUS_IGNORE);\n";
+                }
+            }
+
             vector<TensorViewWrapper> in;
             vector<string> node_input_names;
             vector<string> node_output_names;
@@ -966,21 +1057,29 @@ using namespace ngraph::runtime;
     string code = writer.get_code();
     out << code;
     out.close();
+    phase_timer.stop();
+    m_compile_profile.add_phase("emit", phase_timer.get_microseconds());
 
     m_compiler.reset(new codegen::Compiler());
     m_execution_engine.reset(new codegen::ExecutionEngine());
 
     m_compiler->set_precompiled_header_source(pch_header_source);
 
+    phase_timer.start();
     auto codegen_module = m_compiler->compile(code);
+    phase_timer.stop();
+    m_compile_profile.add_phase("compile", phase_timer.get_microseconds());
 
     if (codegen_module == nullptr)
     {
         throw runtime_error("function failed to compile");
     }
+    phase_timer.start();
     m_execution_engine->add_module(codegen_module);
     m_execution_engine->finalize();
     m_compiled_function = m_execution_engine->find_function<EntryPoint_t>(m_function_name);
+    phase_timer.stop();
+    m_compile_profile.add_phase("jit", phase_timer.get_microseconds());
 
     if (m_compiled_function == nullptr)
     {
@@ -1024,6 +1123,7 @@ using namespace ngraph::runtime;
     }
 
     m_is_compiled = true;
+    write_compile_profile();
     if (m_release_function)
     {
         release_function();
@@ -1040,16 +1140,24 @@ void runtime::cpu::CPU_ExternalFunction::build()
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
 
     ngraph::pass::Manager pass_manager;
+    if (m_profile_compile)
+    {
+        pass_manager.set_pass_profiling(true);
+    }
 
     //nv_cwi is required only by some frontends
     //in which case they should run this pass(CPUWorkspaceInsertion) explicitly
     NodeVector nv_cwi;
+    pass_manager.register_pass<runtime::cpu::pass::CPUReducedPrecision>();
+    pass_manager.register_pass<ngraph::pass::CombinerLowering>();
     pass_manager.register_pass<ngraph::pass::NopElimination>();
     pass_manager.register_pass<runtime::cpu::pass::LSTMFusion>();
     pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
     pass_manager.register_pass<runtime::cpu::pass::ConcatInputs>();
     pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUAttentionFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPULayerNormFusion>();
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
@@ -1057,11 +1165,16 @@ void runtime::cpu::CPU_ExternalFunction::build()
     pass_manager.register_pass<runtime::cpu::pass::CPULayout>(this);
     pass_manager.register_pass<runtime::cpu::pass::CPUPostLayoutOptimizations>();
     pass_manager.register_pass<runtime::cpu::pass::CPUShuffleFolding>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUConstantReorderFolding>();
     pass_manager.register_pass<ngraph::pass::ResultCopyElimination>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
     pass_manager.register_pass<ngraph::pass::MemoryLayout>(s_memory_pool_alignment, true);
     pass_manager.run_passes(m_function);
+    m_compile_profile.clear();
+    m_compile_profile.append(pass_manager.get_profile());
+    stopwatch phase_timer;
+    phase_timer.start();
 
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
@@ -1145,11 +1258,10 @@ void runtime::cpu::CPU_ExternalFunction::build()
     // Constants
     for (auto& node : m_function->get_ordered_ops())
     {
-        const auto c = dynamic_cast<ngraph::op::Constant*>(node.get());
-        if (c)
+        if (dynamic_cast<ngraph::op::Constant*>(node.get()))
         {
             auto tv = node->get_outputs()[0].get_tensor_view();
-            tensor_data[tv->get_tensor().get_name()] = const_cast<void*>(c->get_data_ptr());
+            constants_index[tv->get_tensor().get_name()] = add_active_constant(node);
         }
     }
 
@@ -1186,6 +1298,11 @@ void runtime::cpu::CPU_ExternalFunction::build()
                 static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
         }
 
+        for (const auto& p : constants_index)
+        {
+            tensor_data[p.first] = ctx->constants[p.second];
+        }
+
         for (const auto& p : function_input_index)
         {
             tensor_data[p.first] = inputs[p.second];
@@ -1203,6 +1320,9 @@ void runtime::cpu::CPU_ExternalFunction::build()
     };
 
     m_is_built = true;
+    phase_timer.stop();
+    m_compile_profile.add_phase("build", phase_timer.get_microseconds());
+    write_compile_profile();
 
     if (m_release_function)
     {
@@ -1211,7 +1331,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
 }
 
 shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
-    runtime::cpu::CPU_ExternalFunction::make_call_frame()
+    runtime::cpu::CPU_ExternalFunction::make_call_frame(const NumaPlacement& placement,
+                                                        const PagePolicy& pages)
 {
     if (!m_is_compiled && !m_direct_execution)
     {
@@ -1223,8 +1344,54 @@ shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
         build();
     }
 
-    return make_shared<ngraph::runtime::cpu::CPU_CallFrame>(shared_from_this(),
-                                                            m_compiled_function);
+    return make_shared<ngraph::runtime::cpu::CPU_CallFrame>(
+        shared_from_this(), m_compiled_function, placement, pages);
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::add_active_constant(const shared_ptr<Node>& node)
+{
+    auto c = static_pointer_cast<ngraph::op::Constant>(node);
+    m_constant_data.push_back(c->share_data());
+    m_constant_sizes.push_back(shape_size(c->get_shape()) * c->get_element_type().size());
+    m_constant_ptrs.push_back(const_cast<void*>(c->get_data_ptr()));
+    m_constant_index[node.get()] = m_constant_ptrs.size() - 1;
+    return m_constant_ptrs.size() - 1;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_constant_bytes() const
+{
+    size_t bytes = 0;
+    for (size_t size : m_constant_sizes)
+    {
+        bytes += size;
+    }
+    return bytes;
+}
+
+shared_ptr<runtime::cpu::NumaConstantReplica>
+    runtime::cpu::CPU_ExternalFunction::get_constant_replica(int node,
+                                                             bool shared,
+                                                             const PagePolicy& pages)
+{
+    vector<pair<const void*, size_t>> constants;
+    for (size_t i = 0; i < m_constant_ptrs.size(); i++)
+    {
+        constants.emplace_back(m_constant_ptrs[i], m_constant_sizes[i]);
+    }
+    if (!shared)
+    {
+        return make_shared<NumaConstantReplica>(constants, node, pages);
+    }
+
+    lock_guard<mutex> lock(m_constant_replicas_mutex);
+    auto& cached = m_constant_replicas[make_pair(node, pages.huge_pages)];
+    shared_ptr<NumaConstantReplica> replica = cached.lock();
+    if (!replica)
+    {
+        replica = make_shared<NumaConstantReplica>(constants, node, pages);
+        cached = replica;
+    }
+    return replica;
 }
 
 const runtime::cpu::LayoutDescriptorPtrs&
@@ -1239,6 +1406,17 @@ const runtime::cpu::LayoutDescriptorPtrs&
     return result_layout_descriptors;
 }
 
+void runtime::cpu::CPU_ExternalFunction::write_compile_profile()
+{
+    if (m_profile_compile)
+    {
+        file_util::make_directory(s_output_dir);
+        ofstream out(
+            file_util::path_join(s_output_dir, m_function_name + "_compile_profile.json"));
+        m_compile_profile.write_json(out);
+    }
+}
+
 void runtime::cpu::CPU_ExternalFunction::emit_debug_function_entry(
     codegen::CodeWriter& writer,
     Node* node,
@@ -20,6 +20,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -30,8 +31,10 @@
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/codegen/execution_engine.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/pass/compile_profile.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
 
@@ -76,7 +79,9 @@ namespace ngraph
                 CPU_ExternalFunction(const std::shared_ptr<ngraph::Function>& function,
                                      bool release_function = true);
                 ~CPU_ExternalFunction();
-                std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> make_call_frame();
+                std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
+                    make_call_frame(const NumaPlacement& placement = NumaPlacement(),
+                                    const PagePolicy& pages = PagePolicy());
 
                 const LayoutDescriptorPtrs& get_parameter_layout_descriptors();
                 const LayoutDescriptorPtrs& get_result_layout_descriptors();
@@ -85,6 +90,21 @@ namespace ngraph
                     return m_memory_buffer_sizes;
                 }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
+                /// Data of every constant, indexed like CPURuntimeContext::constants
+                const std::vector<void*>& get_constant_ptrs() const { return m_constant_ptrs; }
+                /// Total size of the constants
+                size_t get_constant_bytes() const;
+                size_t get_constant_index(const Node* node) const
+                {
+                    return m_constant_index.at(node);
+                }
+                /// Copy of the constants on a NUMA node. A shared copy is handed to every
+                /// caller asking for one on the same node with the same kind of huge pages,
+                /// and freed with the last of them.
+                std::shared_ptr<NumaConstantReplica>
+                    get_constant_replica(int node,
+                                         bool shared,
+                                         const PagePolicy& pages = PagePolicy());
                 const std::unique_ptr<MKLDNNEmitter>& get_mkldnn_emitter() const
                 {
                     return m_mkldnn_emitter;
@@ -106,6 +126,26 @@ namespace ngraph
                     return executor;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                /// Index into the generated allreduce_requests array for every AllReduce that
+                /// is emitted as a non-blocking MPI_Iallreduce
+                const std::unordered_map<const Node*, size_t>& get_allreduce_requests() const
+                {
+                    return m_allreduce_requests;
+                }
+                /// Phases of the last compile or build: each pass, then code emission and the
+                /// JIT steps, or the DEX functor build
+                const ngraph::pass::CompileProfile& get_compile_profile() const
+                {
+                    return m_compile_profile;
+                }
+                /// Records graph sizes after each pass and writes the profile as JSON next to
+                /// the generated code. Defaults to on when NGRAPH_CPU_COMPILE_PROFILE is set.
+                void set_compile_profiling(bool new_state) { m_profile_compile = new_state; }
+                /// Computes f32 Exp, Log, Tanh and Sigmoid with the vectorized approximations in
+                /// kernel/fast_math.hpp. Must be set before compiling. Defaults to on when
+                /// NGRAPH_CPU_FAST_MATH is set.
+                void set_fast_math(bool new_state) { m_fast_math = new_state; }
+                bool is_fast_math() const { return m_fast_math; }
             protected:
                 void build();
                 void compile();
@@ -130,7 +170,9 @@ namespace ngraph
                     const std::unordered_map<const Node*, std::string>& node_cache);
                 std::string emit_op_as_function(const Node&, const std::string& function_name);
                 std::string strip_comments(const std::string&);
+                void write_compile_profile();
                 void release_function() { m_function = nullptr; }
+                size_t add_active_constant(const std::shared_ptr<Node>& node);
                 std::shared_ptr<ngraph::Function> m_function;
                 bool m_release_function;
                 bool m_is_compiled;
@@ -141,12 +183,19 @@ namespace ngraph
                 bool m_use_tbb;
 
                 std::unordered_map<std::string, std::string> m_variable_name_map;
+                std::unordered_map<const Node*, size_t> m_allreduce_requests;
                 std::map<std::string, size_t> m_name_index_map;
 
-                // Because we are directly accessing the constant data stored in the
-                // Constant ops we need to keep a list of shared_ptr to each Constant
-                // so they don't get freed before we are done with them
-                std::vector<std::shared_ptr<Node>> m_active_constants;
+                // Constant data is moved to the ConstantStore and read from there, so these
+                // handles keep it alive after the Constant ops are gone
+                std::vector<std::shared_ptr<const void>> m_constant_data;
+                std::vector<size_t> m_constant_sizes;
+                std::vector<void*> m_constant_ptrs;
+                std::unordered_map<const Node*, size_t> m_constant_index;
+                std::map<std::pair<int, PagePolicy::HugePages>,
+                         std::weak_ptr<NumaConstantReplica>>
+                    m_constant_replicas;
+                std::mutex m_constant_replicas_mutex;
 
                 LayoutDescriptorPtrs parameter_layout_descriptors;
                 LayoutDescriptorPtrs result_layout_descriptors;
@@ -162,9 +211,13 @@ namespace ngraph
                     executor;
                 std::unordered_map<std::string, void*> tensor_data;
                 std::unordered_map<std::string, size_t> intermediates_offsets;
+                std::unordered_map<std::string, size_t> constants_index;
                 std::unordered_map<std::string, size_t> function_input_index, function_output_index;
                 bool m_is_built;
                 bool m_direct_execution;
+                bool m_profile_compile;
+                bool m_fast_math;
+                ngraph::pass::CompileProfile m_compile_profile;
             };
         }
     }
@@ -88,6 +88,21 @@ namespace cblas
                      float* C,
                      const int64_t ldc);
 
+    void cblas_dgemm(const Layout layout,
+                     const Transpose TransA,
+                     const Transpose TransB,
+                     const int64_t M,
+                     const int64_t N,
+                     const int64_t K,
+                     const double alpha,
+                     const double* A,
+                     const int64_t lda,
+                     const double* B,
+                     const int64_t ldb,
+                     const double beta,
+                     double* C,
+                     const int64_t ldc);
+
     void cblas_sgemm_batch(const Layout Layout,
                            const Transpose* transa_array,
                            const Transpose* transb_array,
@@ -127,6 +142,8 @@ namespace ngraph
     class Shape;
     class AxisSet;
     class AxisVector;
+    class CoordinateDiff;
+    class Strides;
 
     namespace runtime
     {
@@ -175,6 +192,78 @@ namespace ngraph
                                                const Shape& output_shape,
                                                const AxisSet& reduction_axes);
 
+                void softmax_float32(float* input,
+                                     float* output,
+                                     const Shape& shape,
+                                     const AxisSet& axes);
+
+                void softmax_float64(double* input,
+                                     double* output,
+                                     const Shape& shape,
+                                     const AxisSet& axes);
+
+                void fast_exp_float32(float* input, float* output, size_t count);
+                void fast_log_float32(float* input, float* output, size_t count);
+                void fast_tanh_float32(float* input, float* output, size_t count);
+                void fast_sigmoid_float32(float* input, float* output, size_t count);
+
+                void attention_float32(float* query,
+                                       float* key,
+                                       float* value,
+                                       float* output,
+                                       size_t m,
+                                       size_t n,
+                                       size_t d,
+                                       size_t dv,
+                                       float scale,
+                                       bool key_transposed);
+
+                void layer_norm_float32(float* input,
+                                        float* gamma,
+                                        float* beta,
+                                        float* output,
+                                        size_t rows,
+                                        size_t n,
+                                        double eps);
+
+                void convolution_float32(float* data,
+                                         float* filters,
+                                         float* out,
+                                         const Shape& data_shape,
+                                         const Shape& filters_shape,
+                                         const Shape& out_shape,
+                                         const Strides& window_movement_strides,
+                                         const Strides& window_dilation_strides,
+                                         const CoordinateDiff& padding_below,
+                                         const CoordinateDiff& padding_above,
+                                         const Strides& data_dilation_strides,
+                                         size_t batch_axis_data,
+                                         size_t input_channel_axis_data,
+                                         size_t input_channel_axis_filters,
+                                         size_t output_channel_axis_filters,
+                                         size_t batch_axis_result,
+                                         size_t output_channel_axis_result,
+                                         bool rotate_filter);
+
+                void convolution_float64(double* data,
+                                         double* filters,
+                                         double* out,
+                                         const Shape& data_shape,
+                                         const Shape& filters_shape,
+                                         const Shape& out_shape,
+                                         const Strides& window_movement_strides,
+                                         const Strides& window_dilation_strides,
+                                         const CoordinateDiff& padding_below,
+                                         const CoordinateDiff& padding_above,
+                                         const Strides& data_dilation_strides,
+                                         size_t batch_axis_data,
+                                         size_t input_channel_axis_data,
+                                         size_t input_channel_axis_filters,
+                                         size_t output_channel_axis_filters,
+                                         size_t batch_axis_result,
+                                         size_t output_channel_axis_result,
+                                         bool rotate_filter);
+
                 void reshape_3d_3d_float32(float* input,
                                            float* output,
                                            const Shape& input_shape,
@@ -186,6 +275,68 @@ namespace ngraph
                                            const Shape& input_shape,
                                            const AxisVector& input_axis_order,
                                            const Shape& output_shape);
+
+                // Kernels on f16 and bf16 storage, instantiated for ngraph::float16 and
+                // ngraph::bfloat16. Elements are widened to f32 in registers, or in cache sized
+                // tiles for dot, and each result is rounded once when it is stored.
+                template <typename ElementType>
+                void widening_add(void* input0, void* input1, void* output, size_t count);
+                template <typename ElementType>
+                void widening_multiply(void* input0, void* input1, void* output, size_t count);
+                template <typename ElementType>
+                void widening_abs(void* input, void* output, size_t count);
+                template <typename ElementType>
+                void widening_ceil(void* input, void* output, size_t count);
+                template <typename ElementType>
+                void widening_relu(void* input, void* output, size_t count);
+                template <typename ElementType>
+                void widening_exp(void* input, void* output, size_t count);
+                template <typename ElementType>
+                void widening_log(void* input, void* output, size_t count);
+                template <typename ElementType>
+                void widening_tanh(void* input, void* output, size_t count);
+                template <typename ElementType>
+                void widening_sigmoid(void* input, void* output, size_t count);
+                template <typename ElementType>
+                void widening_dot(void* arg0, void* arg1, void* out, size_t m, size_t n, size_t k);
+
+                // Kernels on int8 data, instantiated for i8 and u8 inputs, i8 weights and f32,
+                // i8 and u8 outputs. The products accumulate in i32 and are requantized as they
+                // are stored.
+                template <typename InputElementType,
+                          typename WeightsElementType,
+                          typename OutputElementType>
+                void quantized_dot(void* input,
+                                   void* weights,
+                                   void* output,
+                                   size_t m,
+                                   size_t n,
+                                   size_t k,
+                                   double input_scale,
+                                   int64_t input_zero_point,
+                                   double weights_scale,
+                                   double output_scale,
+                                   int64_t output_zero_point);
+
+                template <typename InputElementType,
+                          typename WeightsElementType,
+                          typename OutputElementType>
+                void quantized_convolution(void* data_batch,
+                                           void* filters,
+                                           void* output,
+                                           const Shape& data_batch_shape,
+                                           const Shape& filters_shape,
+                                           const Shape& out_shape,
+                                           const Strides& window_movement_strides,
+                                           const Strides& window_dilation_strides,
+                                           const CoordinateDiff& padding_below,
+                                           const CoordinateDiff& padding_above,
+                                           const Strides& data_dilation_strides,
+                                           double input_scale,
+                                           int64_t input_zero_point,
+                                           double filters_scale,
+                                           double output_scale,
+                                           int64_t output_zero_point);
             }
         }
     }
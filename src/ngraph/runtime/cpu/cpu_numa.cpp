@@ -0,0 +1,466 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dlfcn.h>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sched.h>
+#include <sstream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/cpu/cpu_threading.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Constants are packed at cache line boundaries, which covers every vector load the kernels
+// issue
+static const size_t s_constant_alignment = 64;
+
+// sysfs lists such as "0-3,8-11"
+static vector<size_t> read_id_list(const string& path)
+{
+    vector<size_t> ids;
+    ifstream list(path);
+    string range;
+    while (getline(list, range, ','))
+    {
+        size_t first;
+        size_t last;
+        char dash;
+        istringstream parser(range);
+        if (!(parser >> first))
+        {
+            continue;
+        }
+        last = (parser >> dash >> last) ? last : first;
+        for (size_t id = first; id <= last; id++)
+        {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+
+static const vector<size_t>& online_cpus()
+{
+    static const vector<size_t> cpus = []() {
+        vector<size_t> online = read_id_list("/sys/devices/system/cpu/online");
+        if (online.empty())
+        {
+            for (size_t cpu = 0; cpu < max(thread::hardware_concurrency(), 1u); cpu++)
+            {
+                online.push_back(cpu);
+            }
+        }
+        return online;
+    }();
+    return cpus;
+}
+
+// CPUs of each node, indexed by node id
+static const vector<vector<size_t>>& host_topology()
+{
+    static const vector<vector<size_t>> topology = []() {
+        vector<vector<size_t>> nodes;
+        for (size_t node : read_id_list("/sys/devices/system/node/online"))
+        {
+            nodes.resize(max(nodes.size(), node + 1));
+            nodes[node] =
+                read_id_list("/sys/devices/system/node/node" + to_string(node) + "/cpulist");
+        }
+        if (nodes.empty())
+        {
+            nodes.push_back(online_cpus());
+        }
+        return nodes;
+    }();
+    return topology;
+}
+
+static vector<size_t> simulated_node_cpus(size_t node, size_t node_count)
+{
+    const vector<size_t>& cpus = online_cpus();
+    if (cpus.size() < node_count)
+    {
+        // More nodes than CPUs; the nodes share them
+        return {cpus[node % cpus.size()]};
+    }
+    return vector<size_t>(cpus.begin() + node * cpus.size() / node_count,
+                          cpus.begin() + (node + 1) * cpus.size() / node_count);
+}
+
+static atomic<size_t>& simulated_node_count()
+{
+    static atomic<size_t> count{[]() -> size_t {
+        const char* env = getenv("NGRAPH_CPU_SIMULATE_NUMA_NODES");
+        return env ? strtoul(env, nullptr, 10) : 0;
+    }()};
+    return count;
+}
+
+size_t runtime::cpu::get_numa_node_count()
+{
+    size_t simulated = simulated_node_count().load();
+    return simulated ? simulated : host_topology().size();
+}
+
+vector<size_t> runtime::cpu::get_numa_node_cpus(int node)
+{
+    size_t simulated = simulated_node_count().load();
+    size_t node_count = simulated ? simulated : host_topology().size();
+    if (node < 0 || static_cast<size_t>(node) >= node_count)
+    {
+        return {};
+    }
+    return simulated ? simulated_node_cpus(node, simulated) : host_topology()[node];
+}
+
+void runtime::cpu::simulate_numa_nodes(size_t nodes)
+{
+    simulated_node_count() = nodes;
+    reset_numa_thread_pools();
+}
+
+bool runtime::cpu::is_numa_simulated()
+{
+    return simulated_node_count().load() != 0;
+}
+
+// Asks for the pages of the range to come from node. Errors are ignored: without NUMA support
+// in the kernel first touch still puts the pages on the right node.
+static void prefer_node(void* address, size_t length, int node)
+{
+#ifdef SYS_mbind
+    const int mpol_preferred = 1;
+    const size_t bits = 8 * sizeof(unsigned long);
+    vector<unsigned long> mask(node / bits + 1);
+    mask[node / bits] |= 1UL << (node % bits);
+    syscall(SYS_mbind, address, length, mpol_preferred, mask.data(), mask.size() * bits + 1, 0);
+#endif
+}
+
+static size_t huge_page_size()
+{
+    static const size_t size = []() -> size_t {
+        ifstream meminfo("/proc/meminfo");
+        string line;
+        while (getline(meminfo, line))
+        {
+            size_t kilobytes;
+            if (sscanf(line.c_str(), "Hugepagesize: %zu kB", &kilobytes) == 1)
+            {
+                return kilobytes << 10;
+            }
+        }
+        return 2 << 20;
+    }();
+    return size;
+}
+
+static char* map_anonymous(size_t length, int flags)
+{
+    void* mapping =
+        mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+    return mapping == MAP_FAILED ? nullptr : static_cast<char*>(mapping);
+}
+
+// Transparent huge pages only back ranges aligned to the huge page size, so map with slack
+// and unmap what lies outside the aligned range
+static char* map_aligned(size_t length, size_t alignment)
+{
+    char* mapping = map_anonymous(length + alignment, 0);
+    if (mapping == nullptr)
+    {
+        return nullptr;
+    }
+    size_t head = (alignment - reinterpret_cast<size_t>(mapping) % alignment) % alignment;
+    size_t tail = alignment - head;
+    if (head > 0)
+    {
+        munmap(mapping, head);
+    }
+    if (tail > 0)
+    {
+        munmap(mapping + head + length, tail);
+    }
+    return mapping + head;
+}
+
+static cpu_set_t make_cpu_set(const vector<size_t>& cpus)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (size_t cpu : cpus)
+    {
+        if (cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return set;
+}
+
+static void touch_pages(char* buffer, size_t length, size_t page_size)
+{
+    for (size_t offset = 0; offset < length; offset += page_size)
+    {
+        buffer[offset] = 0;
+    }
+}
+
+runtime::cpu::NumaBuffer::NumaBuffer(size_t byte_size, int node, const PagePolicy& pages)
+    : m_buffer(nullptr)
+    , m_byte_size(byte_size)
+    , m_mapped_size(0)
+    , m_node(node)
+    , m_huge_pages(PagePolicy::HugePages::None)
+{
+    if (node >= 0 && get_numa_node_cpus(node).empty())
+    {
+        throw ngraph_error("NUMA node " + to_string(node) + " has no CPUs");
+    }
+    if (byte_size == 0)
+    {
+        return;
+    }
+
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    bool huge = pages.huge_pages != PagePolicy::HugePages::None &&
+                byte_size >= pages.huge_page_threshold;
+    size_t granule = huge ? huge_page_size() : page_size;
+    m_mapped_size = (byte_size + granule - 1) / granule * granule;
+
+#ifdef MAP_HUGETLB
+    if (huge && pages.huge_pages == PagePolicy::HugePages::Explicit)
+    {
+        m_buffer = map_anonymous(m_mapped_size, MAP_HUGETLB);
+        if (m_buffer != nullptr)
+        {
+            m_huge_pages = PagePolicy::HugePages::Explicit;
+            page_size = granule;
+        }
+    }
+#endif
+    if (m_buffer == nullptr)
+    {
+        // Transparent huge pages may still fall back to small ones, so the touch loops below
+        // keep the small page stride
+        m_buffer = huge ? map_aligned(m_mapped_size, granule) : map_anonymous(m_mapped_size, 0);
+        if (m_buffer == nullptr)
+        {
+            throw ngraph_error("Unable to allocate " + to_string(byte_size) + " bytes");
+        }
+#ifdef MADV_HUGEPAGE
+        if (huge && madvise(m_buffer, m_mapped_size, MADV_HUGEPAGE) == 0)
+        {
+            m_huge_pages = PagePolicy::HugePages::Transparent;
+        }
+#endif
+    }
+
+    if (node >= 0)
+    {
+        if (!is_numa_simulated())
+        {
+            prefer_node(m_buffer, m_mapped_size, node);
+        }
+        // Only the toucher needs to run on the node, so pin it rather than bind a whole call
+        cpu_set_t cpus = make_cpu_set(get_numa_node_cpus(node));
+        thread first_touch([this, cpus, page_size]() {
+            sched_setaffinity(0, sizeof(cpus), &cpus);
+            touch_pages(m_buffer, m_mapped_size, page_size);
+        });
+        first_touch.join();
+    }
+    else if (pages.prefault)
+    {
+        touch_pages(m_buffer, m_mapped_size, page_size);
+    }
+}
+
+runtime::cpu::NumaBuffer::~NumaBuffer()
+{
+    if (m_buffer != nullptr)
+    {
+        munmap(m_buffer, m_mapped_size);
+    }
+}
+
+static size_t padded_size(size_t size)
+{
+    return (size + s_constant_alignment - 1) / s_constant_alignment * s_constant_alignment;
+}
+
+static size_t packed_size(const vector<pair<const void*, size_t>>& constants)
+{
+    size_t size = 0;
+    for (auto& constant : constants)
+    {
+        size += padded_size(constant.second);
+    }
+    return size;
+}
+
+runtime::cpu::NumaConstantReplica::NumaConstantReplica(
+    const vector<pair<const void*, size_t>>& constants, int node, const PagePolicy& pages)
+    : m_buffer(packed_size(constants), node, pages)
+{
+    size_t offset = 0;
+    for (auto& constant : constants)
+    {
+        void* copy = m_buffer.get_ptr(offset);
+        if (constant.second > 0)
+        {
+            memcpy(copy, constant.first, constant.second);
+        }
+        m_constant_ptrs.push_back(copy);
+        offset += padded_size(constant.second);
+    }
+}
+
+static mutex s_node_pools_mutex;
+static map<int, unique_ptr<runtime::cpu::eigen::ThreadPool>> s_node_pools;
+// Bumped when the pools are dropped, which invalidates the per-thread caches of their devices
+static atomic<size_t> s_node_pools_generation{0};
+
+// The device of the node's pool: the configured number of workers, at most one per CPU of the
+// node, pinned to those CPUs. Each thread caches the devices it has used, so binding a call
+// takes no lock once the pool exists.
+static Eigen::ThreadPoolDevice* get_node_thread_pool_device(int node, const vector<size_t>& cpus)
+{
+    static thread_local size_t t_generation = 0;
+    static thread_local vector<Eigen::ThreadPoolDevice*> t_devices;
+    size_t generation = s_node_pools_generation.load();
+    if (t_generation != generation)
+    {
+        t_devices.clear();
+        t_generation = generation;
+    }
+    if (static_cast<size_t>(node) < t_devices.size() && t_devices[node])
+    {
+        return t_devices[node];
+    }
+
+    size_t num_threads = min(runtime::cpu::get_threading_config().num_threads, cpus.size());
+    lock_guard<mutex> lock(s_node_pools_mutex);
+    unique_ptr<runtime::cpu::eigen::ThreadPool>& pool = s_node_pools[node];
+    if (!pool)
+    {
+        pool.reset(new runtime::cpu::eigen::ThreadPool(static_cast<int>(num_threads), cpus));
+    }
+    t_devices.resize(max(t_devices.size(), static_cast<size_t>(node) + 1));
+    t_devices[node] = &pool->get_device();
+    return t_devices[node];
+}
+
+void runtime::cpu::reset_numa_thread_pools()
+{
+    lock_guard<mutex> lock(s_node_pools_mutex);
+    s_node_pools.clear();
+    s_node_pools_generation++;
+}
+
+// Node the calling thread's OpenMP team was last moved to, -1 when it was not moved
+static thread_local int t_openmp_team_node = -1;
+
+// An OpenMP team belongs to the thread that starts its parallel regions. A region started
+// through GOMP_parallel, which libgomp, the LLVM runtime and Intel's runtime all export, moves
+// every thread of the team to the CPUs. Looking it up keeps this file from linking against a
+// particular runtime; without one loaded there is no team to move.
+static void move_openmp_team(const cpu_set_t& cpus, int node)
+{
+    if (t_openmp_team_node == node)
+    {
+        return;
+    }
+    using Parallel = void (*)(void (*)(void*), void*, unsigned, unsigned);
+    static Parallel parallel = reinterpret_cast<Parallel>(dlsym(RTLD_DEFAULT, "GOMP_parallel"));
+    if (parallel)
+    {
+        parallel(
+            [](void* data) {
+                sched_setaffinity(0, sizeof(cpu_set_t), static_cast<const cpu_set_t*>(data));
+            },
+            const_cast<cpu_set_t*>(&cpus),
+            0,
+            0);
+    }
+    t_openmp_team_node = node;
+}
+
+runtime::cpu::NumaNodeBinding::NumaNodeBinding(int node)
+{
+    vector<size_t> cpus = get_numa_node_cpus(node);
+    cpu_set_t previous;
+    if (sched_getaffinity(0, sizeof(previous), &previous) != 0)
+    {
+        return;
+    }
+    if (cpus.empty())
+    {
+        // Give a team moved by an earlier call the thread's own CPUs back
+        move_openmp_team(previous, -1);
+        return;
+    }
+    cpu_set_t target = make_cpu_set(cpus);
+    if (sched_setaffinity(0, sizeof(target), &target) != 0)
+    {
+        return;
+    }
+    for (size_t cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    {
+        if (CPU_ISSET(cpu, &previous))
+        {
+            m_saved_cpus.push_back(cpu);
+        }
+    }
+    move_openmp_team(target, node);
+    m_saved_device = eigen::set_thread_pool_device(get_node_thread_pool_device(node, cpus));
+    m_device_selected = true;
+}
+
+runtime::cpu::NumaNodeBinding::~NumaNodeBinding()
+{
+    if (m_device_selected)
+    {
+        eigen::set_thread_pool_device(m_saved_device);
+    }
+    if (m_saved_cpus.empty())
+    {
+        return;
+    }
+    cpu_set_t previous;
+    CPU_ZERO(&previous);
+    for (size_t cpu : m_saved_cpus)
+    {
+        CPU_SET(cpu, &previous);
+    }
+    sched_setaffinity(0, sizeof(previous), &previous);
+}
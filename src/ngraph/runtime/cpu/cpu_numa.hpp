@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Eigen
+{
+    struct ThreadPoolDevice;
+}
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Where a call frame keeps its memory and runs
+            struct NumaPlacement
+            {
+                /// NUMA node the temporaries and constants are placed on and the threads of a
+                /// call run on, as NumaNodeBinding describes; -1 leaves placement to the
+                /// operating system
+                int node = -1;
+                /// Call frames of one function on the same node read a single replica of the
+                /// constants instead of one each
+                bool share_constants = true;
+            };
+
+            /// \brief How the pages behind temporary pools and constant replicas are backed
+            struct PagePolicy
+            {
+                enum class HugePages
+                {
+                    None,
+                    /// Transparent huge pages, requested with madvise(MADV_HUGEPAGE)
+                    Transparent,
+                    /// Pages from the hugetlbfs pool (MAP_HUGETLB), or transparent ones when
+                    /// the pool cannot cover the buffer
+                    Explicit
+                };
+                HugePages huge_pages = HugePages::None;
+                /// Buffers smaller than this keep normal pages
+                size_t huge_page_threshold = 2 << 20;
+                /// Fault every page in when the call frame is created instead of during the
+                /// first call. Buffers bound to a NUMA node are always faulted in up front.
+                bool prefault = false;
+            };
+
+            /// Number of NUMA nodes. Read from /sys/devices/system/node; a host without it
+            /// counts as one node holding every CPU.
+            size_t get_numa_node_count();
+
+            /// The CPUs of a NUMA node, empty if the node is unknown
+            std::vector<size_t> get_numa_node_cpus(int node);
+
+            /// Splits the online CPUs into `nodes` consecutive groups and reports them as NUMA
+            /// nodes, so placement can be exercised on a single socket host; 0 returns to the
+            /// real topology. The environment variable NGRAPH_CPU_SIMULATE_NUMA_NODES sets the
+            /// initial value. Memory on simulated nodes is only placed by first touch.
+            void simulate_numa_nodes(size_t nodes);
+            bool is_numa_simulated();
+
+            /// \brief Page aligned memory whose pages are faulted in on one NUMA node
+            ///
+            /// The mapping is bound to the node where the kernel supports it, and in any case
+            /// every page is first touched by a thread running on the node's CPUs, so the
+            /// memory lands there before any kernel writes to it. With node -1 nothing is
+            /// touched up front, unless the page policy asks for it, and pages go to
+            /// whichever thread writes them first.
+            class NumaBuffer
+            {
+            public:
+                NumaBuffer(size_t byte_size, int node, const PagePolicy& pages = PagePolicy());
+                ~NumaBuffer();
+                NumaBuffer(const NumaBuffer&) = delete;
+                NumaBuffer& operator=(const NumaBuffer&) = delete;
+
+                size_t size() const { return m_byte_size; }
+                int get_node() const { return m_node; }
+                /// The kind of huge pages the buffer obtained, which can fall short of the
+                /// policy when the system has none to give
+                PagePolicy::HugePages get_huge_pages() const { return m_huge_pages; }
+                void* get_ptr(size_t offset) const { return m_buffer + offset; }
+                void* get_ptr() const { return m_buffer; }
+            private:
+                char* m_buffer;
+                size_t m_byte_size;
+                size_t m_mapped_size;
+                int m_node;
+                PagePolicy::HugePages m_huge_pages;
+            };
+
+            /// \brief Copies of a function's constants packed into one buffer on a NUMA node
+            class NumaConstantReplica
+            {
+            public:
+                /// constants holds the data pointer and byte size of each constant
+                NumaConstantReplica(const std::vector<std::pair<const void*, size_t>>& constants,
+                                    int node,
+                                    const PagePolicy& pages = PagePolicy());
+
+                /// Pointers to the copies, in the order the constants were given
+                const std::vector<void*>& get_constant_ptrs() const { return m_constant_ptrs; }
+                size_t size() const { return m_buffer.size(); }
+                const NumaBuffer& get_buffer() const { return m_buffer; }
+            private:
+                NumaBuffer m_buffer;
+                std::vector<void*> m_constant_ptrs;
+            };
+
+            /// Drops the worker pools of the NUMA nodes so they are rebuilt from the current
+            /// threading configuration and topology. No call may be in flight.
+            void reset_numa_thread_pools();
+
+            /// Runs a call on the CPUs of a NUMA node until destroyed: the calling thread, the
+            /// Eigen kernels it starts, which go to a pool of workers pinned to the node and are
+            /// partitioned for its size, and the OpenMP team behind mkldnn and MKL. Then
+            /// restores the calling thread's affinity and device. The OpenMP team stays on the
+            /// node until a call for another node, or one with node -1, moves it.
+            class NumaNodeBinding
+            {
+            public:
+                NumaNodeBinding(int node);
+                ~NumaNodeBinding();
+                NumaNodeBinding(const NumaNodeBinding&) = delete;
+                NumaNodeBinding& operator=(const NumaNodeBinding&) = delete;
+
+            private:
+                // CPUs the thread was allowed on before, empty when it was not rebound
+                std::vector<size_t> m_saved_cpus;
+                // Device the thread had selected before, restored when m_device_selected
+                Eigen::ThreadPoolDevice* m_saved_device = nullptr;
+                bool m_device_selected = false;
+            };
+        }
+    }
+}
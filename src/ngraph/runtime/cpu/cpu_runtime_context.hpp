@@ -24,20 +24,14 @@ namespace mkldnn
     class primitive;
 }
 
-namespace ngraph
-{
-    namespace runtime
-    {
-        class AlignedBuffer;
-    }
-}
-
 namespace ngraph
 {
     namespace runtime
     {
         namespace cpu
         {
+            class NumaBuffer;
+
             typedef std::chrono::high_resolution_clock Clock;
             typedef std::chrono::time_point<Clock> Timestamp;
             typedef std::chrono::microseconds Timescale;
@@ -48,8 +42,9 @@ namespace ngraph
                 int64_t* op_durations;
                 bool* p_en;
                 mkldnn::primitive* const* mkldnn_primitives;
-                std::vector<AlignedBuffer*> memory_buffers;
+                std::vector<NumaBuffer*> memory_buffers;
                 char* const* mkldnn_workspaces;
+                void* const* constants;
             };
             }
         }
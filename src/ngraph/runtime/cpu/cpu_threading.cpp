@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <dlfcn.h>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#ifdef NGRAPH_TBB_ENABLE
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/cpu/cpu_threading.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static mutex s_config_mutex;
+// Bumped by every set_threading_config; threads compare it against the last one they applied
+static atomic<size_t> s_generation{0};
+
+static runtime::cpu::ThreadingConfig& current_config()
+{
+    static runtime::cpu::ThreadingConfig config = []() {
+        runtime::cpu::ThreadingConfig defaults;
+        defaults.num_threads = runtime::cpu::eigen::get_default_thread_count();
+        return defaults;
+    }();
+    return config;
+}
+
+// mkldnn and MKL run on the OpenMP runtime they were built with. Looking the setters up keeps
+// this file from linking against a particular runtime. Both setters only affect the calling
+// thread; MKL_Set_Num_Threads would change the count for every thread in the process.
+static void set_vendor_thread_count(size_t num_threads)
+{
+    using SetOmpThreads = void (*)(int);
+    if (auto set = reinterpret_cast<SetOmpThreads>(dlsym(RTLD_DEFAULT, "omp_set_num_threads")))
+    {
+        set(static_cast<int>(num_threads));
+    }
+    using SetMklThreadsLocal = int (*)(int);
+    if (auto set = reinterpret_cast<SetMklThreadsLocal>(
+            dlsym(RTLD_DEFAULT, "mkl_set_num_threads_local")))
+    {
+        set(static_cast<int>(num_threads));
+    }
+}
+
+void runtime::cpu::set_threading_config(const ThreadingConfig& config)
+{
+    ThreadingConfig resolved = config;
+    if (resolved.num_threads == 0)
+    {
+        resolved.num_threads = eigen::get_default_thread_count();
+    }
+    if (resolved.cpu_affinity.empty() && resolved.numa_node >= 0)
+    {
+        resolved.cpu_affinity = get_numa_node_cpus(resolved.numa_node);
+        if (resolved.cpu_affinity.empty())
+        {
+            throw ngraph_error("NUMA node " + to_string(resolved.numa_node) + " has no CPUs");
+        }
+    }
+
+    {
+        lock_guard<mutex> lock(s_config_mutex);
+        eigen::reset_thread_pool(static_cast<int>(resolved.num_threads), resolved.cpu_affinity);
+        current_config() = resolved;
+        s_generation++;
+    }
+    // Rebuilt on the next call bound to a node, with the new thread count
+    reset_numa_thread_pools();
+}
+
+runtime::cpu::ThreadingConfig runtime::cpu::get_threading_config()
+{
+    lock_guard<mutex> lock(s_config_mutex);
+    return current_config();
+}
+
+void runtime::cpu::apply_threading_config()
+{
+    // Until the configuration is first set the vendor libraries keep their own defaults
+    static thread_local size_t applied_generation = 0;
+    size_t generation = s_generation.load();
+    if (generation == applied_generation)
+    {
+        return;
+    }
+    applied_generation = generation;
+
+    size_t num_threads = get_threading_config().num_threads;
+    set_vendor_thread_count(num_threads);
+#ifdef NGRAPH_TBB_ENABLE
+    static thread_local unique_ptr<tbb::task_scheduler_init> tbb_scheduler;
+    tbb_scheduler.reset();
+    tbb_scheduler.reset(new tbb::task_scheduler_init(static_cast<int>(num_threads)));
+#endif
+}
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Threading of the CPU backend, shared by every function in the process
+            ///
+            /// Eigen kernels and DEX functors run on one worker pool built from this
+            /// configuration. mkldnn and MKL are held to the same thread count, and so is the
+            /// TBB scheduler behind the inter-op flow graph. Several models in one process can
+            /// then split the cores between them instead of each claiming all of them.
+            struct ThreadingConfig
+            {
+                /// Worker threads; 0 keeps the default of OMP_NUM_THREADS, or else half the
+                /// hardware threads
+                size_t num_threads = 0;
+                /// Logical CPUs the pool workers are pinned to, round robin. Empty leaves them
+                /// unpinned. OpenMP threads are placed by KMP_AFFINITY or OMP_PLACES instead.
+                std::vector<size_t> cpu_affinity;
+                /// When cpu_affinity is empty, pin the workers to the CPUs of this NUMA node;
+                /// -1 for no node
+                int numa_node = -1;
+            };
+
+            /// Replaces the configuration and rebuilds the worker pool, so no call may be in
+            /// flight. Throws ngraph_error for a NUMA node without CPUs.
+            void set_threading_config(const ThreadingConfig& config);
+
+            /// The configuration in effect, with num_threads and cpu_affinity resolved
+            ThreadingConfig get_threading_config();
+
+            /// Brings the calling thread's OpenMP and TBB settings in line with the
+            /// configuration; both are per thread. Called at the start of every call, it costs
+            /// one comparison when nothing changed.
+            void apply_threading_config();
+        }
+    }
+}
@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "attention.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                void attention_float32(float* query,
+                                       float* key,
+                                       float* value,
+                                       float* output,
+                                       size_t m,
+                                       size_t n,
+                                       size_t d,
+                                       size_t dv,
+                                       float scale,
+                                       bool key_transposed)
+                {
+                    attention<float>(
+                        query, key, value, output, m, n, d, dv, scale, key_transposed);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,211 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                inline void attention_gemm(bool transpose_b,
+                                           size_t m,
+                                           size_t n,
+                                           size_t k,
+                                           float alpha,
+                                           const float* a,
+                                           size_t lda,
+                                           const float* b,
+                                           size_t ldb,
+                                           float beta,
+                                           float* c,
+                                           size_t ldc)
+                {
+                    cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                       cblas::Transpose::None,
+                                       transpose_b ? cblas::Transpose::Transpose
+                                                   : cblas::Transpose::None,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       a,
+                                       std::max<size_t>(1, lda),
+                                       b,
+                                       std::max<size_t>(1, ldb),
+                                       beta,
+                                       c,
+                                       std::max<size_t>(1, ldc));
+                }
+
+                inline void attention_gemm(bool transpose_b,
+                                           size_t m,
+                                           size_t n,
+                                           size_t k,
+                                           double alpha,
+                                           const double* a,
+                                           size_t lda,
+                                           const double* b,
+                                           size_t ldb,
+                                           double beta,
+                                           double* c,
+                                           size_t ldc)
+                {
+                    cblas::cblas_dgemm(cblas::Layout::RowMajor,
+                                       cblas::Transpose::None,
+                                       transpose_b ? cblas::Transpose::Transpose
+                                                   : cblas::Transpose::None,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       a,
+                                       std::max<size_t>(1, lda),
+                                       b,
+                                       std::max<size_t>(1, ldb),
+                                       beta,
+                                       c,
+                                       std::max<size_t>(1, ldc));
+                }
+
+                // softmax(scale * query . key) . value for an m x d query, a d x n key (n x d
+                // when key_transposed) and an n x dv value.
+                //
+                // Queries are processed in tiles of rows against blocks of keys. Each block's
+                // scores are exponentiated against the running row maximum and immediately
+                // multiplied into the output, which is rescaled whenever the maximum grows.
+                // Only one tile of scores is ever live instead of the whole m x n matrix.
+                template <typename ElementType>
+                void attention(const ElementType* query,
+                               const ElementType* key,
+                               const ElementType* value,
+                               ElementType* output,
+                               size_t m,
+                               size_t n,
+                               size_t d,
+                               size_t dv,
+                               ElementType scale,
+                               bool key_transposed)
+                {
+                    const size_t query_tile = 64;
+                    const size_t key_tile = 256;
+                    const ElementType lowest = -std::numeric_limits<ElementType>::infinity();
+
+                    std::fill(output, output + m * dv, ElementType(0));
+                    if (m == 0 || n == 0 || dv == 0)
+                    {
+                        return;
+                    }
+
+                    std::vector<ElementType> scores(std::min(m, query_tile) *
+                                                    std::min(n, key_tile));
+                    std::vector<ElementType> max(query_tile);
+                    std::vector<ElementType> sum(query_tile);
+                    for (size_t i0 = 0; i0 < m; i0 += query_tile)
+                    {
+                        size_t tm = std::min(query_tile, m - i0);
+                        ElementType* out_tile = output + i0 * dv;
+                        std::fill(max.begin(), max.end(), lowest);
+                        std::fill(sum.begin(), sum.end(), ElementType(0));
+
+                        for (size_t j0 = 0; j0 < n; j0 += key_tile)
+                        {
+                            size_t tn = std::min(key_tile, n - j0);
+                            attention_gemm(key_transposed,
+                                           tm,
+                                           tn,
+                                           d,
+                                           scale,
+                                           query + i0 * d,
+                                           d,
+                                           key_transposed ? key + j0 * d : key + j0,
+                                           key_transposed ? d : n,
+                                           ElementType(0),
+                                           scores.data(),
+                                           tn);
+
+                            for (size_t i = 0; i < tm; i++)
+                            {
+                                ElementType* row = scores.data() + i * tn;
+                                ElementType new_max =
+                                    std::max(max[i], *std::max_element(row, row + tn));
+                                if (new_max == lowest)
+                                {
+                                    // Nothing but -inf so far, which contributes nothing
+                                    std::fill(row, row + tn, ElementType(0));
+                                    continue;
+                                }
+
+                                ElementType row_sum = 0;
+                                for (size_t j = 0; j < tn; j++)
+                                {
+                                    row[j] = std::exp(row[j] - new_max);
+                                    row_sum += row[j];
+                                }
+                                if (new_max != max[i])
+                                {
+                                    ElementType correction = std::exp(max[i] - new_max);
+                                    sum[i] *= correction;
+                                    ElementType* out_row = out_tile + i * dv;
+                                    for (size_t j = 0; j < dv; j++)
+                                    {
+                                        out_row[j] *= correction;
+                                    }
+                                    max[i] = new_max;
+                                }
+                                sum[i] += row_sum;
+                            }
+
+                            attention_gemm(false,
+                                           tm,
+                                           dv,
+                                           tn,
+                                           ElementType(1),
+                                           scores.data(),
+                                           tn,
+                                           value + j0 * dv,
+                                           dv,
+                                           ElementType(1),
+                                           out_tile,
+                                           dv);
+                        }
+
+                        for (size_t i = 0; i < tm; i++)
+                        {
+                            ElementType inverse = ElementType(1) / sum[i];
+                            ElementType* out_row = out_tile + i * dv;
+                            for (size_t j = 0; j < dv; j++)
+                            {
+                                out_row[j] *= inverse;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // A plain loop rather than an Eigen cast, since float16 and bfloat16 only
+                // convert through float and have no Eigen scalar traits
+                template <typename InputElementType, typename OutputElementType>
+                void convert(void* input, void* output, size_t count)
+                {
+                    const InputElementType* in = static_cast<const InputElementType*>(input);
+                    OutputElementType* out = static_cast<OutputElementType*>(output);
+
+                    Eigen::TensorOpCost cost(
+                        sizeof(InputElementType), sizeof(OutputElementType), 1);
+                    eigen::get_thread_pool_device().parallelFor(
+                        count, cost, [in, out](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                out[i] = static_cast<OutputElementType>(in[i]);
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
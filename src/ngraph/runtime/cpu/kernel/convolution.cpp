@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "convolution.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                void convolution_float32(float* data,
+                                         float* filters,
+                                         float* out,
+                                         const Shape& data_shape,
+                                         const Shape& filters_shape,
+                                         const Shape& out_shape,
+                                         const Strides& window_movement_strides,
+                                         const Strides& window_dilation_strides,
+                                         const CoordinateDiff& padding_below,
+                                         const CoordinateDiff& padding_above,
+                                         const Strides& data_dilation_strides,
+                                         size_t batch_axis_data,
+                                         size_t input_channel_axis_data,
+                                         size_t input_channel_axis_filters,
+                                         size_t output_channel_axis_filters,
+                                         size_t batch_axis_result,
+                                         size_t output_channel_axis_result,
+                                         bool rotate_filter)
+                {
+                    convolution<float>(data,
+                                       filters,
+                                       out,
+                                       data_shape,
+                                       filters_shape,
+                                       out_shape,
+                                       window_movement_strides,
+                                       window_dilation_strides,
+                                       padding_below,
+                                       padding_above,
+                                       data_dilation_strides,
+                                       batch_axis_data,
+                                       input_channel_axis_data,
+                                       input_channel_axis_filters,
+                                       output_channel_axis_filters,
+                                       batch_axis_result,
+                                       output_channel_axis_result,
+                                       rotate_filter);
+                }
+
+                void convolution_float64(double* data,
+                                         double* filters,
+                                         double* out,
+                                         const Shape& data_shape,
+                                         const Shape& filters_shape,
+                                         const Shape& out_shape,
+                                         const Strides& window_movement_strides,
+                                         const Strides& window_dilation_strides,
+                                         const CoordinateDiff& padding_below,
+                                         const CoordinateDiff& padding_above,
+                                         const Strides& data_dilation_strides,
+                                         size_t batch_axis_data,
+                                         size_t input_channel_axis_data,
+                                         size_t input_channel_axis_filters,
+                                         size_t output_channel_axis_filters,
+                                         size_t batch_axis_result,
+                                         size_t output_channel_axis_result,
+                                         bool rotate_filter)
+                {
+                    convolution<double>(data,
+                                        filters,
+                                        out,
+                                        data_shape,
+                                        filters_shape,
+                                        out_shape,
+                                        window_movement_strides,
+                                        window_dilation_strides,
+                                        padding_below,
+                                        padding_above,
+                                        data_dilation_strides,
+                                        batch_axis_data,
+                                        input_channel_axis_data,
+                                        input_channel_axis_filters,
+                                        output_channel_axis_filters,
+                                        batch_axis_result,
+                                        output_channel_axis_result,
+                                        rotate_filter);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,467 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <Eigen/Core>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Convolution without mkldnn, taking the same arguments as
+                // reference::convolution so that it also serves the two backprops. Axes 0 and 1
+                // of every tensor are batch and channel in some order and the spatial axes
+                // follow, so each tensor is viewed as [outer][channel][spatial] with the
+                // spatial part contiguous.
+                template <typename ElementType>
+                class ConvolutionEngine
+                {
+                public:
+                    ConvolutionEngine(const ElementType* data,
+                                      const ElementType* filters,
+                                      ElementType* out,
+                                      const Shape& data_shape,
+                                      const Shape& filters_shape,
+                                      const Shape& out_shape,
+                                      const Strides& window_movement_strides,
+                                      const Strides& window_dilation_strides,
+                                      const CoordinateDiff& padding_below,
+                                      const Strides& data_dilation_strides,
+                                      size_t batch_axis_data,
+                                      size_t input_channel_axis_data,
+                                      size_t input_channel_axis_filters,
+                                      size_t output_channel_axis_filters,
+                                      size_t batch_axis_result,
+                                      size_t output_channel_axis_result,
+                                      bool rotate_filter)
+                        : m_data(data)
+                        , m_filters(filters)
+                        , m_out(out)
+                        , m_rank(data_shape.size() - 2)
+                        , m_data_spatial(data_shape.begin() + 2, data_shape.end())
+                        , m_filter_spatial(filters_shape.begin() + 2, filters_shape.end())
+                        , m_out_spatial(out_shape.begin() + 2, out_shape.end())
+                        , m_batch_size(data_shape[batch_axis_data])
+                        , m_input_channels(data_shape[input_channel_axis_data])
+                        , m_output_channels(filters_shape[output_channel_axis_filters])
+                        , m_window_size(shape_size(m_filter_spatial))
+                        , m_positions(shape_size(m_out_spatial))
+                        , m_data_strides(row_major_strides(m_data_spatial))
+                        , m_window_strides(row_major_strides(m_filter_spatial))
+                        , m_data_batch_stride(axis_stride(data_shape, batch_axis_data))
+                        , m_data_channel_stride(axis_stride(data_shape, input_channel_axis_data))
+                        , m_out_batch_stride(axis_stride(out_shape, batch_axis_result))
+                        , m_out_channel_stride(axis_stride(out_shape, output_channel_axis_result))
+                        , m_filter_input_stride(
+                              axis_stride(filters_shape, input_channel_axis_filters))
+                        , m_filter_output_stride(
+                              axis_stride(filters_shape, output_channel_axis_filters))
+                        , m_rotate_filter(rotate_filter)
+                        , m_sources(m_rank)
+                    {
+                        // Where tap k of the window at output coordinate i lands in each data
+                        // axis, or -1 when it falls in the padding or between dilated elements
+                        for (size_t d = 0; d < m_rank; d++)
+                        {
+                            std::ptrdiff_t dilation = data_dilation_strides[d];
+                            std::ptrdiff_t dilated_size =
+                                m_data_spatial[d] == 0
+                                    ? 0
+                                    : (m_data_spatial[d] - 1) * dilation + 1;
+                            std::vector<std::ptrdiff_t>& sources = m_sources[d];
+                            sources.resize(m_out_spatial[d] * m_filter_spatial[d]);
+                            for (size_t i = 0; i < m_out_spatial[d]; i++)
+                            {
+                                for (size_t k = 0; k < m_filter_spatial[d]; k++)
+                                {
+                                    std::ptrdiff_t q = i * window_movement_strides[d] +
+                                                       k * window_dilation_strides[d] -
+                                                       padding_below[d];
+                                    bool valid = q >= 0 && q < dilated_size && q % dilation == 0;
+                                    sources[i * m_filter_spatial[d] + k] =
+                                        valid ? q / dilation : -1;
+                                }
+                            }
+                        }
+                    }
+
+                    // Dense convolutions are lowered to im2col and one GEMM per block of output
+                    // positions. With data dilation most of those columns would be zeros, so the
+                    // direct kernel visits only the taps that hit real elements instead.
+                    void run(bool data_dilated)
+                    {
+                        if (m_batch_size == 0 || m_positions == 0 || m_output_channels == 0)
+                        {
+                            return;
+                        }
+                        if (data_dilated)
+                        {
+                            run_direct();
+                        }
+                        else
+                        {
+                            run_gemm();
+                        }
+                    }
+
+                private:
+                    using Matrix = Eigen::
+                        Matrix<ElementType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+                    using StridedMatrix =
+                        Eigen::Map<Matrix, Eigen::Unaligned, Eigen::OuterStride<>>;
+
+                    // Stride of axis 0 or 1 in a tensor whose spatial axes follow them
+                    static size_t axis_stride(const Shape& shape, size_t axis)
+                    {
+                        size_t spatial = shape_size(Shape(shape.begin() + 2, shape.end()));
+                        return axis == 0 ? shape[1] * spatial : spatial;
+                    }
+
+                    // Filter element for output channel o, input channel c and window tap k.
+                    // Reversing every spatial axis reverses the flattened window index.
+                    ElementType filter(size_t o, size_t c, size_t k) const
+                    {
+                        size_t tap = m_rotate_filter ? m_window_size - 1 - k : k;
+                        return m_filters[o * m_filter_output_stride + c * m_filter_input_stride +
+                                         tap];
+                    }
+
+                    // Fills offsets[k * count + j] with the spatial data offset read by tap k
+                    // for output position first + j, or -1 if that tap reads a zero.
+                    void window_offsets(size_t first,
+                                        size_t count,
+                                        std::vector<std::ptrdiff_t>& offsets) const
+                    {
+                        offsets.resize(m_window_size * count);
+                        std::vector<size_t> position(m_rank);
+                        size_t remainder = first;
+                        for (size_t d = m_rank; d-- > 0;)
+                        {
+                            position[d] = remainder % m_out_spatial[d];
+                            remainder /= m_out_spatial[d];
+                        }
+
+                        std::vector<size_t> tap(m_rank);
+                        for (size_t j = 0; j < count; j++)
+                        {
+                            std::fill(tap.begin(), tap.end(), 0);
+                            for (size_t k = 0; k < m_window_size; k++)
+                            {
+                                std::ptrdiff_t offset = 0;
+                                for (size_t d = 0; d < m_rank && offset >= 0; d++)
+                                {
+                                    std::ptrdiff_t source =
+                                        m_sources[d][position[d] * m_filter_spatial[d] + tap[d]];
+                                    offset = source < 0 ? -1 : offset + source * m_data_strides[d];
+                                }
+                                offsets[k * count + j] = offset;
+                                increment(tap, m_filter_spatial);
+                            }
+                            increment(position, m_out_spatial);
+                        }
+                    }
+
+                    static void increment(std::vector<size_t>& index, const Shape& shape)
+                    {
+                        for (size_t d = index.size(); d-- > 0;)
+                        {
+                            if (++index[d] < shape[d])
+                            {
+                                return;
+                            }
+                            index[d] = 0;
+                        }
+                    }
+
+                    void run_gemm() const
+                    {
+                        size_t depth = m_input_channels * m_window_size;
+                        // Weights as a [output channel][input channel * window] matrix
+                        Matrix weights(m_output_channels, depth);
+                        for (size_t o = 0; o < m_output_channels; o++)
+                        {
+                            for (size_t c = 0; c < m_input_channels; c++)
+                            {
+                                for (size_t k = 0; k < m_window_size; k++)
+                                {
+                                    weights(o, c * m_window_size + k) = filter(o, c, k);
+                                }
+                            }
+                        }
+
+                        // Bound the column buffer to about a megabyte per task
+                        size_t block = (size_t(1) << 18) / std::max(depth, size_t(1));
+                        block = std::min(std::max(block, size_t(32)), m_positions);
+                        size_t blocks = (m_positions + block - 1) / block;
+
+                        Eigen::TensorOpCost cost(depth * block * sizeof(ElementType),
+                                                 m_output_channels * block * sizeof(ElementType),
+                                                 2.0 * m_output_channels * depth * block);
+                        eigen::get_thread_pool_device().parallelFor(
+                            m_batch_size * blocks,
+                            cost,
+                            [this, &weights, depth, block, blocks](Eigen::Index begin,
+                                                                   Eigen::Index end) {
+                                std::vector<std::ptrdiff_t> offsets;
+                                Matrix columns(depth, block);
+                                for (Eigen::Index task = begin; task < end; task++)
+                                {
+                                    size_t b = task / blocks;
+                                    size_t first = (task % blocks) * block;
+                                    size_t count = std::min(block, m_positions - first);
+                                    window_offsets(first, count, offsets);
+                                    columns.resize(depth, count);
+
+                                    // im2col: row c * window + k holds tap k of channel c
+                                    for (size_t c = 0; c < m_input_channels; c++)
+                                    {
+                                        const ElementType* channel = m_data +
+                                                                     b * m_data_batch_stride +
+                                                                     c * m_data_channel_stride;
+                                        for (size_t k = 0; k < m_window_size; k++)
+                                        {
+                                            ElementType* row =
+                                                columns.data() + (c * m_window_size + k) * count;
+                                            const std::ptrdiff_t* offset =
+                                                offsets.data() + k * count;
+                                            for (size_t j = 0; j < count; j++)
+                                            {
+                                                row[j] =
+                                                    offset[j] < 0 ? ElementType(0)
+                                                                  : channel[offset[j]];
+                                            }
+                                        }
+                                    }
+
+                                    StridedMatrix result(m_out + b * m_out_batch_stride + first,
+                                                         m_output_channels,
+                                                         count,
+                                                         Eigen::OuterStride<>(
+                                                             m_out_channel_stride));
+                                    if (depth == 0)
+                                    {
+                                        result.setZero();
+                                    }
+                                    else
+                                    {
+                                        result.noalias() = weights * columns;
+                                    }
+                                }
+                            });
+                    }
+
+                    void run_direct() const
+                    {
+                        // Weights as [window][input channel][output channel] so the innermost
+                        // update runs over contiguous output channels
+                        std::vector<ElementType> weights(m_window_size * m_input_channels *
+                                                         m_output_channels);
+                        for (size_t k = 0; k < m_window_size; k++)
+                        {
+                            for (size_t c = 0; c < m_input_channels; c++)
+                            {
+                                for (size_t o = 0; o < m_output_channels; o++)
+                                {
+                                    weights[(k * m_input_channels + c) * m_output_channels + o] =
+                                        filter(o, c, k);
+                                }
+                            }
+                        }
+
+                        // The taps of each output coordinate that land on real elements, as
+                        // (tap, source) pairs in [begin[d][i], begin[d][i + 1])
+                        std::vector<std::vector<size_t>> begin(m_rank);
+                        std::vector<std::vector<std::pair<size_t, size_t>>> taps(m_rank);
+                        size_t live_taps = 1;
+                        for (size_t d = 0; d < m_rank; d++)
+                        {
+                            begin[d].push_back(0);
+                            for (size_t i = 0; i < m_out_spatial[d]; i++)
+                            {
+                                for (size_t k = 0; k < m_filter_spatial[d]; k++)
+                                {
+                                    std::ptrdiff_t source =
+                                        m_sources[d][i * m_filter_spatial[d] + k];
+                                    if (source >= 0)
+                                    {
+                                        taps[d].emplace_back(k, source);
+                                    }
+                                }
+                                begin[d].push_back(taps[d].size());
+                            }
+                            live_taps *= std::max(taps[d].size() / m_out_spatial[d], size_t(1));
+                        }
+
+                        Eigen::TensorOpCost cost(
+                            live_taps * m_input_channels * sizeof(ElementType),
+                            m_output_channels * sizeof(ElementType),
+                            2.0 * live_taps * m_input_channels * m_output_channels);
+                        eigen::get_thread_pool_device().parallelFor(
+                            m_batch_size * m_positions,
+                            cost,
+                            [this, &weights, &begin, &taps](Eigen::Index first, Eigen::Index last) {
+                                std::vector<ElementType> sum(m_output_channels);
+                                std::vector<size_t> position(m_rank);
+                                std::vector<size_t> cursor(m_rank);
+                                for (Eigen::Index index = first; index < last; index++)
+                                {
+                                    size_t b = index / m_positions;
+                                    size_t p = index % m_positions;
+                                    size_t remainder = p;
+                                    bool empty = false;
+                                    for (size_t d = m_rank; d-- > 0;)
+                                    {
+                                        position[d] = remainder % m_out_spatial[d];
+                                        remainder /= m_out_spatial[d];
+                                        cursor[d] = begin[d][position[d]];
+                                        empty |= cursor[d] == begin[d][position[d] + 1];
+                                    }
+
+                                    std::fill(sum.begin(), sum.end(), ElementType(0));
+                                    const ElementType* batch = m_data + b * m_data_batch_stride;
+                                    while (!empty)
+                                    {
+                                        size_t k = 0;
+                                        size_t offset = 0;
+                                        for (size_t d = 0; d < m_rank; d++)
+                                        {
+                                            k += taps[d][cursor[d]].first * m_window_strides[d];
+                                            offset += taps[d][cursor[d]].second * m_data_strides[d];
+                                        }
+                                        for (size_t c = 0; c < m_input_channels; c++)
+                                        {
+                                            ElementType x =
+                                                batch[c * m_data_channel_stride + offset];
+                                            const ElementType* w =
+                                                weights.data() +
+                                                (k * m_input_channels + c) * m_output_channels;
+                                            for (size_t o = 0; o < m_output_channels; o++)
+                                            {
+                                                sum[o] += x * w[o];
+                                            }
+                                        }
+
+                                        // Advance the odometer over the live taps of each axis
+                                        empty = true;
+                                        for (size_t d = m_rank; d-- > 0;)
+                                        {
+                                            if (++cursor[d] < begin[d][position[d] + 1])
+                                            {
+                                                empty = false;
+                                                break;
+                                            }
+                                            cursor[d] = begin[d][position[d]];
+                                        }
+                                    }
+
+                                    ElementType* out = m_out + b * m_out_batch_stride + p;
+                                    for (size_t o = 0; o < m_output_channels; o++)
+                                    {
+                                        out[o * m_out_channel_stride] = sum[o];
+                                    }
+                                }
+                            });
+                    }
+
+                    const ElementType* m_data;
+                    const ElementType* m_filters;
+                    ElementType* m_out;
+                    size_t m_rank;
+                    Shape m_data_spatial;
+                    Shape m_filter_spatial;
+                    Shape m_out_spatial;
+                    size_t m_batch_size;
+                    size_t m_input_channels;
+                    size_t m_output_channels;
+                    size_t m_window_size;
+                    size_t m_positions;
+                    std::vector<size_t> m_data_strides;
+                    std::vector<size_t> m_window_strides;
+                    size_t m_data_batch_stride;
+                    size_t m_data_channel_stride;
+                    size_t m_out_batch_stride;
+                    size_t m_out_channel_stride;
+                    size_t m_filter_input_stride;
+                    size_t m_filter_output_stride;
+                    bool m_rotate_filter;
+                    std::vector<std::vector<std::ptrdiff_t>> m_sources;
+                };
+
+                template <typename ElementType>
+                void convolution(const ElementType* data,
+                                 const ElementType* filters,
+                                 ElementType* out,
+                                 const Shape& data_shape,
+                                 const Shape& filters_shape,
+                                 const Shape& out_shape,
+                                 const Strides& window_movement_strides,
+                                 const Strides& window_dilation_strides,
+                                 const CoordinateDiff& padding_below,
+                                 const CoordinateDiff& padding_above,
+                                 const Strides& data_dilation_strides,
+                                 size_t batch_axis_data,
+                                 size_t input_channel_axis_data,
+                                 size_t input_channel_axis_filters,
+                                 size_t output_channel_axis_filters,
+                                 size_t batch_axis_result,
+                                 size_t output_channel_axis_result,
+                                 bool rotate_filter)
+                {
+                    // The output shape already accounts for padding_above
+                    (void)padding_above;
+                    ConvolutionEngine<ElementType> engine(data,
+                                                          filters,
+                                                          out,
+                                                          data_shape,
+                                                          filters_shape,
+                                                          out_shape,
+                                                          window_movement_strides,
+                                                          window_dilation_strides,
+                                                          padding_below,
+                                                          data_dilation_strides,
+                                                          batch_axis_data,
+                                                          input_channel_axis_data,
+                                                          input_channel_axis_filters,
+                                                          output_channel_axis_filters,
+                                                          batch_axis_result,
+                                                          output_channel_axis_result,
+                                                          rotate_filter);
+                    bool data_dilated =
+                        std::any_of(data_dilation_strides.begin(),
+                                    data_dilation_strides.end(),
+                                    [](size_t stride) { return stride != 1; });
+                    engine.run(data_dilated);
+                }
+            }
+        }
+    }
+}
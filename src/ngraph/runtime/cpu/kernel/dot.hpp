@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/integer_gemm.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Dot with reduction_axes_count r contracts the last r axes of arg0 with the
+                // first r axes of arg1. Both are row major, so the contraction is exactly the
+                // GEMM of an m x k matrix with a k x n matrix, where m is the product of the
+                // free axes of arg0, k the product of the reduced axes and n the product of the
+                // free axes of arg1. No transposes or copies are needed for any rank.
+                template <typename ElementType>
+                void dot(void* arg0, void* arg1, void* out, size_t m, size_t n, size_t k)
+                {
+                    integer_gemm(static_cast<const ElementType*>(arg0),
+                                 static_cast<const ElementType*>(arg1),
+                                 static_cast<ElementType*>(out),
+                                 m,
+                                 n,
+                                 k,
+                                 ElementType(0));
+                }
+
+                template <>
+                inline void
+                    dot<float>(void* arg0, void* arg1, void* out, size_t m, size_t n, size_t k)
+                {
+                    if (m == 0 || n == 0)
+                    {
+                        return;
+                    }
+                    cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                       cblas::Transpose::None,
+                                       cblas::Transpose::None,
+                                       m,
+                                       n,
+                                       k,
+                                       1.0f,
+                                       static_cast<const float*>(arg0),
+                                       std::max<size_t>(1, k),
+                                       static_cast<const float*>(arg1),
+                                       std::max<size_t>(1, n),
+                                       0.0f,
+                                       static_cast<float*>(out),
+                                       std::max<size_t>(1, n));
+                }
+
+                template <>
+                inline void
+                    dot<double>(void* arg0, void* arg1, void* out, size_t m, size_t n, size_t k)
+                {
+                    if (m == 0 || n == 0)
+                    {
+                        return;
+                    }
+                    cblas::cblas_dgemm(cblas::Layout::RowMajor,
+                                       cblas::Transpose::None,
+                                       cblas::Transpose::None,
+                                       m,
+                                       n,
+                                       k,
+                                       1.0,
+                                       static_cast<const double*>(arg0),
+                                       std::max<size_t>(1, k),
+                                       static_cast<const double*>(arg1),
+                                       std::max<size_t>(1, n),
+                                       0.0,
+                                       static_cast<double*>(out),
+                                       std::max<size_t>(1, n));
+                }
+
+                template <>
+                inline void
+                    dot<float16>(void* arg0, void* arg1, void* out, size_t m, size_t n, size_t k)
+                {
+                    widening_dot<float16>(arg0, arg1, out, m, n, k);
+                }
+
+                template <>
+                inline void
+                    dot<bfloat16>(void* arg0, void* arg1, void* out, size_t m, size_t n, size_t k)
+                {
+                    widening_dot<bfloat16>(arg0, arg1, out, m, n, k);
+                }
+            }
+        }
+    }
+}
@@ -14,7 +14,15 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <functional>
+#include <memory>
 #include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #include "eigen_thread_pool.hpp"
 
@@ -42,9 +50,110 @@ namespace ngraph
                     return count ? count : 1;
                 }
 
-                Eigen::ThreadPool global_thread_pool(GetNumCores());
-                Eigen::ThreadPoolDevice global_thread_pool_device(&global_thread_pool,
-                                                                  global_thread_pool.NumThreads());
+                // The device selected by the calling thread with set_thread_pool_device, or null
+                static thread_local Eigen::ThreadPoolDevice* t_selected_device = nullptr;
+                // For the workers of a ThreadPool, where the address of its device is stored
+                // once it is constructed
+                static thread_local Eigen::ThreadPoolDevice* const* t_owner_device = nullptr;
+
+                // Pins each worker to the next CPU of the list as the pool starts it
+                class PinnedThreadEnvironment : public Eigen::StlThreadEnvironment
+                {
+                public:
+                    PinnedThreadEnvironment() = default;
+                    PinnedThreadEnvironment(
+                        const std::vector<size_t>& cpus,
+                        std::shared_ptr<Eigen::ThreadPoolDevice*> owner = nullptr)
+                        : m_cpus(cpus)
+                        , m_owner(owner)
+                    {
+                    }
+
+                    EnvThread* CreateThread(std::function<void()> f)
+                    {
+                        if (m_cpus.empty() && !m_owner)
+                        {
+                            return Eigen::StlThreadEnvironment::CreateThread(std::move(f));
+                        }
+                        bool pinned = !m_cpus.empty();
+                        size_t cpu = pinned ? m_cpus[m_next++ % m_cpus.size()] : 0;
+                        auto owner = m_owner;
+                        return Eigen::StlThreadEnvironment::CreateThread([f, pinned, cpu, owner]() {
+#ifdef __linux__
+                            if (pinned)
+                            {
+                                cpu_set_t set;
+                                CPU_ZERO(&set);
+                                CPU_SET(cpu, &set);
+                                pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+                            }
+#endif
+                            t_owner_device = owner.get();
+                            f();
+                        });
+                    }
+
+                private:
+                    std::vector<size_t> m_cpus;
+                    size_t m_next = 0;
+                    std::shared_ptr<Eigen::ThreadPoolDevice*> m_owner;
+                };
+
+                using PinnedThreadPool = Eigen::ThreadPoolTempl<PinnedThreadEnvironment>;
+
+                static std::unique_ptr<PinnedThreadPool> global_thread_pool(
+                    new PinnedThreadPool(GetNumCores()));
+                Eigen::ThreadPoolDevice global_thread_pool_device(global_thread_pool.get(),
+                                                                  global_thread_pool->NumThreads());
+
+                int get_default_thread_count() { return GetNumCores(); }
+
+                void reset_thread_pool(int num_threads, const std::vector<size_t>& cpus)
+                {
+                    std::unique_ptr<PinnedThreadPool> pool(
+                        new PinnedThreadPool(num_threads, PinnedThreadEnvironment(cpus)));
+                    global_thread_pool_device =
+                        Eigen::ThreadPoolDevice(pool.get(), pool->NumThreads());
+                    // The old pool joins its workers as it goes out of scope
+                    global_thread_pool.swap(pool);
+                }
+
+                ThreadPool::ThreadPool(int num_threads, const std::vector<size_t>& cpus)
+                {
+                    // Workers only look up the device from inside tasks, which cannot reach
+                    // the pool before its address is stored
+                    auto owner = std::make_shared<Eigen::ThreadPoolDevice*>(nullptr);
+                    m_pool.reset(
+                        new PinnedThreadPool(num_threads, PinnedThreadEnvironment(cpus, owner)));
+                    m_device.reset(new Eigen::ThreadPoolDevice(m_pool.get(), m_pool->NumThreads()));
+                    *owner = m_device.get();
+                }
+
+                ThreadPool::~ThreadPool()
+                {
+                    // Join the workers while the device they may refer to is still alive
+                    m_pool.reset();
+                }
+
+                Eigen::ThreadPoolDevice& get_thread_pool_device()
+                {
+                    if (t_selected_device)
+                    {
+                        return *t_selected_device;
+                    }
+                    if (t_owner_device && *t_owner_device)
+                    {
+                        return **t_owner_device;
+                    }
+                    return global_thread_pool_device;
+                }
+
+                Eigen::ThreadPoolDevice* set_thread_pool_device(Eigen::ThreadPoolDevice* device)
+                {
+                    Eigen::ThreadPoolDevice* previous = t_selected_device;
+                    t_selected_device = device;
+                    return previous;
+                }
             }
         }
     }
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -27,8 +31,42 @@ namespace ngraph
         {
             namespace eigen
             {
-                extern Eigen::ThreadPool global_thread_pool;
                 extern Eigen::ThreadPoolDevice global_thread_pool_device;
+
+                /// Worker count used until the threading configuration says otherwise
+                int get_default_thread_count();
+
+                /// Replaces the pool behind global_thread_pool_device with one of num_threads
+                /// workers, pinned round robin to cpus unless it is empty. Must not be called
+                /// while kernels are running on the pool.
+                void reset_thread_pool(int num_threads, const std::vector<size_t>& cpus);
+
+                /// \brief A pool of workers pinned round robin to a list of CPUs, such as those
+                ///        of one NUMA node, and a device that partitions kernels for that
+                ///        many workers
+                class ThreadPool
+                {
+                public:
+                    ThreadPool(int num_threads, const std::vector<size_t>& cpus);
+                    ~ThreadPool();
+                    ThreadPool(const ThreadPool&) = delete;
+                    ThreadPool& operator=(const ThreadPool&) = delete;
+
+                    Eigen::ThreadPoolDevice& get_device() { return *m_device; }
+                private:
+                    std::unique_ptr<Eigen::ThreadPoolInterface> m_pool;
+                    std::unique_ptr<Eigen::ThreadPoolDevice> m_device;
+                };
+
+                /// The device for the kernels the calling thread starts: the one it selected
+                /// with set_thread_pool_device, the device of the pool it is a worker of, or
+                /// global_thread_pool_device
+                Eigen::ThreadPoolDevice& get_thread_pool_device();
+
+                /// Routes the kernels the calling thread starts to device, or to
+                /// global_thread_pool_device for nullptr, and returns the device selected
+                /// before. The device must outlive the selection.
+                Eigen::ThreadPoolDevice* set_thread_pool_device(Eigen::ThreadPoolDevice* device);
             }
         }
     }
@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/fast_math.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // See CMakeLists.txt for the flags this loop needs to vectorize
+                template <float (*Function)(float)>
+                static void fast_map(const float* input, float* output, size_t count)
+                {
+                    Eigen::TensorOpCost cost(sizeof(float), sizeof(float), 20);
+                    eigen::get_thread_pool_device().parallelFor(
+                        count, cost, [input, output](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                output[i] = Function(input[i]);
+                            }
+                        });
+                }
+
+                void fast_exp_float32(float* input, float* output, size_t count)
+                {
+                    fast_map<fast_expf>(input, output, count);
+                }
+
+                void fast_log_float32(float* input, float* output, size_t count)
+                {
+                    fast_map<fast_logf>(input, output, count);
+                }
+
+                void fast_tanh_float32(float* input, float* output, size_t count)
+                {
+                    fast_map<fast_tanhf>(input, output, count);
+                }
+
+                void fast_sigmoid_float32(float* input, float* output, size_t count)
+                {
+                    fast_map<fast_sigmoidf>(input, output, count);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Branch-free single precision approximations for the fast-math kernels. Every
+                // step is a select, an integer bit operation or a polynomial, so loops over them
+                // vectorize for whatever vector width the code is compiled for.
+                //
+                // Maximum error against the correctly rounded result, over all finite inputs:
+                //   fast_expf      2 ulp   (denormal results keep only absolute accuracy)
+                //   fast_logf      1 ulp
+                //   fast_tanhf     2 ulp
+                //   fast_sigmoidf  3 ulp
+
+                inline float fast_bits_to_float(int32_t bits)
+                {
+                    float value;
+                    std::memcpy(&value, &bits, sizeof(value));
+                    return value;
+                }
+
+                inline int32_t fast_float_to_bits(float value)
+                {
+                    int32_t bits;
+                    std::memcpy(&bits, &value, sizeof(bits));
+                    return bits;
+                }
+
+                // exp(x) = 2^n exp(r) with |r| <= ln(2)/2, using the Cephes expf polynomial.
+                // 2^n is applied as two factors so that results in the denormal range and just
+                // below overflow stay representable. Out of range inputs are fixed up by the
+                // selects at the end rather than by clamping x, which GCC turns into a branch.
+                inline float fast_expf(float x)
+                {
+                    // Adding 1.5 * 2^23 rounds to an integer held in the low mantissa bits,
+                    // without a call to floor that would keep the loop from vectorizing
+                    float shifted = x * 1.44269504088896341f + 12582912.0f;
+                    uint32_t exponent = static_cast<uint32_t>(fast_float_to_bits(shifted)) -
+                                        static_cast<uint32_t>(0x4b400000);
+                    float n = shifted - 12582912.0f;
+                    float r = x - n * 0.693359375f;
+                    r = r + n * 2.12194440e-4f;
+
+                    float p = 1.9875691500e-4f;
+                    p = p * r + 1.3981999507e-3f;
+                    p = p * r + 8.3334519073e-3f;
+                    p = p * r + 4.1665795894e-2f;
+                    p = p * r + 1.6666665459e-1f;
+                    p = p * r + 5.0000001201e-1f;
+                    p = p * r * r + r + 1.0f;
+
+                    uint32_t half = static_cast<uint32_t>(static_cast<int32_t>(exponent) >> 1);
+                    float scale0 = fast_bits_to_float(static_cast<int32_t>((half + 127) << 23));
+                    float scale1 =
+                        fast_bits_to_float(static_cast<int32_t>((exponent - half + 127) << 23));
+                    float result = p * scale0 * scale1;
+                    result = x < -104.0f ? 0.0f : result;
+                    return x > 89.0f ? INFINITY : result;
+                }
+
+                // log(x) = e ln(2) + log(m) with m in [sqrt(1/2), sqrt(2)), using the Cephes
+                // logf polynomial. Denormals are rescaled into the normal range first.
+                inline float fast_logf(float x)
+                {
+                    bool denormal = x < 1.17549435e-38f;
+                    float scaled = denormal ? x * 8388608.0f : x;
+                    int32_t bits = fast_float_to_bits(scaled);
+                    int32_t exponent = ((bits >> 23) & 0xff) - 126 - (denormal ? 23 : 0);
+                    float m = fast_bits_to_float((bits & 0x807fffff) | 0x3f000000);
+
+                    bool small = m < 0.707106781186547524f;
+                    float e = static_cast<float>(small ? exponent - 1 : exponent);
+                    float f = (small ? m + m : m) - 1.0f;
+                    float z = f * f;
+
+                    float p = 7.0376836292e-2f;
+                    p = p * f - 1.1514610310e-1f;
+                    p = p * f + 1.1676998740e-1f;
+                    p = p * f - 1.2420140846e-1f;
+                    p = p * f + 1.4249322787e-1f;
+                    p = p * f - 1.6668057665e-1f;
+                    p = p * f + 2.0000714765e-1f;
+                    p = p * f - 2.4999993993e-1f;
+                    p = p * f + 3.3333331174e-1f;
+                    float y = p * f * z;
+                    y = y - e * 2.12194440e-4f;
+                    y = y - 0.5f * z;
+                    float result = f + y + e * 0.693359375f;
+
+                    result = x == 0.0f ? -INFINITY : result;
+                    result = x < 0.0f ? NAN : result;
+                    return (x == INFINITY || x != x) ? x : result;
+                }
+
+                // Odd polynomial near zero, where 1 - 2 / (exp(2x) + 1) would cancel
+                inline float fast_tanhf(float x)
+                {
+                    float a = std::fabs(x);
+                    float z = x * x;
+                    float p = -5.70498872745e-3f;
+                    p = p * z + 2.06390887954e-2f;
+                    p = p * z - 5.37397155531e-2f;
+                    p = p * z + 1.33314422036e-1f;
+                    p = p * z - 3.33332819422e-1f;
+                    float near_zero = p * z * x + x;
+
+                    float far = 1.0f - 2.0f / (fast_expf(a + a) + 1.0f);
+                    far = std::copysign(far, x);
+                    return a < 0.625f ? near_zero : far;
+                }
+
+                // 1 / (1 + exp(-|x|)), mirrored for negative x so that small results keep
+                // their relative precision
+                inline float fast_sigmoidf(float x)
+                {
+                    float e = fast_expf(-std::fabs(x));
+                    float s = 1.0f / (1.0f + e);
+                    return x < 0.0f ? e * s : s;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // C = (A - a_zero_point) * B, where A is m x k, B is k x n and C is m x n, all
+                // row major, accumulating in the element type of C. The k loop is blocked so a
+                // panel of B stays in cache while the rows of A stream past it, and the innermost
+                // loop runs over contiguous columns of B and C so that it vectorizes. Runs on
+                // the calling thread, for kernels that already split their work across the
+                // thread pool.
+                template <typename TA, typename TB, typename TC>
+                void integer_gemm_block(const TA* a,
+                                        const TB* b,
+                                        TC* c,
+                                        size_t m,
+                                        size_t n,
+                                        size_t k,
+                                        TC a_zero_point)
+                {
+                    const size_t block_k = 256;
+                    const size_t block_n = 1024;
+
+                    std::fill(c, c + m * n, TC(0));
+                    for (size_t k0 = 0; k0 < k; k0 += block_k)
+                    {
+                        size_t k1 = std::min(k, k0 + block_k);
+                        for (size_t n0 = 0; n0 < n; n0 += block_n)
+                        {
+                            size_t n1 = std::min(n, n0 + block_n);
+                            for (size_t i = 0; i < m; i++)
+                            {
+                                TC* c_row = c + i * n;
+                                for (size_t p = k0; p < k1; p++)
+                                {
+                                    TC a_value = static_cast<TC>(static_cast<TC>(a[i * k + p]) -
+                                                                 a_zero_point);
+                                    const TB* b_row = b + p * n;
+                                    for (size_t j = n0; j < n1; j++)
+                                    {
+                                        c_row[j] = static_cast<TC>(
+                                            c_row[j] + a_value * static_cast<TC>(b_row[j]));
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // integer_gemm_block over blocks of rows of A and C, one per task of the
+                // thread pool
+                template <typename TA, typename TB, typename TC>
+                void integer_gemm(
+                    const TA* a, const TB* b, TC* c, size_t m, size_t n, size_t k, TC a_zero_point)
+                {
+                    Eigen::TensorOpCost cost(k * sizeof(TA), n * sizeof(TC), 2.0 * n * k);
+                    eigen::get_thread_pool_device().parallelFor(
+                        m, cost, [=](Eigen::Index first, Eigen::Index last) {
+                            integer_gemm_block(
+                                a + first * k, b, c + first * n, last - first, n, k, a_zero_point);
+                        });
+                }
+            }
+        }
+    }
+}
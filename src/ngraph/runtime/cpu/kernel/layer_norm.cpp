@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "layer_norm.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                void layer_norm_float32(float* input,
+                                        float* gamma,
+                                        float* beta,
+                                        float* output,
+                                        size_t rows,
+                                        size_t n,
+                                        double eps)
+                {
+                    layer_norm<float>(input, gamma, beta, output, rows, n, eps);
+                }
+            }
+        }
+    }
+}
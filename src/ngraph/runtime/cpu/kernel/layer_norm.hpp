@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Merges the count, mean and sum of squared deviations of a second run of values
+                // into those of a first (Chan et al.), so the lanes of a row can be combined
+                // without reading the row again.
+                template <typename ElementType>
+                inline void layer_norm_merge(ElementType count,
+                                             ElementType mean,
+                                             ElementType m2,
+                                             ElementType& merged_count,
+                                             ElementType& merged_mean,
+                                             ElementType& merged_m2)
+                {
+                    if (count == 0)
+                    {
+                        return;
+                    }
+                    ElementType total = merged_count + count;
+                    ElementType delta = mean - merged_mean;
+                    merged_mean += delta * count / total;
+                    merged_m2 += m2 + delta * delta * merged_count * count / total;
+                    merged_count = total;
+                }
+
+                // Normalizes one contiguous row of length n. Welford's update gives the mean and
+                // variance in one read of the row; independent lanes keep the loop vectorizable
+                // and are merged at the end.
+                template <typename ElementType>
+                void layer_norm_row(const ElementType* in,
+                                    const ElementType* gamma,
+                                    const ElementType* beta,
+                                    ElementType* out,
+                                    size_t n,
+                                    ElementType eps)
+                {
+                    const size_t lanes = 8;
+                    ElementType mean[lanes];
+                    ElementType m2[lanes];
+                    for (size_t l = 0; l < lanes; l++)
+                    {
+                        mean[l] = 0;
+                        m2[l] = 0;
+                    }
+
+                    size_t vector_end = n - n % lanes;
+                    ElementType count = 0;
+                    for (size_t i = 0; i < vector_end; i += lanes)
+                    {
+                        count += 1;
+                        ElementType inv_count = ElementType(1) / count;
+                        for (size_t l = 0; l < lanes; l++)
+                        {
+                            ElementType delta = in[i + l] - mean[l];
+                            mean[l] += delta * inv_count;
+                            m2[l] += delta * (in[i + l] - mean[l]);
+                        }
+                    }
+
+                    ElementType row_count = 0;
+                    ElementType row_mean = 0;
+                    ElementType row_m2 = 0;
+                    for (size_t l = 0; l < lanes; l++)
+                    {
+                        layer_norm_merge(count, mean[l], m2[l], row_count, row_mean, row_m2);
+                    }
+                    for (size_t i = vector_end; i < n; i++)
+                    {
+                        layer_norm_merge(
+                            ElementType(1), in[i], ElementType(0), row_count, row_mean, row_m2);
+                    }
+
+                    ElementType rstd = ElementType(1) / std::sqrt(row_m2 / row_count + eps);
+                    for (size_t i = 0; i < n; i++)
+                    {
+                        out[i] = (in[i] - row_mean) * rstd * gamma[i] + beta[i];
+                    }
+                }
+
+                // Layer normalization of each of the rows of length n that input is made of,
+                // with one row per task of the thread pool.
+                template <typename ElementType>
+                void layer_norm(void* input,
+                                void* gamma,
+                                void* beta,
+                                void* output,
+                                size_t rows,
+                                size_t n,
+                                double eps)
+                {
+                    const ElementType* in = static_cast<const ElementType*>(input);
+                    const ElementType* g = static_cast<const ElementType*>(gamma);
+                    const ElementType* b = static_cast<const ElementType*>(beta);
+                    ElementType* out = static_cast<ElementType*>(output);
+                    if (n == 0)
+                    {
+                        return;
+                    }
+
+                    Eigen::TensorOpCost cost(
+                        4 * n * sizeof(ElementType), n * sizeof(ElementType), 10 * n);
+                    eigen::get_thread_pool_device().parallelFor(
+                        rows, cost, [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index r = first; r < last; r++)
+                            {
+                                layer_norm_row(in + r * n,
+                                               g,
+                                               b,
+                                               out + r * n,
+                                               n,
+                                               static_cast<ElementType>(eps));
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
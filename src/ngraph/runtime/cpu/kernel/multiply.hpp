@@ -19,7 +19,10 @@
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
 namespace ngraph
 {
@@ -43,7 +46,21 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0 * in1;
+                    out.device(eigen::get_thread_pool_device()) = in0 * in1;
+                }
+
+                template <>
+                inline void
+                    multiply<float16>(void* input0, void* input1, void* output, size_t count)
+                {
+                    widening_multiply<float16>(input0, input1, output, count);
+                }
+
+                template <>
+                inline void
+                    multiply<bfloat16>(void* input0, void* input1, void* output, size_t count)
+                {
+                    widening_multiply<bfloat16>(input0, input1, output, count);
                 }
             }
         }
@@ -0,0 +1,269 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/integer_gemm.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Quantized convolution as im2col and a u8s8s32 (or s8s8s32) integer GEMM,
+                // taking the same arguments as reference::quantized_convolution. The filters
+                // are already the [output channel][input channel * window] matrix, so each task
+                // multiplies them with the columns of a block of output positions and
+                // requantizes the i32 result straight into the output.
+                //
+                // Padding and dilation holes are filled with the input zero point, and the
+                // zero point is taken out of the product afterwards:
+                //   sum_d w[o][d] * (x[d] - zp) = sum_d w[o][d] * x[d] - zp * sum_d w[o][d]
+                template <typename InputElementType,
+                          typename WeightsElementType,
+                          typename OutputElementType>
+                void quantized_convolution(void* data_batch,
+                                           void* filters,
+                                           void* output,
+                                           const Shape& data_batch_shape,
+                                           const Shape& filters_shape,
+                                           const Shape& out_shape,
+                                           const Strides& window_movement_strides,
+                                           const Strides& window_dilation_strides,
+                                           const CoordinateDiff& padding_below,
+                                           const CoordinateDiff& padding_above,
+                                           const Strides& data_dilation_strides,
+                                           double input_scale,
+                                           int64_t input_zero_point,
+                                           double filters_scale,
+                                           double output_scale,
+                                           int64_t output_zero_point)
+                {
+                    const InputElementType* data =
+                        static_cast<const InputElementType*>(data_batch);
+                    const WeightsElementType* weights =
+                        static_cast<const WeightsElementType*>(filters);
+                    OutputElementType* out = static_cast<OutputElementType*>(output);
+
+                    size_t rank = data_batch_shape.size() - 2;
+                    Shape data_spatial(data_batch_shape.begin() + 2, data_batch_shape.end());
+                    Shape filter_spatial(filters_shape.begin() + 2, filters_shape.end());
+                    Shape out_spatial(out_shape.begin() + 2, out_shape.end());
+                    size_t batch_size = data_batch_shape[0];
+                    size_t input_channels = data_batch_shape[1];
+                    size_t output_channels = filters_shape[0];
+                    size_t window_size = shape_size(filter_spatial);
+                    size_t positions = shape_size(out_spatial);
+                    size_t channel_size = shape_size(data_spatial);
+                    size_t depth = input_channels * window_size;
+                    if (batch_size == 0 || positions == 0 || output_channels == 0)
+                    {
+                        return;
+                    }
+
+                    // Where tap k of the window at output coordinate i lands in each data axis,
+                    // or -1 when it falls in the padding or between dilated elements
+                    std::vector<std::vector<std::ptrdiff_t>> sources(rank);
+                    for (size_t d = 0; d < rank; d++)
+                    {
+                        std::ptrdiff_t dilation = data_dilation_strides[d];
+                        std::ptrdiff_t dilated_size =
+                            data_spatial[d] == 0 ? 0 : (data_spatial[d] - 1) * dilation + 1;
+                        sources[d].resize(out_spatial[d] * filter_spatial[d]);
+                        for (size_t i = 0; i < out_spatial[d]; i++)
+                        {
+                            for (size_t k = 0; k < filter_spatial[d]; k++)
+                            {
+                                std::ptrdiff_t q = i * window_movement_strides[d] +
+                                                   k * window_dilation_strides[d] -
+                                                   padding_below[d];
+                                bool valid = q >= 0 && q < dilated_size && q % dilation == 0;
+                                sources[d][i * filter_spatial[d] + k] = valid ? q / dilation : -1;
+                            }
+                        }
+                    }
+                    std::vector<size_t> data_strides = row_major_strides(data_spatial);
+
+                    std::vector<int32_t> zero_point_correction(output_channels);
+                    for (size_t o = 0; o < output_channels; o++)
+                    {
+                        int32_t sum = 0;
+                        for (size_t d = 0; d < depth; d++)
+                        {
+                            sum += weights[o * depth + d];
+                        }
+                        zero_point_correction[o] = static_cast<int32_t>(input_zero_point) * sum;
+                    }
+
+                    // Bound the column buffer to about 256KB per task
+                    size_t block = (size_t(1) << 18) / std::max(depth, size_t(1));
+                    block = std::min(std::max(block, size_t(32)), positions);
+                    size_t blocks = (positions + block - 1) / block;
+                    double scale = input_scale * filters_scale;
+
+                    Eigen::TensorOpCost cost(depth * block * sizeof(InputElementType),
+                                             output_channels * block * sizeof(OutputElementType),
+                                             2.0 * output_channels * depth * block);
+                    eigen::get_thread_pool_device().parallelFor(
+                        batch_size * blocks, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            // Reused across calls. Each is bounded by the block size and is
+                            // freed when the pool is replaced.
+                            static thread_local std::vector<InputElementType> columns;
+                            static thread_local std::vector<int32_t> acc;
+                            static thread_local std::vector<std::ptrdiff_t> offsets;
+                            columns.resize(depth * block);
+                            acc.resize(output_channels * block);
+                            offsets.resize(window_size * block);
+                            std::vector<size_t> position(rank);
+                            std::vector<size_t> tap(rank);
+                            for (Eigen::Index task = begin; task < end; task++)
+                            {
+                                size_t b = task / blocks;
+                                size_t first = (task % blocks) * block;
+                                size_t count = std::min(block, positions - first);
+
+                                // offsets[k * count + j] is the spatial data offset read by
+                                // tap k for output position first + j, or -1
+                                size_t remainder = first;
+                                for (size_t d = rank; d-- > 0;)
+                                {
+                                    position[d] = remainder % out_spatial[d];
+                                    remainder /= out_spatial[d];
+                                }
+                                for (size_t j = 0; j < count; j++)
+                                {
+                                    std::fill(tap.begin(), tap.end(), 0);
+                                    for (size_t k = 0; k < window_size; k++)
+                                    {
+                                        std::ptrdiff_t offset = 0;
+                                        for (size_t d = 0; d < rank && offset >= 0; d++)
+                                        {
+                                            std::ptrdiff_t source =
+                                                sources[d][position[d] * filter_spatial[d] +
+                                                           tap[d]];
+                                            offset = source < 0
+                                                         ? -1
+                                                         : offset + source * data_strides[d];
+                                        }
+                                        offsets[k * count + j] = offset;
+                                        for (size_t d = rank; d-- > 0;)
+                                        {
+                                            if (++tap[d] < filter_spatial[d])
+                                            {
+                                                break;
+                                            }
+                                            tap[d] = 0;
+                                        }
+                                    }
+                                    for (size_t d = rank; d-- > 0;)
+                                    {
+                                        if (++position[d] < out_spatial[d])
+                                        {
+                                            break;
+                                        }
+                                        position[d] = 0;
+                                    }
+                                }
+
+                                // im2col: row c * window + k holds tap k of channel c
+                                InputElementType zero_point =
+                                    static_cast<InputElementType>(input_zero_point);
+                                for (size_t c = 0; c < input_channels; c++)
+                                {
+                                    const InputElementType* channel =
+                                        data + (b * input_channels + c) * channel_size;
+                                    for (size_t k = 0; k < window_size; k++)
+                                    {
+                                        InputElementType* row =
+                                            columns.data() + (c * window_size + k) * count;
+                                        const std::ptrdiff_t* offset = offsets.data() + k * count;
+                                        for (size_t j = 0; j < count; j++)
+                                        {
+                                            row[j] =
+                                                offset[j] < 0 ? zero_point : channel[offset[j]];
+                                        }
+                                    }
+                                }
+
+                                integer_gemm_block(weights,
+                                                   columns.data(),
+                                                   acc.data(),
+                                                   output_channels,
+                                                   count,
+                                                   depth,
+                                                   int32_t(0));
+
+                                for (size_t o = 0; o < output_channels; o++)
+                                {
+                                    OutputElementType* out_row =
+                                        out + (b * output_channels + o) * positions + first;
+                                    const int32_t* acc_row = acc.data() + o * count;
+                                    for (size_t j = 0; j < count; j++)
+                                    {
+                                        out_row[j] = reference::requantize<OutputElementType>(
+                                            acc_row[j] - zero_point_correction[o],
+                                            scale,
+                                            output_scale,
+                                            output_zero_point);
+                                    }
+                                }
+                            }
+                        });
+                }
+
+#define INSTANTIATE_QUANTIZED_CONVOLUTION(INPUT, OUTPUT)                                           \
+    template void quantized_convolution<INPUT, int8_t, OUTPUT>(void*,                              \
+                                                               void*,                              \
+                                                               void*,                              \
+                                                               const Shape&,                       \
+                                                               const Shape&,                       \
+                                                               const Shape&,                       \
+                                                               const Strides&,                     \
+                                                               const Strides&,                     \
+                                                               const CoordinateDiff&,              \
+                                                               const CoordinateDiff&,              \
+                                                               const Strides&,                     \
+                                                               double,                             \
+                                                               int64_t,                            \
+                                                               double,                             \
+                                                               double,                             \
+                                                               int64_t);
+
+                INSTANTIATE_QUANTIZED_CONVOLUTION(int8_t, float)
+                INSTANTIATE_QUANTIZED_CONVOLUTION(int8_t, int8_t)
+                INSTANTIATE_QUANTIZED_CONVOLUTION(int8_t, uint8_t)
+                INSTANTIATE_QUANTIZED_CONVOLUTION(uint8_t, float)
+                INSTANTIATE_QUANTIZED_CONVOLUTION(uint8_t, int8_t)
+                INSTANTIATE_QUANTIZED_CONVOLUTION(uint8_t, uint8_t)
+            }
+        }
+    }
+}
@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/integer_gemm.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // The rows of the output are split into blocks, one per task of the thread
+                // pool. Each task accumulates its block in a thread local i32 buffer, which is
+                // reused across calls, and requantizes it into the output. The buffer is at
+                // most about 256KB per pool thread and is freed when the pool is replaced.
+                template <typename InputElementType,
+                          typename WeightsElementType,
+                          typename OutputElementType>
+                void quantized_dot(void* input,
+                                   void* weights,
+                                   void* output,
+                                   size_t m,
+                                   size_t n,
+                                   size_t k,
+                                   double input_scale,
+                                   int64_t input_zero_point,
+                                   double weights_scale,
+                                   double output_scale,
+                                   int64_t output_zero_point)
+                {
+                    const InputElementType* in = static_cast<const InputElementType*>(input);
+                    const WeightsElementType* w = static_cast<const WeightsElementType*>(weights);
+                    OutputElementType* out = static_cast<OutputElementType*>(output);
+                    if (m == 0 || n == 0)
+                    {
+                        return;
+                    }
+
+                    // Bound the accumulator to about 256KB per task
+                    size_t block = std::max((size_t(1) << 16) / n, size_t(1));
+                    block = std::min(block, m);
+                    size_t blocks = (m + block - 1) / block;
+                    double scale = input_scale * weights_scale;
+
+                    Eigen::TensorOpCost cost(block * k * sizeof(InputElementType),
+                                             block * n * sizeof(OutputElementType),
+                                             2.0 * block * n * k);
+                    eigen::get_thread_pool_device().parallelFor(
+                        blocks, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            static thread_local std::vector<int32_t> acc;
+                            for (Eigen::Index task = begin; task < end; task++)
+                            {
+                                size_t row = task * block;
+                                size_t rows = std::min(block, m - row);
+                                acc.resize(rows * n);
+                                integer_gemm_block(in + row * k,
+                                                   w,
+                                                   acc.data(),
+                                                   rows,
+                                                   n,
+                                                   k,
+                                                   static_cast<int32_t>(input_zero_point));
+
+                                OutputElementType* out_rows = out + row * n;
+                                for (size_t i = 0; i < rows * n; i++)
+                                {
+                                    out_rows[i] = reference::requantize<OutputElementType>(
+                                        acc[i], scale, output_scale, output_zero_point);
+                                }
+                            }
+                        });
+                }
+
+#define INSTANTIATE_QUANTIZED_DOT(INPUT, OUTPUT)                                                   \
+    template void quantized_dot<INPUT, int8_t, OUTPUT>(                                            \
+        void*, void*, void*, size_t, size_t, size_t, double, int64_t, double, double, int64_t);
+
+                INSTANTIATE_QUANTIZED_DOT(int8_t, float)
+                INSTANTIATE_QUANTIZED_DOT(int8_t, int8_t)
+                INSTANTIATE_QUANTIZED_DOT(int8_t, uint8_t)
+                INSTANTIATE_QUANTIZED_DOT(uint8_t, float)
+                INSTANTIATE_QUANTIZED_DOT(uint8_t, int8_t)
+                INSTANTIATE_QUANTIZED_DOT(uint8_t, uint8_t)
+            }
+        }
+    }
+}
@@ -0,0 +1,228 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include <Eigen/Core>
+
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType, typename Function>
+                static void widening_map(void* input, void* output, size_t count, Function f)
+                {
+                    const ElementType* in = static_cast<const ElementType*>(input);
+                    ElementType* out = static_cast<ElementType*>(output);
+
+                    Eigen::TensorOpCost cost(sizeof(ElementType), sizeof(ElementType), 10);
+                    eigen::get_thread_pool_device().parallelFor(
+                        count, cost, [in, out, f](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                out[i] = ElementType(f(static_cast<float>(in[i])));
+                            }
+                        });
+                }
+
+                template <typename ElementType, typename Function>
+                static void widening_zip(
+                    void* input0, void* input1, void* output, size_t count, Function f)
+                {
+                    const ElementType* in0 = static_cast<const ElementType*>(input0);
+                    const ElementType* in1 = static_cast<const ElementType*>(input1);
+                    ElementType* out = static_cast<ElementType*>(output);
+
+                    Eigen::TensorOpCost cost(2 * sizeof(ElementType), sizeof(ElementType), 4);
+                    eigen::get_thread_pool_device().parallelFor(
+                        count, cost, [in0, in1, out, f](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                out[i] = ElementType(
+                                    f(static_cast<float>(in0[i]), static_cast<float>(in1[i])));
+                            }
+                        });
+                }
+
+                template <typename ElementType>
+                void widening_add(void* input0, void* input1, void* output, size_t count)
+                {
+                    widening_zip<ElementType>(
+                        input0, input1, output, count, [](float a, float b) { return a + b; });
+                }
+
+                template <typename ElementType>
+                void widening_multiply(void* input0, void* input1, void* output, size_t count)
+                {
+                    widening_zip<ElementType>(
+                        input0, input1, output, count, [](float a, float b) { return a * b; });
+                }
+
+                template <typename ElementType>
+                void widening_abs(void* input, void* output, size_t count)
+                {
+                    widening_map<ElementType>(
+                        input, output, count, [](float x) { return std::fabs(x); });
+                }
+
+                template <typename ElementType>
+                void widening_ceil(void* input, void* output, size_t count)
+                {
+                    widening_map<ElementType>(
+                        input, output, count, [](float x) { return std::ceil(x); });
+                }
+
+                template <typename ElementType>
+                void widening_relu(void* input, void* output, size_t count)
+                {
+                    widening_map<ElementType>(
+                        input, output, count, [](float x) { return x > 0.0f ? x : 0.0f; });
+                }
+
+                template <typename ElementType>
+                void widening_exp(void* input, void* output, size_t count)
+                {
+                    widening_map<ElementType>(
+                        input, output, count, [](float x) { return std::exp(x); });
+                }
+
+                template <typename ElementType>
+                void widening_log(void* input, void* output, size_t count)
+                {
+                    widening_map<ElementType>(
+                        input, output, count, [](float x) { return std::log(x); });
+                }
+
+                template <typename ElementType>
+                void widening_tanh(void* input, void* output, size_t count)
+                {
+                    widening_map<ElementType>(
+                        input, output, count, [](float x) { return std::tanh(x); });
+                }
+
+                template <typename ElementType>
+                void widening_sigmoid(void* input, void* output, size_t count)
+                {
+                    widening_map<ElementType>(input, output, count, [](float x) {
+                        return 1.0f / (1.0f + std::exp(-x));
+                    });
+                }
+
+                // Each task owns a tile of the m x n output. Panels of A and B are widened into
+                // per-task f32 buffers one depth block at a time and multiplied by Eigen, which
+                // runs single threaded inside the task, so the output tile accumulates in f32
+                // and is rounded once. No f32 copy of either operand is ever materialized.
+                template <typename ElementType>
+                void widening_dot(void* arg0, void* arg1, void* out, size_t m, size_t n, size_t k)
+                {
+                    using Matrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>;
+
+                    const ElementType* a = static_cast<const ElementType*>(arg0);
+                    const ElementType* b = static_cast<const ElementType*>(arg1);
+                    ElementType* c = static_cast<ElementType*>(out);
+                    if (m == 0 || n == 0)
+                    {
+                        return;
+                    }
+
+                    const size_t row_block = 64;
+                    const size_t column_block = 256;
+                    const size_t depth_block = 256;
+                    size_t row_blocks = (m + row_block - 1) / row_block;
+                    size_t column_blocks = (n + column_block - 1) / column_block;
+
+                    size_t tile_rows = std::min(row_block, m);
+                    size_t tile_columns = std::min(column_block, n);
+                    Eigen::TensorOpCost cost((tile_rows + tile_columns) * k * sizeof(ElementType),
+                                             tile_rows * tile_columns * sizeof(ElementType),
+                                             2.0 * tile_rows * tile_columns * k);
+                    eigen::get_thread_pool_device().parallelFor(
+                        row_blocks * column_blocks,
+                        cost,
+                        [=](Eigen::Index begin, Eigen::Index end) {
+                            Matrix a_panel, b_panel, c_tile;
+                            for (Eigen::Index task = begin; task < end; task++)
+                            {
+                                size_t row = (task / column_blocks) * row_block;
+                                size_t column = (task % column_blocks) * column_block;
+                                size_t rows = std::min(row_block, m - row);
+                                size_t columns = std::min(column_block, n - column);
+
+                                c_tile.setZero(rows, columns);
+                                for (size_t depth = 0; depth < k; depth += depth_block)
+                                {
+                                    size_t depths = std::min(depth_block, k - depth);
+                                    a_panel.resize(rows, depths);
+                                    for (size_t i = 0; i < rows; i++)
+                                    {
+                                        const ElementType* a_row = a + (row + i) * k + depth;
+                                        for (size_t p = 0; p < depths; p++)
+                                        {
+                                            a_panel(i, p) = static_cast<float>(a_row[p]);
+                                        }
+                                    }
+                                    b_panel.resize(depths, columns);
+                                    for (size_t p = 0; p < depths; p++)
+                                    {
+                                        const ElementType* b_row = b + (depth + p) * n + column;
+                                        for (size_t j = 0; j < columns; j++)
+                                        {
+                                            b_panel(p, j) = static_cast<float>(b_row[j]);
+                                        }
+                                    }
+                                    c_tile.noalias() += a_panel * b_panel;
+                                }
+
+                                for (size_t i = 0; i < rows; i++)
+                                {
+                                    ElementType* c_row = c + (row + i) * n + column;
+                                    for (size_t j = 0; j < columns; j++)
+                                    {
+                                        c_row[j] = ElementType(c_tile(i, j));
+                                    }
+                                }
+                            }
+                        });
+                }
+
+#define INSTANTIATE_WIDENING_KERNELS(T)                                                            \
+    template void widening_add<T>(void*, void*, void*, size_t);                                    \
+    template void widening_multiply<T>(void*, void*, void*, size_t);                               \
+    template void widening_abs<T>(void*, void*, size_t);                                           \
+    template void widening_ceil<T>(void*, void*, size_t);                                          \
+    template void widening_relu<T>(void*, void*, size_t);                                          \
+    template void widening_exp<T>(void*, void*, size_t);                                           \
+    template void widening_log<T>(void*, void*, size_t);                                           \
+    template void widening_tanh<T>(void*, void*, size_t);                                          \
+    template void widening_sigmoid<T>(void*, void*, size_t);                                       \
+    template void widening_dot<T>(void*, void*, void*, size_t, size_t, size_t);
+
+                INSTANTIATE_WIDENING_KERNELS(float16)
+                INSTANTIATE_WIDENING_KERNELS(bfloat16)
+            }
+        }
+    }
+}
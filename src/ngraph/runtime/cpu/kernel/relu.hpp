@@ -19,7 +19,10 @@
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
 namespace ngraph
 {
@@ -41,7 +44,19 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0.cwiseMax(ElementType(0));
+                    out.device(eigen::get_thread_pool_device()) = in0.cwiseMax(ElementType(0));
+                }
+
+                template <>
+                inline void relu<float16>(void* input0, void* output, size_t count)
+                {
+                    widening_relu<float16>(input0, output, count);
+                }
+
+                template <>
+                inline void relu<bfloat16>(void* input0, void* output, size_t count)
+                {
+                    widening_relu<bfloat16>(input0, output, count);
                 }
             }
         }
@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "softmax.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                void softmax_float32(float* input,
+                                     float* output,
+                                     const Shape& shape,
+                                     const AxisSet& axes)
+                {
+                    softmax<float>(input, output, shape, axes);
+                }
+
+                void softmax_float64(double* input,
+                                     double* output,
+                                     const Shape& shape,
+                                     const AxisSet& axes)
+                {
+                    softmax<double>(input, output, shape, axes);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,260 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Online softmax normaliser: (max, sum) is the running maximum m and the sum of
+                // exp(x - m) over the values seen so far. A new maximum rescales the sum, so both
+                // come out of a single read of the input with one exp per element.
+                template <typename ElementType>
+                inline void softmax_accumulate(ElementType x, ElementType& max, ElementType& sum)
+                {
+                    bool greater = x > max;
+                    // x == max also covers max = x = -inf, which would otherwise give a nan
+                    ElementType e = (x == max)
+                                        ? ElementType(1)
+                                        : std::exp(greater ? max - x : x - max);
+                    sum = greater ? sum * e + ElementType(1) : sum + e;
+                    max = greater ? x : max;
+                }
+
+                template <typename ElementType>
+                inline void softmax_merge(ElementType max,
+                                          ElementType sum,
+                                          ElementType& merged_max,
+                                          ElementType& merged_sum)
+                {
+                    if (max > merged_max)
+                    {
+                        merged_sum = merged_sum * std::exp(merged_max - max) + sum;
+                        merged_max = max;
+                    }
+                    else if (max == merged_max)
+                    {
+                        merged_sum += sum;
+                    }
+                    else
+                    {
+                        merged_sum += sum * std::exp(max - merged_max);
+                    }
+                }
+
+                // Softmax of each contiguous row of length n. Independent lanes keep their own
+                // normaliser so the update loop vectorizes; they are merged at the end of the row.
+                template <typename ElementType>
+                void softmax_row(const ElementType* in, ElementType* out, size_t n)
+                {
+                    const size_t lanes = 8;
+                    ElementType max[lanes];
+                    ElementType sum[lanes];
+                    for (size_t l = 0; l < lanes; l++)
+                    {
+                        max[l] = in[0];
+                        sum[l] = 0;
+                    }
+
+                    size_t vector_end = n - n % lanes;
+                    for (size_t i = 0; i < vector_end; i += lanes)
+                    {
+                        for (size_t l = 0; l < lanes; l++)
+                        {
+                            softmax_accumulate(in[i + l], max[l], sum[l]);
+                        }
+                    }
+                    for (size_t i = vector_end; i < n; i++)
+                    {
+                        softmax_accumulate(in[i], max[0], sum[0]);
+                    }
+
+                    ElementType row_max = max[0];
+                    ElementType row_sum = sum[0];
+                    for (size_t l = 1; l < lanes; l++)
+                    {
+                        softmax_merge(max[l], sum[l], row_max, row_sum);
+                    }
+
+                    ElementType scale = ElementType(1) / row_sum;
+                    for (size_t i = 0; i < n; i++)
+                    {
+                        out[i] = std::exp(in[i] - row_max) * scale;
+                    }
+                }
+
+                // Every offset c . strides for the coordinates c of shape, in row-major order
+                inline std::vector<size_t> softmax_offsets(const Shape& shape,
+                                                           const Strides& strides)
+                {
+                    std::vector<size_t> offsets{0};
+                    for (size_t i = 0; i < shape.size(); i++)
+                    {
+                        std::vector<size_t> next;
+                        next.reserve(offsets.size() * shape[i]);
+                        for (size_t offset : offsets)
+                        {
+                            for (size_t c = 0; c < shape[i]; c++)
+                            {
+                                next.push_back(offset + c * strides[i]);
+                            }
+                        }
+                        offsets.swap(next);
+                    }
+                    return offsets;
+                }
+
+                // Softmax over any set of axes. The axes after the last reduced axis form
+                // contiguous lanes of length inner, each with its own normaliser, so every
+                // reduction reads its input once for the normaliser and once for the output.
+                template <typename ElementType>
+                void softmax(void* input, void* output, const Shape& shape, const AxisSet& axes)
+                {
+                    const ElementType* in = static_cast<const ElementType*>(input);
+                    ElementType* out = static_cast<ElementType*>(output);
+                    if (shape_size(shape) == 0)
+                    {
+                        return;
+                    }
+
+                    size_t rank = shape.size();
+                    size_t inner = 1;
+                    size_t last_reduced = rank;
+                    for (size_t i = rank; i-- > 0;)
+                    {
+                        if (axes.count(i) != 0)
+                        {
+                            last_reduced = i;
+                            break;
+                        }
+                        inner *= shape[i];
+                    }
+
+                    Strides strides(rank, 1);
+                    for (size_t i = rank; i-- > 1;)
+                    {
+                        strides[i - 1] = strides[i] * shape[i];
+                    }
+
+                    Shape outer_shape, reduced_shape;
+                    Strides outer_strides, reduced_strides;
+                    // Without reduced axes every axis is already part of inner
+                    size_t leading = last_reduced < rank ? last_reduced : 0;
+                    for (size_t i = 0; i < leading; i++)
+                    {
+                        if (axes.count(i) != 0)
+                        {
+                            reduced_shape.push_back(shape[i]);
+                            reduced_strides.push_back(strides[i]);
+                        }
+                        else
+                        {
+                            outer_shape.push_back(shape[i]);
+                            outer_strides.push_back(strides[i]);
+                        }
+                    }
+                    if (last_reduced < rank)
+                    {
+                        reduced_shape.push_back(shape[last_reduced]);
+                        reduced_strides.push_back(strides[last_reduced]);
+                    }
+
+                    std::vector<size_t> outer_offsets = softmax_offsets(outer_shape, outer_strides);
+                    size_t reduced_size = shape_size(reduced_shape);
+                    size_t group_size = reduced_size * inner;
+                    Eigen::TensorOpCost cost(2 * group_size * sizeof(ElementType),
+                                             group_size * sizeof(ElementType),
+                                             40 * group_size);
+
+                    // Rows: the reduced axes are exactly the trailing axes
+                    bool trailing = inner == 1;
+                    for (size_t i = 0; trailing && i < reduced_shape.size(); i++)
+                    {
+                        trailing = reduced_strides[i] == shape_size(Shape(
+                                                             reduced_shape.begin() + i + 1,
+                                                             reduced_shape.end()));
+                    }
+                    if (trailing)
+                    {
+                        eigen::get_thread_pool_device().parallelFor(
+                            outer_offsets.size(), cost, [&](Eigen::Index first, Eigen::Index last) {
+                                for (Eigen::Index g = first; g < last; g++)
+                                {
+                                    size_t offset = outer_offsets[g];
+                                    softmax_row(in + offset, out + offset, reduced_size);
+                                }
+                            });
+                        return;
+                    }
+
+                    std::vector<size_t> reduced_offsets =
+                        softmax_offsets(reduced_shape, reduced_strides);
+                    eigen::get_thread_pool_device().parallelFor(
+                        outer_offsets.size(), cost, [&](Eigen::Index first, Eigen::Index last) {
+                            std::vector<ElementType> max(inner);
+                            std::vector<ElementType> sum(inner);
+                            for (Eigen::Index g = first; g < last; g++)
+                            {
+                                size_t offset = outer_offsets[g];
+                                std::copy(in + offset + reduced_offsets[0],
+                                          in + offset + reduced_offsets[0] + inner,
+                                          max.begin());
+                                std::fill(sum.begin(), sum.end(), ElementType(0));
+                                for (size_t r : reduced_offsets)
+                                {
+                                    const ElementType* lane = in + offset + r;
+                                    for (size_t j = 0; j < inner; j++)
+                                    {
+                                        softmax_accumulate(lane[j], max[j], sum[j]);
+                                    }
+                                }
+                                for (size_t j = 0; j < inner; j++)
+                                {
+                                    sum[j] = ElementType(1) / sum[j];
+                                }
+                                for (size_t r : reduced_offsets)
+                                {
+                                    const ElementType* lane = in + offset + r;
+                                    ElementType* out_lane = out + offset + r;
+                                    for (size_t j = 0; j < inner; j++)
+                                    {
+                                        out_lane[j] = std::exp(lane[j] - max[j]) * sum[j];
+                                    }
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
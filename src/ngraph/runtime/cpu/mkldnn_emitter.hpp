@@ -40,9 +40,14 @@ namespace ngraph
             class MKLDNNWorkspace
             {
             public:
-                MKLDNNWorkspace(size_t size) { buf = reinterpret_cast<char*>(malloc(size)); }
+                MKLDNNWorkspace(size_t byte_size)
+                    : size(byte_size)
+                {
+                    buf = reinterpret_cast<char*>(malloc(byte_size));
+                }
                 ~MKLDNNWorkspace() { free(buf); }
                 char* buf;
+                size_t size;
             };
 
             class MKLDNNEmitter
@@ -53,6 +58,8 @@ namespace ngraph
 
                 const std::vector<mkldnn::primitive*>& get_mkldnn_primitives() const;
                 const std::vector<char*>& get_mkldnn_workspaces();
+                /// Total size of the workspaces inserted so far
+                size_t get_workspace_bytes() const;
 
                 size_t insert_primitive(mkldnn::primitive* primitive);
                 size_t insert_workspace(std::unique_ptr<MKLDNNWorkspace>& workspace);
@@ -64,6 +64,8 @@ static const std::unordered_set<std::type_index> s_op_registry{
 // Mapping from POD types to MKLDNN data types
 static const std::map<element::Type, const mkldnn::memory::data_type> s_mkldnn_data_type_map{
     {element::boolean, mkldnn::memory::data_type::s8},
+    {element::f16, mkldnn::memory::data_type::data_undef},
+    {element::bf16, mkldnn::memory::data_type::data_undef},
     {element::f32, mkldnn::memory::data_type::f32},
     {element::f64, mkldnn::memory::data_type::data_undef},
     {element::i8, mkldnn::memory::data_type::s8},
@@ -77,6 +79,8 @@ static const std::map<element::Type, const mkldnn::memory::data_type> s_mkldnn_d
 
 static const std::map<element::Type, const std::string> s_mkldnn_data_type_string_map{
     {element::boolean, "mkldnn::memory::data_type::s8"},
+    {element::f16, "mkldnn::memory::data_type::data_undef"},
+    {element::bf16, "mkldnn::memory::data_type::data_undef"},
     {element::f32, "mkldnn::memory::data_type::f32"},
     {element::f64, "mkldnn::memory::data_type::data_undef"},
     {element::i8, "mkldnn::memory::data_type::s8"},
@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "attention.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::Attention::Attention(shared_ptr<Node> query,
+                         shared_ptr<Node> key,
+                         shared_ptr<Node> value,
+                         double scale,
+                         bool key_transposed)
+    : RequiresTensorViewArgs("Attention", {query, key, value})
+    , m_scale(scale)
+    , m_key_transposed(key_transposed)
+{
+    const Shape& query_shape = query->get_shape();
+    const Shape& key_shape = key->get_shape();
+    const Shape& value_shape = value->get_shape();
+    if (query_shape.size() != 2 || key_shape.size() != 2 || value_shape.size() != 2)
+    {
+        throw ngraph_error("Attention arguments must be matrices");
+    }
+    if (query->get_element_type() != key->get_element_type() ||
+        query->get_element_type() != value->get_element_type())
+    {
+        throw ngraph_error("Attention argument element types do not match");
+    }
+
+    size_t key_depth = key_transposed ? key_shape[1] : key_shape[0];
+    size_t key_count = key_transposed ? key_shape[0] : key_shape[1];
+    if (query_shape[1] != key_depth)
+    {
+        throw ngraph_error("Attention query and key depths do not match: " +
+                           vector_to_string(query_shape) + ", " + vector_to_string(key_shape));
+    }
+    if (value_shape[0] != key_count)
+    {
+        throw ngraph_error("Attention key and value counts do not match: " +
+                           vector_to_string(key_shape) + ", " + vector_to_string(value_shape));
+    }
+
+    add_output(query->get_element_type(), Shape{query_shape[0], value_shape[1]});
+}
+
+shared_ptr<Node> op::Attention::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 3)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<Attention>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_scale, m_key_transposed);
+}
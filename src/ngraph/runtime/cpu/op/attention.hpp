@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Fused scaled dot-product attention, softmax(scale * query . key) . value,
+        ///        with the softmax taken over the keys.
+        ///
+        /// Replaces the Dot -> Softmax -> Dot chain so that the m x n score matrix is never
+        /// materialised.
+        class Attention : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \param query The m x d queries.
+            /// \param key The d x n keys, or n x d when key_transposed is set.
+            /// \param value The n x dv values.
+            /// \param scale The factor applied to the scores before the softmax.
+            /// \param key_transposed Whether key is stored one key per row.
+            Attention(std::shared_ptr<Node> query,
+                      std::shared_ptr<Node> key,
+                      std::shared_ptr<Node> value,
+                      double scale,
+                      bool key_transposed);
+
+            double get_scale() const { return m_scale; }
+            bool get_is_key_transposed() const { return m_key_transposed; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            double m_scale;
+            bool m_key_transposed;
+        };
+    }
+}
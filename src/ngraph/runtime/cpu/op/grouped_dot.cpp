@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "grouped_dot.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+shared_ptr<Node> op::GroupedDot::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != get_input_size())
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+
+    return make_shared<GroupedDot>(new_args);
+}
+
+op::GroupedDot::GroupedDot(const NodeVector& args)
+    : RequiresTensorViewArgs("GroupedDot", args)
+{
+    if (args.size() < 2 || args.size() % 2 != 0)
+    {
+        throw ngraph_error("GroupedDot expects a non-empty list of argument pairs");
+    }
+
+    const Shape& shape_a = args.at(0)->get_shape();
+    const Shape& shape_b = args.at(1)->get_shape();
+    if (shape_a.size() != 2 || shape_b.size() != 2 || shape_a[1] != shape_b[0])
+    {
+        throw ngraph_error("GroupedDot arguments must be 2D matrices with matching inner sizes");
+    }
+
+    for (size_t i = 0; i < args.size(); i += 2)
+    {
+        if (args.at(i)->get_shape() != shape_a || args.at(i + 1)->get_shape() != shape_b)
+        {
+            throw ngraph_error("GroupedDot arguments must all have the same shapes");
+        }
+        if (args.at(i)->get_element_type() != element::f32 ||
+            args.at(i + 1)->get_element_type() != element::f32)
+        {
+            throw ngraph_error("GroupedDot only supports f32 arguments");
+        }
+    }
+
+    for (size_t i = 0; i < args.size(); i += 2)
+    {
+        add_output(element::f32, Shape{shape_a[0], shape_b[1]});
+    }
+}
@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A group of independent 2D f32 matrix products of the same shape, computed by a
+        ///        single batched GEMM call.
+        ///
+        /// The arguments are the pairs (a0, b0, a1, b1, ...) and output i is dot(ai, bi).
+        class GroupedDot : public util::RequiresTensorViewArgs
+        {
+        public:
+            GroupedDot(const NodeVector& args);
+
+            size_t get_group_size() const { return get_output_size(); }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+        };
+    }
+}
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "layer_norm.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::LayerNorm::LayerNorm(shared_ptr<Node> input,
+                         shared_ptr<Node> gamma,
+                         shared_ptr<Node> beta,
+                         double eps,
+                         size_t begin_norm_axis)
+    : RequiresTensorViewArgs("LayerNorm", {input, gamma, beta})
+    , m_eps(eps)
+    , m_begin_norm_axis(begin_norm_axis)
+{
+    const Shape& input_shape = input->get_shape();
+    if (begin_norm_axis >= input_shape.size())
+    {
+        throw ngraph_error("LayerNorm must normalize at least one axis of its input");
+    }
+    if (input->get_element_type() != gamma->get_element_type() ||
+        input->get_element_type() != beta->get_element_type())
+    {
+        throw ngraph_error("LayerNorm argument element types do not match");
+    }
+
+    Shape norm_shape(input_shape.begin() + begin_norm_axis, input_shape.end());
+    if (gamma->get_shape() != norm_shape || beta->get_shape() != norm_shape)
+    {
+        throw ngraph_error("LayerNorm gamma and beta must have the shape " +
+                           vector_to_string(norm_shape) + " of the normalized axes");
+    }
+
+    add_output(input->get_element_type(), input_shape);
+}
+
+shared_ptr<Node> op::LayerNorm::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 3)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<LayerNorm>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_eps, m_begin_norm_axis);
+}
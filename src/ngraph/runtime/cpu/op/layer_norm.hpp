@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Layer normalization, (input - mean) / sqrt(variance + eps) * gamma + beta,
+        ///        with the mean and variance taken over the trailing axes of input.
+        ///
+        /// Replaces the chain of reductions and elementwise ops it is usually written as, so
+        /// the input is read once for the statistics and once for the output.
+        class LayerNorm : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \param input The tensor to normalize.
+            /// \param gamma The scale, shaped like the normalized axes of input.
+            /// \param beta The shift, shaped like the normalized axes of input.
+            /// \param eps The value added to the variance.
+            /// \param begin_norm_axis The first of the normalized axes; the rest follow it.
+            LayerNorm(std::shared_ptr<Node> input,
+                      std::shared_ptr<Node> gamma,
+                      std::shared_ptr<Node> beta,
+                      double eps,
+                      size_t begin_norm_axis);
+
+            double get_eps_value() const { return m_eps; }
+            size_t get_begin_norm_axis() const { return m_begin_norm_axis; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            double m_eps;
+            size_t m_begin_norm_axis;
+        };
+    }
+}
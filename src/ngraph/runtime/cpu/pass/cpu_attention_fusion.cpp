@@ -0,0 +1,144 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
+
+#include "cpu_attention_fusion.hpp"
+
+using namespace ngraph;
+
+// A 2-D Dot contracting one axis, i.e. a plain matrix product
+static std::shared_ptr<op::Dot> as_matrix_product(const std::shared_ptr<Node>& node)
+{
+    auto dot = std::dynamic_pointer_cast<op::Dot>(node);
+    if (dot && dot->get_reduction_axes_count() == 1 && dot->get_shape().size() == 2 &&
+        dot->get_argument(0)->get_shape().size() == 2 &&
+        dot->get_argument(1)->get_shape().size() == 2)
+    {
+        return dot;
+    }
+    return nullptr;
+}
+
+// Reads the value of a Constant, possibly broadcast, whose elements are all equal
+static bool get_uniform_constant(const std::shared_ptr<Node>& node, float& value)
+{
+    auto source = node;
+    if (auto broadcast = std::dynamic_pointer_cast<op::Broadcast>(node))
+    {
+        source = broadcast->get_argument(0);
+    }
+    auto constant = std::dynamic_pointer_cast<op::Constant>(source);
+    if (!constant || constant->get_element_type() != element::f32)
+    {
+        return false;
+    }
+    auto values = constant->get_vector<float>();
+    if (values.empty())
+    {
+        return false;
+    }
+    for (float v : values)
+    {
+        if (v != values[0])
+        {
+            return false;
+        }
+    }
+    value = values[0];
+    return true;
+}
+
+bool runtime::cpu::pass::CPUAttentionFusion::run_on_function(
+    std::shared_ptr<ngraph::Function> function)
+{
+    bool replaced = false;
+    for (const auto& n : function->get_ordered_ops())
+    {
+        auto output_dot = as_matrix_product(n);
+        if (!output_dot || output_dot->get_element_type() != element::f32)
+        {
+            continue;
+        }
+        auto softmax = std::dynamic_pointer_cast<op::Softmax>(output_dot->get_argument(0));
+        if (!softmax || softmax->get_axes() != AxisSet{1} || softmax->get_users().size() != 1)
+        {
+            continue;
+        }
+
+        auto scores = softmax->get_argument(0);
+        double scale = 1.0;
+        if (std::dynamic_pointer_cast<op::Multiply>(scores) ||
+            std::dynamic_pointer_cast<op::Divide>(scores))
+        {
+            if (scores->get_users().size() != 1)
+            {
+                continue;
+            }
+            bool divide = std::dynamic_pointer_cast<op::Divide>(scores) != nullptr;
+            float value;
+            if (get_uniform_constant(scores->get_argument(1), value))
+            {
+                scale = divide ? 1.0 / value : value;
+                scores = scores->get_argument(0);
+            }
+            else if (!divide && get_uniform_constant(scores->get_argument(0), value))
+            {
+                scale = value;
+                scores = scores->get_argument(1);
+            }
+            else
+            {
+                continue;
+            }
+        }
+
+        auto score_dot = as_matrix_product(scores);
+        if (!score_dot || score_dot->get_users().size() != 1)
+        {
+            continue;
+        }
+
+        auto query = score_dot->get_argument(0);
+        auto key = score_dot->get_argument(1);
+        bool key_transposed = false;
+        auto reshape = std::dynamic_pointer_cast<op::Reshape>(key);
+        if (reshape && reshape->get_input_order() == AxisVector{1, 0} &&
+            reshape->get_argument(0)->get_shape().size() == 2)
+        {
+            key = reshape->get_argument(0);
+            key_transposed = true;
+        }
+
+        NGRAPH_DEBUG << "Fusing attention ending in " << output_dot->get_name();
+        auto attention = std::make_shared<op::Attention>(
+            query, key, output_dot->get_argument(1), scale, key_transposed);
+        ngraph::replace_node(output_dot, attention);
+        replaced = true;
+    }
+    return replaced;
+}
@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Replaces Dot(Softmax(Dot(query, key) [* scale]), value) over f32
+                ///        matrices with a single Attention op that computes the result in tiles.
+                ///
+                /// The scale may be a Multiply or Divide by a scalar Constant, broadcast or not.
+                /// A transposing Reshape of the key is folded into the op. The score Dot, the
+                /// scale and the Softmax must have no other users.
+                class CPUAttentionFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                    bool is_function_local() const override { return true; }
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/convert_layout.hpp"
+
+#include "cpu_constant_reorder_folding.hpp"
+
+using namespace ngraph;
+
+bool runtime::cpu::pass::CPUConstantReorderFolding::run_on_function(
+    std::shared_ptr<ngraph::Function> function)
+{
+    bool clobbered = false;
+
+    for (const auto& n : function->get_ordered_ops())
+    {
+        auto convert_layout = std::dynamic_pointer_cast<op::ConvertLayout>(n);
+        if (!convert_layout)
+        {
+            continue;
+        }
+        auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(n->get_argument(0));
+        if (!constant)
+        {
+            continue;
+        }
+
+        auto input_layout = std::static_pointer_cast<runtime::cpu::LayoutDescriptor>(
+            constant->get_output_tensor_view()->get_tensor_view_layout());
+        auto output_layout = std::static_pointer_cast<runtime::cpu::LayoutDescriptor>(
+            convert_layout->get_output_tensor_view()->get_tensor_view_layout());
+        if (!input_layout || !output_layout)
+        {
+            continue;
+        }
+        auto input_format = input_layout->get_mkldnn_format();
+        auto output_format = output_layout->get_mkldnn_format();
+
+        // Same adjustments as the ConvertLayout emitter: the input shape follows the input
+        // axis order, and filter reorders want oihw rather than nchw
+        const Shape& shape = constant->get_shape();
+        auto input_axis_order = input_layout->get_axis_order();
+        Shape input_shape(input_axis_order.size());
+        for (size_t idx = 0; idx < input_axis_order.size(); idx++)
+        {
+            input_shape[idx] = shape[input_axis_order[idx]];
+        }
+        auto mkldnn_input_format = input_format;
+        auto mkldnn_output_format = output_format;
+        if (input_format == mkldnn::memory::format::nchw &&
+            mkldnn_utils::is_mkldnn_filter_format(output_format))
+        {
+            mkldnn_input_format = mkldnn::memory::format::oihw;
+        }
+        if (output_format == mkldnn::memory::format::nchw &&
+            mkldnn_utils::is_mkldnn_filter_format(input_format))
+        {
+            mkldnn_output_format = mkldnn::memory::format::oihw;
+        }
+
+        const auto& et = constant->get_element_type();
+        auto mkldnn_et = mkldnn_utils::get_mkldnn_data_type(et);
+        mkldnn::memory::desc input_desc(
+            mkldnn::memory::dims(input_shape.begin(), input_shape.end()),
+            mkldnn_et,
+            mkldnn_input_format);
+        mkldnn::memory::desc output_desc(
+            mkldnn::memory::dims(shape.begin(), shape.end()), mkldnn_et, mkldnn_output_format);
+        mkldnn::memory::primitive_desc output_pd(output_desc, mkldnn_utils::global_cpu_engine);
+
+        // Blocked formats pad partial blocks, which would not fit in the buffer of a Constant
+        size_t size = shape_size(shape) * et.size();
+        if (output_pd.get_size() != size)
+        {
+            NGRAPH_DEBUG << "Not folding " << n->get_name() << ": format " << output_format
+                         << " pads " << constant->get_name();
+            continue;
+        }
+
+        std::vector<char> reordered(size);
+        mkldnn::memory input({input_desc, mkldnn_utils::global_cpu_engine},
+                             const_cast<void*>(constant->get_data_ptr()));
+        mkldnn::memory output(output_pd, reordered.data());
+        mkldnn::reorder prim(input, output);
+        mkldnn::stream s(mkldnn::stream::kind::eager);
+        s.submit({prim}).wait();
+
+        auto folded = std::make_shared<ngraph::op::Constant>(et, shape, reordered.data());
+        auto tv = folded->get_output_tensor_view();
+        auto layout =
+            std::make_shared<runtime::cpu::LayoutDescriptor>(*tv, output_layout->get_axis_order());
+        layout->set_mkldnn_format(output_format);
+        tv->set_tensor_view_layout(layout);
+
+        NGRAPH_DEBUG << "Reordered " << constant->get_name() << " from " << input_format << " to "
+                     << output_format << " at compile time";
+        function->replace_node(convert_layout, folded);
+        clobbered = true;
+    }
+
+    return clobbered;
+}
@@ -0,0 +1,270 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <memory>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/runtime/cpu/op/layer_norm.hpp"
+
+#include "cpu_layer_norm_fusion.hpp"
+
+using namespace ngraph;
+
+// Reads a scalar f32 Constant, possibly broadcast or stored as a tensor of equal elements
+static bool get_scalar_value(const std::shared_ptr<Node>& node, float& value)
+{
+    auto source = node;
+    if (auto broadcast = std::dynamic_pointer_cast<op::Broadcast>(node))
+    {
+        source = broadcast->get_argument(0);
+    }
+    auto constant = std::dynamic_pointer_cast<op::Constant>(source);
+    if (!constant || constant->get_element_type() != element::f32 ||
+        shape_size(constant->get_shape()) == 0)
+    {
+        return false;
+    }
+    auto values = constant->get_vector<float>();
+    for (float v : values)
+    {
+        if (v != values[0])
+        {
+            return false;
+        }
+    }
+    value = values[0];
+    return true;
+}
+
+// The axes from begin to the last axis of a tensor of the given rank
+static AxisSet get_axes_from(size_t begin, size_t rank)
+{
+    AxisSet axes;
+    for (size_t i = begin; i < rank; i++)
+    {
+        axes.insert(i);
+    }
+    return axes;
+}
+
+// If node is Sum(x) / n or Sum(x) * (1 / n), with the Sum over the trailing axes of x starting
+// at begin_axis and n their element count, returns x and sets begin_axis
+static std::shared_ptr<Node> match_mean(const std::shared_ptr<Node>& node, size_t& begin_axis)
+{
+    bool divide = std::dynamic_pointer_cast<op::Divide>(node) != nullptr;
+    if (!divide && !std::dynamic_pointer_cast<op::Multiply>(node))
+    {
+        return nullptr;
+    }
+    for (size_t i = 0; i < (divide ? 1 : 2); i++)
+    {
+        auto sum = std::dynamic_pointer_cast<op::Sum>(node->get_argument(i));
+        float value;
+        if (!sum || !get_scalar_value(node->get_argument(1 - i), value))
+        {
+            continue;
+        }
+        auto x = sum->get_argument(0);
+        const Shape& shape = x->get_shape();
+        const AxisSet& axes = sum->get_reduction_axes();
+        if (axes.empty() || axes != get_axes_from(*axes.begin(), shape.size()))
+        {
+            continue;
+        }
+        size_t n = shape_size(Shape(shape.begin() + *axes.begin(), shape.end()));
+        if ((divide && value == static_cast<float>(n)) ||
+            (!divide && std::abs(static_cast<double>(value) * n - 1.0) < 1e-6))
+        {
+            begin_axis = *axes.begin();
+            return x;
+        }
+    }
+    return nullptr;
+}
+
+// If node is centered * centered or Power(centered, 2), returns centered
+static std::shared_ptr<Node> match_square(const std::shared_ptr<Node>& node)
+{
+    if (std::dynamic_pointer_cast<op::Multiply>(node) &&
+        node->get_argument(0) == node->get_argument(1))
+    {
+        return node->get_argument(0);
+    }
+    float exponent;
+    if (std::dynamic_pointer_cast<op::Power>(node) &&
+        get_scalar_value(node->get_argument(1), exponent) && exponent == 2)
+    {
+        return node->get_argument(0);
+    }
+    return nullptr;
+}
+
+// If node is Broadcast(value) along the axes before begin_axis, returns value
+static std::shared_ptr<Node> match_row_broadcast(const std::shared_ptr<Node>& node,
+                                                 size_t begin_axis)
+{
+    auto broadcast = std::dynamic_pointer_cast<op::Broadcast>(node);
+    if (broadcast && broadcast->get_broadcast_axes() == get_axes_from(0, begin_axis) &&
+        broadcast->get_argument(0)->get_shape().size() == node->get_shape().size() - begin_axis)
+    {
+        return broadcast->get_argument(0);
+    }
+    return nullptr;
+}
+
+// If norm normalizes some x over its trailing axes, returns x and sets begin_axis and eps
+static std::shared_ptr<Node>
+    match_normalized(const std::shared_ptr<Node>& norm, size_t& begin_axis, float& eps)
+{
+    // Split norm into centered and the Broadcast of its standard deviation or its inverse
+    std::shared_ptr<Node> centered;
+    std::shared_ptr<Node> deviation;
+    std::shared_ptr<Node> sqrt;
+    if (std::dynamic_pointer_cast<op::Divide>(norm))
+    {
+        centered = norm->get_argument(0);
+        deviation = norm->get_argument(1);
+        if (auto broadcast = std::dynamic_pointer_cast<op::Broadcast>(deviation))
+        {
+            sqrt = std::dynamic_pointer_cast<op::Sqrt>(broadcast->get_argument(0));
+        }
+    }
+    else if (std::dynamic_pointer_cast<op::Multiply>(norm))
+    {
+        for (size_t i = 0; i < 2 && !sqrt; i++)
+        {
+            auto broadcast = std::dynamic_pointer_cast<op::Broadcast>(norm->get_argument(i));
+            auto inverse =
+                broadcast ? std::dynamic_pointer_cast<op::Divide>(broadcast->get_argument(0))
+                          : nullptr;
+            float one;
+            if (inverse && get_scalar_value(inverse->get_argument(0), one) && one == 1)
+            {
+                sqrt = std::dynamic_pointer_cast<op::Sqrt>(inverse->get_argument(1));
+                centered = norm->get_argument(1 - i);
+                deviation = broadcast;
+            }
+        }
+    }
+    if (!sqrt)
+    {
+        return nullptr;
+    }
+
+    // Variance plus epsilon
+    auto var_eps = std::dynamic_pointer_cast<op::Add>(sqrt->get_argument(0));
+    if (!var_eps)
+    {
+        return nullptr;
+    }
+    std::shared_ptr<Node> var;
+    for (size_t i = 0; i < 2 && !var; i++)
+    {
+        if (get_scalar_value(var_eps->get_argument(i), eps))
+        {
+            var = var_eps->get_argument(1 - i);
+        }
+    }
+    auto squared = var ? match_mean(var, begin_axis) : nullptr;
+    if (!squared || match_square(squared) != centered)
+    {
+        return nullptr;
+    }
+
+    // Centered input, with the mean taken over the same axes as the variance
+    auto subtract = std::dynamic_pointer_cast<op::Subtract>(centered);
+    if (!subtract)
+    {
+        return nullptr;
+    }
+    auto x = subtract->get_argument(0);
+    AxisSet norm_axes = get_axes_from(begin_axis, x->get_shape().size());
+    auto mean_broadcast = std::dynamic_pointer_cast<op::Broadcast>(subtract->get_argument(1));
+    auto deviation_broadcast = std::dynamic_pointer_cast<op::Broadcast>(deviation);
+    if (!mean_broadcast || mean_broadcast->get_broadcast_axes() != norm_axes ||
+        !deviation_broadcast || deviation_broadcast->get_broadcast_axes() != norm_axes)
+    {
+        return nullptr;
+    }
+    size_t mean_begin_axis;
+    if (match_mean(mean_broadcast->get_argument(0), mean_begin_axis) != x ||
+        mean_begin_axis != begin_axis)
+    {
+        return nullptr;
+    }
+    return x;
+}
+
+bool runtime::cpu::pass::CPULayerNormFusion::run_on_function(
+    std::shared_ptr<ngraph::Function> function)
+{
+    bool replaced = false;
+    for (const auto& n : function->get_ordered_ops())
+    {
+        if (!std::dynamic_pointer_cast<op::Add>(n) || n->get_element_type() != element::f32)
+        {
+            continue;
+        }
+
+        std::shared_ptr<op::LayerNorm> layer_norm;
+        for (size_t i = 0; i < 2 && !layer_norm; i++)
+        {
+            auto scaled = std::dynamic_pointer_cast<op::Multiply>(n->get_argument(1 - i));
+            if (!scaled || scaled->get_users().size() != 1)
+            {
+                continue;
+            }
+            for (size_t j = 0; j < 2 && !layer_norm; j++)
+            {
+                auto norm = scaled->get_argument(1 - j);
+                size_t begin_axis;
+                float eps;
+                auto x = norm->get_users().size() == 1
+                             ? match_normalized(norm, begin_axis, eps)
+                             : nullptr;
+                if (!x)
+                {
+                    continue;
+                }
+                auto gamma = match_row_broadcast(scaled->get_argument(j), begin_axis);
+                auto beta = match_row_broadcast(n->get_argument(i), begin_axis);
+                if (gamma && beta)
+                {
+                    layer_norm = std::make_shared<op::LayerNorm>(x, gamma, beta, eps, begin_axis);
+                }
+            }
+        }
+
+        if (layer_norm)
+        {
+            NGRAPH_DEBUG << "Fusing layer normalization ending in " << n->get_name();
+            ngraph::replace_node(n, layer_norm);
+            replaced = true;
+        }
+    }
+    return replaced;
+}
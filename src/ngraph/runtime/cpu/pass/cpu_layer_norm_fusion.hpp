@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Replaces layer normalization written out in primitive f32 ops with a
+                ///        single LayerNorm op.
+                ///
+                /// The recognised form is
+                ///     mean = Sum(x) / n
+                ///     centered = x - Broadcast(mean)
+                ///     variance = Sum(centered * centered) / n
+                ///     norm = centered / Broadcast(Sqrt(variance + eps)), or
+                ///            centered * Broadcast(1 / Sqrt(variance + eps))
+                ///     output = norm * Broadcast(gamma) + Broadcast(beta)
+                /// where the sums run over the trailing axes of x, n is their element count and
+                /// eps is a scalar Constant. Dividing by n may also be written as multiplying by
+                /// 1 / n, squaring as Power(centered, 2), and the Multiply and Add operands may
+                /// come in either order.
+                class CPULayerNormFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                    bool is_function_local() const override { return true; }
+                };
+            }
+        }
+    }
+}
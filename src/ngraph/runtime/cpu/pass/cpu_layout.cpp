@@ -19,6 +19,7 @@
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_set>
 
 #include <mkldnn.hpp>
 
@@ -38,6 +39,8 @@
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
@@ -234,6 +237,166 @@ void runtime::cpu::pass::CPULayout::set_default_layouts(
     }
 }
 
+static size_t get_reorder_bytes(const descriptor::Output& output)
+{
+    return shape_size(output.get_shape()) * output.get_element_type().size();
+}
+
+// Elementwise arithmetic computes every result element from the operand elements at the same
+// offset, so it gives the same answer in any format all its operands share
+static bool is_layout_agnostic(const Node* node)
+{
+    return (dynamic_cast<const ngraph::op::util::UnaryElementwiseArithmetic*>(node) ||
+            dynamic_cast<const ngraph::op::util::BinaryElementwiseArithmetic*>(node)) &&
+           !dynamic_cast<const ngraph::op::Softmax*>(node);
+}
+
+// The elementwise kernels walk shape_size elements of a flat buffer, which only covers a tensor
+// when its format is a permutation of it with no padding, as blocked formats have when the
+// channel count is not a multiple of the block
+static bool is_dense_data_format(memory::format fmt, const Shape& shape)
+{
+    switch (fmt)
+    {
+    case memory::format::x:
+    case memory::format::nc:
+    case memory::format::nchw:
+    case memory::format::nhwc:
+    case memory::format::chwn:
+    case memory::format::ncdhw:
+    case memory::format::ndhwc: return true;
+    case memory::format::nChw8c: return shape.size() == 4 && shape[1] % 8 == 0;
+    case memory::format::nChw16c: return shape.size() == 4 && shape[1] % 16 == 0;
+    case memory::format::nCdhw16c: return shape.size() == 5 && shape[1] % 16 == 0;
+    default: return false;
+    }
+}
+
+enum class FormatPreference
+{
+    Any,
+    Native,
+    Blocked
+};
+
+// The kind of format a user will convert its input to. Users that have not been laid out yet
+// are judged by how their handler treats them.
+static FormatPreference get_format_preference(const Node* user)
+{
+    if (auto result = dynamic_cast<const ngraph::op::Result*>(user))
+    {
+        return result->needs_default_layout() ? FormatPreference::Native
+                                              : FormatPreference::Any;
+    }
+    if (is_layout_agnostic(user) || dynamic_cast<const ngraph::op::Concat*>(user))
+    {
+        return FormatPreference::Any;
+    }
+    if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(user))
+    {
+        return FormatPreference::Blocked;
+    }
+    return FormatPreference::Native;
+}
+
+// Estimated reorders if node takes all its inputs and produces its result in the given format:
+// the inputs held in another format and, for each user that wants the other kind of format,
+// the result.
+static runtime::cpu::pass::ReorderStats get_reorder_cost(const Node* node, memory::format fmt)
+{
+    runtime::cpu::pass::ReorderStats cost;
+    for (const descriptor::Input& input : node->get_inputs())
+    {
+        auto input_format =
+            runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, input.get_index());
+        if (input_format != memory::format::format_undef &&
+            !runtime::cpu::mkldnn_utils::compare_mkldnn_formats(input_format, fmt))
+        {
+            cost.count++;
+            cost.bytes += get_reorder_bytes(input.get_output());
+        }
+    }
+
+    const descriptor::Output& output = node->get_outputs().at(0);
+    bool native = runtime::cpu::mkldnn_utils::compare_mkldnn_formats(
+        fmt, runtime::cpu::mkldnn_utils::CreateNativeDataFormat(output.get_shape()));
+    for (const descriptor::Input* user_input : output.get_inputs())
+    {
+        auto preference = get_format_preference(user_input->get_node().get());
+        if ((preference == FormatPreference::Native && !native) ||
+            (preference == FormatPreference::Blocked && native))
+        {
+            cost.count++;
+            cost.bytes += get_reorder_bytes(output);
+        }
+    }
+    return cost;
+}
+
+// Picks the format of node among the candidates. The first candidate is the op-local choice;
+// another is taken only when it costs no more reorders and no more bytes, and strictly less of
+// one of them, so the savings recorded in avoided are never negative.
+static memory::format select_format(const Node* node,
+                                    const vector<memory::format>& candidates,
+                                    runtime::cpu::pass::ReorderStats& avoided)
+{
+    auto selected = candidates.at(0);
+    auto local_cost = get_reorder_cost(node, selected);
+    auto selected_cost = local_cost;
+    for (auto fmt : candidates)
+    {
+        auto cost = get_reorder_cost(node, fmt);
+        if (cost.count <= selected_cost.count && cost.bytes <= selected_cost.bytes &&
+            (cost.count < selected_cost.count || cost.bytes < selected_cost.bytes))
+        {
+            selected = fmt;
+            selected_cost = cost;
+        }
+    }
+    if (selected != candidates.at(0))
+    {
+        NGRAPH_DEBUG << "Selected layout " << selected << " for " << node->get_name()
+                     << " saving " << local_cost.bytes - selected_cost.bytes << " reorder bytes";
+    }
+    avoided.count += local_cost.count - selected_cost.count;
+    avoided.bytes += local_cost.bytes - selected_cost.bytes;
+    return selected;
+}
+
+void runtime::cpu::pass::CPULayout::set_propagated_layouts(
+    runtime::cpu::CPU_ExternalFunction* external_function,
+    std::shared_ptr<Node> node,
+    ReorderStats& avoided)
+{
+    if (is_layout_agnostic(node.get()) && node->get_input_size() > 0)
+    {
+        auto shape = node->get_input_shape(0);
+        auto input_format = mkldnn_utils::get_input_mkldnn_format(node.get(), 0);
+        bool shared_format = is_dense_data_format(input_format, shape);
+        for (size_t i = 1; i < node->get_input_size(); i++)
+        {
+            shared_format = shared_format && node->get_input_shape(i) == shape &&
+                            mkldnn_utils::compare_mkldnn_formats(
+                                mkldnn_utils::get_input_mkldnn_format(node.get(), i), input_format);
+        }
+
+        if (shared_format)
+        {
+            vector<memory::format> candidates{mkldnn_utils::CreateNativeDataFormat(shape),
+                                              input_format};
+            auto selected = select_format(node.get(), candidates, avoided);
+            if (selected == input_format)
+            {
+                vector<memory::format> prim_output_formats;
+                prim_output_formats.push_back(input_format);
+                set_output_layouts(node, prim_output_formats);
+                return;
+            }
+        }
+    }
+    set_default_layouts(external_function, node);
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -1149,7 +1312,7 @@ namespace ngraph
                     }
                     else
                     {
-                        set_default_layouts(external_function, node);
+                        set_propagated_layouts(external_function, node, avoided);
                     }
                 }
 
@@ -1166,7 +1329,7 @@ namespace ngraph
                     }
                     else
                     {
-                        set_default_layouts(external_function, node);
+                        set_propagated_layouts(external_function, node, avoided);
                     }
                 }
 
@@ -1353,21 +1516,23 @@ namespace ngraph
                 {
                     if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node.get()))
                     {
-                        auto input0_layout =
-                            runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node.get(), 0);
+                        vector<memory::format> candidates{
+                            runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node.get(), 0),
+                            runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node.get(), 1)};
+                        auto layout = select_format(node.get(), candidates, avoided);
 
                         vector<memory::format> prim_input_formats;
                         vector<memory::format> prim_output_formats;
-                        prim_input_formats.push_back(input0_layout);
-                        prim_input_formats.push_back(input0_layout);
-                        prim_output_formats.push_back(input0_layout);
+                        prim_input_formats.push_back(layout);
+                        prim_input_formats.push_back(layout);
+                        prim_output_formats.push_back(layout);
                         node =
                             insert_input_conversions(external_function, node, prim_input_formats);
                         set_output_layouts(node, prim_output_formats);
                     }
                     else
                     {
-                        set_default_layouts(external_function, node);
+                        set_propagated_layouts(external_function, node, avoided);
                     }
                 }
 
@@ -1377,9 +1542,14 @@ namespace ngraph
                     if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node.get()))
                     {
                         auto concat = static_cast<const ngraph::op::Concat*>(node.get());
-                        auto input0_layout =
-                            runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node.get(), 0);
                         size_t num_inputs = node->get_input_size();
+                        vector<memory::format> candidates;
+                        for (size_t i = 0; i < num_inputs; i++)
+                        {
+                            candidates.push_back(
+                                runtime::cpu::mkldnn_utils::get_input_mkldnn_format(concat, i));
+                        }
+                        auto layout = select_format(concat, candidates, avoided);
                         size_t concat_dim = concat->get_concatenation_axis();
                         auto result_shape = node->get_output_shape(0);
                         memory::data_type et = runtime::cpu::mkldnn_utils::get_mkldnn_data_type(
@@ -1388,7 +1558,6 @@ namespace ngraph
                         auto result_desc =
                             memory::desc(mkldnn_result_shape, et, memory::format::any);
 
-                        std::vector<mkldnn::memory::format> inputs_format;
                         std::vector<mkldnn::memory::desc> inputs_data_desc;
                         std::vector<mkldnn::memory::primitive_desc> inputs_pd;
                         vector<TensorViewWrapper> in;
@@ -1399,17 +1568,12 @@ namespace ngraph
                             in.push_back(TensorViewWrapper(tv, "None"));
                         }
                         for (size_t i = 0; i < num_inputs; i++)
-                        {
-                            inputs_format.push_back(
-                                runtime::cpu::mkldnn_utils::get_input_mkldnn_format(concat, i));
-                        }
-                        for (size_t i = 0; i < num_inputs; i++)
                         {
                             inputs_data_desc.push_back(mkldnn::memory::desc(
                                 mkldnn::memory::dims(in[i].get_shape().begin(),
                                                      in[i].get_shape().end()),
                                 mkldnn_utils::get_mkldnn_data_type(in[i].get_element_type()),
-                                inputs_format[i]));
+                                layout));
                         }
                         for (size_t i = 0; i < inputs_data_desc.size(); i++)
                         {
@@ -1423,7 +1587,7 @@ namespace ngraph
                         vector<memory::format> prim_output_formats;
                         for (size_t i = 0; i < num_inputs; i++)
                         {
-                            prim_input_formats.push_back(input0_layout);
+                            prim_input_formats.push_back(layout);
                         }
                         prim_output_formats.push_back(static_cast<memory::format>(
                             prim_desc.dst_primitive_desc().desc().data.format));
@@ -1567,13 +1731,49 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         auto handler = s_dispatcher.find(TI(n));
         if (handler != s_dispatcher.end())
         {
-            handler->second(m_external_function, node);
+            handler->second(m_external_function, node, m_avoided);
         }
         else
         {
-            set_default_layouts(m_external_function, node);
+            set_propagated_layouts(m_external_function, node, m_avoided);
+        }
+    }
+
+    // Results are never replaced, so every reorder inserted above is reachable from them
+    std::unordered_set<Node*> visited;
+    std::vector<Node*> stack;
+    for (const auto& node : nodes)
+    {
+        if (node->is_output())
+        {
+            stack.push_back(node.get());
+        }
+    }
+    ReorderStats inserted;
+    while (!stack.empty())
+    {
+        Node* node = stack.back();
+        stack.pop_back();
+        if (!visited.insert(node).second)
+        {
+            continue;
+        }
+        if (dynamic_cast<runtime::cpu::op::ConvertLayout*>(node))
+        {
+            inserted.count++;
+            inserted.bytes += get_reorder_bytes(node->get_outputs().at(0));
+        }
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            stack.push_back(input.get_output().get_node().get());
         }
     }
+    m_inserted.count += inserted.count;
+    m_inserted.bytes += inserted.bytes;
 
+    NGRAPH_DEBUG << "Layout assignment inserted " << m_inserted.count << " reorders ("
+                 << m_inserted.bytes << " bytes); choosing formats op by op would have inserted "
+                 << m_inserted.count + m_avoided.count << " ("
+                 << m_inserted.bytes + m_avoided.bytes << " bytes)";
     return false;
 }
@@ -21,7 +21,8 @@
 
 #define LAYOUT_DECL(op_type)                                                                       \
     layout<op_type>(ngraph::runtime::cpu::CPU_ExternalFunction * external_function,                \
-                    std::shared_ptr<ngraph::Node> node)
+                    std::shared_ptr<ngraph::Node> node,                                            \
+                    ngraph::runtime::cpu::pass::ReorderStats & avoided)
 
 namespace ngraph
 {
@@ -31,11 +32,26 @@ namespace ngraph
         {
             namespace pass
             {
-                using LayoutFunction =
-                    std::function<void(CPU_ExternalFunction*, std::shared_ptr<ngraph::Node>)>;
+                /// \brief Number and byte volume of ConvertLayout reorders.
+                struct ReorderStats
+                {
+                    size_t count = 0;
+                    size_t bytes = 0;
+                };
+
+                using LayoutFunction = std::function<void(
+                    CPU_ExternalFunction*, std::shared_ptr<ngraph::Node>, ReorderStats&)>;
 
                 using LayoutOpMap = std::unordered_map<std::type_index, LayoutFunction>;
 
+                /// \brief Assigns mkldnn memory formats to every tensor and inserts ConvertLayout
+                ///        reorders where a consumer needs a different format.
+                ///
+                /// Ops that may pick among the formats of their inputs (Add, Concat and the
+                /// layout-agnostic elementwise ops) choose the format with the lowest estimated
+                /// reorder volume, counting both the inputs that would need converting and the
+                /// users of the result, so blocked formats such as nChw16c flow through them
+                /// instead of being converted back to native and forward again.
                 class CPULayout : public ngraph::pass::CallGraphPass
                 {
                 public:
@@ -49,10 +65,18 @@ namespace ngraph
                     template <typename OP>
                     static void
                         layout(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
-                               std::shared_ptr<ngraph::Node> node);
+                               std::shared_ptr<ngraph::Node> node,
+                               ReorderStats& avoided);
 
+                    /// \return The reorders inserted by the last run.
+                    const ReorderStats& get_inserted_reorders() const { return m_inserted; }
+                    /// \return The estimated reorders that choosing formats op by op, always
+                    ///         following the first input, would have inserted in addition.
+                    const ReorderStats& get_avoided_reorders() const { return m_avoided; }
                 private:
                     CPU_ExternalFunction* m_external_function;
+                    ReorderStats m_inserted;
+                    ReorderStats m_avoided;
                     static std::shared_ptr<Node> insert_input_conversions(
                         CPU_ExternalFunction* external_function,
                         std::shared_ptr<Node>& node,
@@ -63,6 +87,9 @@ namespace ngraph
                     static void set_default_layouts(CPU_ExternalFunction* external_function,
                                                     std::shared_ptr<Node> node,
                                                     bool use_replace);
+                    static void set_propagated_layouts(CPU_ExternalFunction* external_function,
+                                                       std::shared_ptr<Node> node,
+                                                       ReorderStats& avoided);
                 };
             }
         }
@@ -15,24 +15,31 @@
 *******************************************************************************/
 
 #include <array>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <numeric>
 #include <stack>
+#include <tuple>
 #include <typeindex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "cpu_mat_fusion.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/grouped_dot.hpp"
 
 using namespace ngraph;
 
@@ -421,3 +428,247 @@ bool runtime::cpu::pass::CPUBatchFusion::run_on_function(std::shared_ptr<Functio
     }
     return modified;
 }
+
+// Whether a later fusion consumes the Dot: CoreFusion folds a following BatchNorm into its
+// weights and CPUFusion turns a bias added through a Broadcast into MatmulBias. Fusing such a
+// Dot horizontally would hide it from those patterns behind a Slice or a GetOutputElement.
+static bool feeds_later_fusion(const std::shared_ptr<Node>& dot)
+{
+    for (auto user : dot->get_users())
+    {
+        if (std::dynamic_pointer_cast<op::BatchNorm>(user))
+        {
+            return true;
+        }
+        if (std::dynamic_pointer_cast<op::Add>(user))
+        {
+            for (auto arg : user->get_arguments())
+            {
+                if (arg != dot && std::dynamic_pointer_cast<op::Broadcast>(arg))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+// A Dot contracting one axis of an input with 2D constant weights
+static bool is_weights_dot(const std::shared_ptr<Node>& n)
+{
+    auto dot = std::dynamic_pointer_cast<op::Dot>(n);
+    return dot && dot->get_reduction_axes_count() == 1 &&
+           dot->get_argument(1)->get_shape().size() == 2 &&
+           dot->get_argument(0) != dot->get_argument(1) &&
+           std::dynamic_pointer_cast<op::Constant>(dot->get_argument(1)) != nullptr;
+}
+
+// Finds the Add of a constant bias broadcast along all but the last axis of the Dot, which
+// CPUFusion would turn into MatmulBias. Such a bias can be concatenated like the weights, so
+// only a Dot feeding another later fusion, such as a BatchNorm folded by CoreFusion or any
+// other bias, is rejected.
+static bool get_dot_bias(const std::shared_ptr<Node>& dot,
+                         std::shared_ptr<Node>& add,
+                         std::shared_ptr<op::Constant>& bias)
+{
+    add = nullptr;
+    bias = nullptr;
+    if (!feeds_later_fusion(dot))
+    {
+        return true;
+    }
+
+    auto users = dot->get_users();
+    if (users.size() != 1 || !std::dynamic_pointer_cast<op::Add>(users.at(0)))
+    {
+        return false;
+    }
+    for (auto user : users.at(0)->get_users())
+    {
+        if (std::dynamic_pointer_cast<op::BatchNorm>(user))
+        {
+            return false;
+        }
+    }
+
+    const Shape& shape = dot->get_shape();
+    AxisSet bias_axes;
+    for (size_t i = 0; i + 1 < shape.size(); i++)
+    {
+        bias_axes.insert(i);
+    }
+    auto arg = users.at(0)->get_argument(users.at(0)->get_argument(0) == dot ? 1 : 0);
+    auto broadcast = std::dynamic_pointer_cast<op::Broadcast>(arg);
+    if (!broadcast || broadcast->get_broadcast_axes() != bias_axes)
+    {
+        return false;
+    }
+    auto constant = std::dynamic_pointer_cast<op::Constant>(broadcast->get_argument(0));
+    if (!constant || constant->get_element_type() != dot->get_element_type())
+    {
+        return false;
+    }
+    add = users.at(0);
+    bias = constant;
+    return true;
+}
+
+// Dots sharing their input are replaced by one Dot against the column-wise concatenation of
+// their weights. Each original result is a slice of the last axis of the combined product.
+// When some of the Dots add a bias, the biases are concatenated too, with zeros for the Dots
+// without one, and added to the combined product so CPUFusion still emits one MatmulBias.
+static bool fuse_shared_input_dots(std::shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto n : function->get_ordered_ops())
+    {
+        NodeVector dots;
+        NodeVector adds;
+        std::vector<std::shared_ptr<op::Constant>> biases;
+        bool has_bias = false;
+        std::unordered_set<Node*> seen;
+        for (auto user : n->get_users())
+        {
+            std::shared_ptr<Node> add;
+            std::shared_ptr<op::Constant> bias;
+            if (seen.insert(user.get()).second && is_weights_dot(user) &&
+                user->get_argument(0) == n && get_dot_bias(user, add, bias))
+            {
+                dots.push_back(user);
+                adds.push_back(add);
+                biases.push_back(bias);
+                has_bias |= (bias != nullptr);
+            }
+        }
+        if (dots.size() < 2)
+        {
+            continue;
+        }
+
+        const element::Type& et = dots.at(0)->get_element_type();
+        size_t rows = dots.at(0)->get_argument(1)->get_shape()[0];
+        size_t columns = 0;
+        for (auto dot : dots)
+        {
+            columns += dot->get_argument(1)->get_shape()[1];
+        }
+
+        // Interleave the rows of the weights so the combined constant is [rows, columns]
+        std::vector<char> weights(rows * columns * et.size());
+        std::vector<char> bias_data(columns * et.size());
+        size_t column_offset = 0;
+        for (size_t i = 0; i < dots.size(); i++)
+        {
+            auto constant = std::static_pointer_cast<op::Constant>(dots[i]->get_argument(1));
+            size_t width = constant->get_shape()[1];
+            const char* data = static_cast<const char*>(constant->get_data_ptr());
+            for (size_t r = 0; r < rows; r++)
+            {
+                std::memcpy(&weights[(r * columns + column_offset) * et.size()],
+                            data + r * width * et.size(),
+                            width * et.size());
+            }
+            if (biases[i])
+            {
+                std::memcpy(&bias_data[column_offset * et.size()],
+                            biases[i]->get_data_ptr(),
+                            width * et.size());
+            }
+            column_offset += width;
+        }
+
+        auto combined_weights =
+            std::make_shared<op::Constant>(et, Shape{rows, columns}, weights.data());
+        std::shared_ptr<Node> combined = std::make_shared<op::Dot>(n, combined_weights);
+        const Shape combined_shape = combined->get_shape();
+        size_t last = combined_shape.size() - 1;
+        if (has_bias)
+        {
+            AxisSet bias_axes;
+            for (size_t i = 0; i < last; i++)
+            {
+                bias_axes.insert(i);
+            }
+            auto combined_bias =
+                std::make_shared<op::Constant>(et, Shape{columns}, bias_data.data());
+            combined = combined + std::make_shared<op::Broadcast>(
+                                      combined_bias, combined_shape, bias_axes);
+        }
+
+        column_offset = 0;
+        for (size_t i = 0; i < dots.size(); i++)
+        {
+            size_t width = dots[i]->get_argument(1)->get_shape()[1];
+            Coordinate lower_bounds(combined_shape.size(), 0);
+            Coordinate upper_bounds(combined_shape);
+            lower_bounds[last] = column_offset;
+            upper_bounds[last] = column_offset + width;
+            auto slice = std::make_shared<op::Slice>(combined, lower_bounds, upper_bounds);
+            function->replace_node(adds[i] ? adds[i] : dots[i], slice);
+            column_offset += width;
+        }
+        modified = true;
+    }
+    return modified;
+}
+
+// Independent 2D f32 Dots of equal shapes are computed by one GroupedDot. A node's depth is the
+// longest path to it from the inputs, so Dots of equal depth can never depend on each other.
+static bool group_independent_dots(std::shared_ptr<Function> function)
+{
+    std::unordered_map<Node*, size_t> depth;
+    std::map<std::tuple<size_t, Shape, Shape>, NodeVector> groups;
+    for (auto n : function->get_ordered_ops())
+    {
+        size_t d = 0;
+        for (auto arg : n->get_arguments())
+        {
+            d = std::max(d, depth[arg.get()] + 1);
+        }
+        depth[n.get()] = d;
+
+        auto dot = std::dynamic_pointer_cast<op::Dot>(n);
+        if (dot && !feeds_later_fusion(dot) && dot->get_reduction_axes_count() == 1 &&
+            dot->get_element_type() == element::f32 &&
+            dot->get_argument(0)->get_shape().size() == 2 &&
+            dot->get_argument(1)->get_shape().size() == 2)
+        {
+            groups[std::make_tuple(
+                       d, dot->get_argument(0)->get_shape(), dot->get_argument(1)->get_shape())]
+                .push_back(n);
+        }
+    }
+
+    bool modified = false;
+    for (auto& group : groups)
+    {
+        NodeVector& dots = group.second;
+        if (dots.size() < 2)
+        {
+            continue;
+        }
+
+        NodeVector args;
+        for (auto dot : dots)
+        {
+            args.push_back(dot->get_argument(0));
+            args.push_back(dot->get_argument(1));
+        }
+        auto grouped_dot = std::make_shared<op::GroupedDot>(args);
+        for (size_t i = 0; i < dots.size(); i++)
+        {
+            function->replace_node(dots[i],
+                                   std::make_shared<op::GetOutputElement>(grouped_dot, i));
+        }
+        modified = true;
+    }
+    return modified;
+}
+
+bool runtime::cpu::pass::CPUHorizontalFusion::run_on_function(std::shared_ptr<Function> function)
+{
+    bool modified = fuse_shared_input_dots(function);
+    modified |= group_independent_dots(function);
+    return modified;
+}
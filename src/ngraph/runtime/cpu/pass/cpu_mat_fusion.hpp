@@ -36,6 +36,23 @@ namespace ngraph
                 public:
                     bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
                 };
+
+                /// \brief Horizontally fuses independent sibling Dots.
+                ///
+                /// Dots that multiply the same input by different constant weights become a
+                /// single Dot against the weights concatenated at compile time, with each
+                /// original result sliced out of the wider product. The remaining independent
+                /// 2D f32 Dots with equal shapes are grouped into one GroupedDot, which issues a
+                /// single batched GEMM. Constant biases added to the sibling Dots through a
+                /// Broadcast are concatenated as well, so CPUFusion, which runs later, emits one
+                /// MatmulBias for all of them. Dots followed by a BatchNorm or by any other bias
+                /// are left alone for CoreFusion and CPUFusion.
+                class CPUHorizontalFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                    bool is_function_local() const override { return true; }
+                };
             }
         }
     }
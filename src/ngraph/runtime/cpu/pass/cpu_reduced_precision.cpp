@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/tanh.hpp"
+
+#include "cpu_reduced_precision.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool is_reduced_precision(const element::Type& type)
+{
+    return type == element::f16 || type == element::bf16;
+}
+
+// Storage ops move reduced precision data without computing on it
+static bool is_storage_op(const shared_ptr<Node>& node)
+{
+    return dynamic_pointer_cast<op::Parameter>(node) || dynamic_pointer_cast<op::Constant>(node) ||
+           dynamic_pointer_cast<op::Result>(node) || dynamic_pointer_cast<op::Convert>(node);
+}
+
+#define TI(x) type_index(typeid(x))
+
+// Ops with kernels that read and write f16 and bf16 directly, widening in registers
+static const unordered_set<type_index> s_widening_ops{TI(op::Add),
+                                                      TI(op::Multiply),
+                                                      TI(op::Abs),
+                                                      TI(op::Ceiling),
+                                                      TI(op::Relu),
+                                                      TI(op::Exp),
+                                                      TI(op::Log),
+                                                      TI(op::Tanh),
+                                                      TI(op::Sigmoid),
+                                                      TI(op::Dot)};
+
+static bool has_widening_kernel(const shared_ptr<Node>& node)
+{
+    const Node& n = *node;
+    if (s_widening_ops.count(TI(n)) == 0)
+    {
+        return false;
+    }
+    for (shared_ptr<Node> arg : node->get_arguments())
+    {
+        if (arg->get_element_type() != node->get_element_type())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool runtime::cpu::pass::CPUReducedPrecision::run_on_function(shared_ptr<Function> function)
+{
+    bool clobbered = false;
+
+    // Widening Converts, one per reduced precision producer
+    unordered_map<Node*, shared_ptr<Node>> widened;
+    // Narrowing Converts inserted by this pass, mapped to the f32 value they round
+    unordered_map<Node*, shared_ptr<Node>> narrowed;
+
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        if (is_storage_op(node) || has_widening_kernel(node) || node->get_output_size() != 1 ||
+            !node->get_functions().empty())
+        {
+            continue;
+        }
+
+        bool reduced = is_reduced_precision(node->get_element_type());
+        for (shared_ptr<Node> arg : node->get_arguments())
+        {
+            reduced |= is_reduced_precision(arg->get_element_type());
+        }
+        if (!reduced)
+        {
+            continue;
+        }
+
+        NodeVector new_args;
+        for (shared_ptr<Node> arg : node->get_arguments())
+        {
+            if (!is_reduced_precision(arg->get_element_type()))
+            {
+                new_args.push_back(arg);
+            }
+            else if (narrowed.count(arg.get()) != 0)
+            {
+                // Producer was lowered by this pass, use its f32 value directly
+                new_args.push_back(narrowed.at(arg.get()));
+            }
+            else
+            {
+                if (widened.count(arg.get()) == 0)
+                {
+                    widened[arg.get()] = make_shared<op::Convert>(arg, element::f32);
+                }
+                new_args.push_back(widened.at(arg.get()));
+            }
+        }
+
+        const element::Type& type = node->get_element_type();
+        auto wide_node = node->copy_with_new_args(new_args);
+        const element::Type& wide_type = is_reduced_precision(type) ? element::f32 : type;
+        if (wide_node->get_element_type() != wide_type)
+        {
+            throw ngraph_error("Unable to compute " + node->get_name() + " in f32");
+        }
+
+        if (is_reduced_precision(type))
+        {
+            auto narrow_node = make_shared<op::Convert>(wide_node, type);
+            narrowed[narrow_node.get()] = wide_node;
+            replace_node(node, narrow_node);
+        }
+        else
+        {
+            replace_node(node, wide_node);
+        }
+        clobbered = true;
+    }
+
+    return clobbered;
+}
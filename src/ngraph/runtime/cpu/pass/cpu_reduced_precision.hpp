@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Keeps f16 and bf16 tensors in storage only.
+                ///
+                /// Add, Multiply, Dot and the unary elementwise ops with widening kernels stay
+                /// in reduced precision; their kernels widen operands to f32 in registers, so
+                /// no f32 copy of a 16-bit tensor is written. Every other compute op that reads
+                /// or writes a reduced precision tensor is rebuilt on f32 arguments, with a
+                /// widening Convert on each reduced precision argument and a narrowing Convert
+                /// on its result. Chains of such ops pass f32 values directly to each other.
+                class CPUReducedPrecision : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,597 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <limits>
+#include <list>
+#include <unordered_map>
+
+#include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/hybrid_backend.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const size_t s_buffer_alignment = 64;
+static const double s_unsupported = numeric_limits<double>::infinity();
+
+runtime::HybridBackend::HybridBackend(const vector<Device>& devices,
+                                      const TransferCost& transfer_cost)
+    : m_devices(devices)
+    , m_transfer_cost(transfer_cost)
+{
+    if (m_devices.empty())
+    {
+        throw ngraph_error("HybridBackend needs at least one device");
+    }
+    for (size_t i = 0; i < m_devices.size(); i++)
+    {
+        Device& device = m_devices[i];
+        if (device.m_placement == Placement::DEFAULT)
+        {
+            throw ngraph_error("HybridBackend devices need a placement other than DEFAULT");
+        }
+        for (size_t j = 0; j < i; j++)
+        {
+            if (m_devices[j].m_placement == device.m_placement)
+            {
+                throw ngraph_error("HybridBackend device " +
+                                   placement_to_string(device.m_placement) + " is given twice");
+            }
+        }
+        if (device.m_backend == nullptr)
+        {
+            device.m_backend = Backend::create(placement_to_string(device.m_placement));
+        }
+    }
+}
+
+shared_ptr<runtime::TensorView>
+    runtime::HybridBackend::create_tensor(const element::Type& element_type, const Shape& shape)
+{
+    return m_devices[0].m_backend->create_tensor(element_type, shape);
+}
+
+shared_ptr<runtime::TensorView> runtime::HybridBackend::create_tensor(
+    const element::Type& element_type, const Shape& shape, void* memory_pointer)
+{
+    return m_devices[0].m_backend->create_tensor(element_type, shape, memory_pointer);
+}
+
+double runtime::HybridBackend::estimate_work(const Node& node)
+{
+    double work = 0;
+    if (auto dot = dynamic_cast<const op::Dot*>(&node))
+    {
+        // Every output element sums over the reduction axes at the end of the first argument
+        const Shape& arg0_shape = node.get_input_shape(0);
+        size_t reduction = 1;
+        for (size_t i = arg0_shape.size() - dot->get_reduction_axes_count();
+             i < arg0_shape.size();
+             i++)
+        {
+            reduction *= arg0_shape[i];
+        }
+        work = static_cast<double>(shape_size(node.get_shape())) * reduction;
+    }
+    else if (dynamic_cast<const op::Convolution*>(&node))
+    {
+        // Every output element reads one filter's worth of input
+        const Shape& filters_shape = node.get_input_shape(1);
+        work = static_cast<double>(shape_size(node.get_shape())) * shape_size(filters_shape) /
+               filters_shape.at(0);
+    }
+    else
+    {
+        for (size_t i = 0; i < node.get_output_size(); i++)
+        {
+            work += shape_size(node.get_output_shape(i));
+        }
+    }
+    return max(work, 1.0);
+}
+
+double runtime::HybridBackend::get_cost(const Node& node, size_t device) const
+{
+    // Parameters, Results and Constants only hold or pass on data, so they go anywhere
+    if (node.is_constant())
+    {
+        return 0;
+    }
+    if (node.is_parameter() || node.is_output())
+    {
+        // The caller's tensor lives on the primary device and is copied anywhere else
+        return device == 0 ? 0 : m_transfer_cost.m_per_byte * node.get_output_tensor(0).size();
+    }
+    const Device& d = m_devices[device];
+    if (d.m_supports && !d.m_supports(node))
+    {
+        return s_unsupported;
+    }
+    return d.m_cost ? d.m_cost(node) : d.m_cost_scale * estimate_work(node);
+}
+
+void runtime::HybridBackend::assign_placement(const shared_ptr<Function>& func) const
+{
+    list<shared_ptr<Node>> ordered_ops = func->get_ordered_ops();
+    vector<shared_ptr<Node>> nodes(ordered_ops.begin(), ordered_ops.end());
+    size_t node_count = nodes.size();
+    size_t device_count = m_devices.size();
+    unordered_map<const Node*, size_t> node_index;
+    for (size_t i = 0; i < node_count; i++)
+    {
+        node_index[nodes[i].get()] = i;
+    }
+
+    // Edges in both directions, weighted by the bytes that cross when they are cut
+    vector<vector<pair<size_t, size_t>>> edges(node_count);
+    for (size_t i = 0; i < node_count; i++)
+    {
+        for (const descriptor::Input& input : nodes[i]->get_inputs())
+        {
+            const descriptor::Output& output = input.get_output();
+            size_t src = node_index.at(output.get_node().get());
+            size_t bytes = output.get_tensor().size();
+            edges[src].emplace_back(i, bytes);
+            edges[i].emplace_back(src, bytes);
+        }
+    }
+
+    vector<vector<double>> cost(node_count, vector<double>(device_count));
+    vector<size_t> placement(node_count);
+    for (size_t i = 0; i < node_count; i++)
+    {
+        size_t best = 0;
+        for (size_t d = 0; d < device_count; d++)
+        {
+            cost[i][d] = get_cost(*nodes[i], d);
+            if (cost[i][d] < cost[i][best])
+            {
+                best = d;
+            }
+        }
+        if (cost[i][best] == s_unsupported)
+        {
+            throw ngraph_error("No HybridBackend device supports " + nodes[i]->get_name());
+        }
+        placement[i] = best;
+    }
+
+    auto edge_cost = [&](size_t a, size_t b, size_t bytes) {
+        return a == b ? 0.0
+                      : m_transfer_cost.m_per_byte * bytes + m_transfer_cost.m_per_crossing;
+    };
+
+    // Change in total cost if the nodes of group move to device d. Every edge leaving the group
+    // ends on a node that stays put.
+    vector<bool> in_group(node_count, false);
+    auto move_delta = [&](const vector<size_t>& group, size_t d) {
+        double delta = 0;
+        for (size_t i : group)
+        {
+            delta += cost[i][d] - cost[i][placement[i]];
+            for (const pair<size_t, size_t>& edge : edges[i])
+            {
+                if (!in_group[edge.first])
+                {
+                    size_t other = placement[edge.first];
+                    delta += edge_cost(d, other, edge.second) -
+                             edge_cost(placement[i], other, edge.second);
+                }
+            }
+        }
+        return delta;
+    };
+
+    // Each applied move lowers the total, so the search ends
+    const double epsilon = 1e-9;
+    bool improved = true;
+    while (improved)
+    {
+        improved = false;
+
+        // Move single nodes
+        for (size_t i = 0; i < node_count; i++)
+        {
+            vector<size_t> group{i};
+            in_group[i] = true;
+            for (size_t d = 0; d < device_count; d++)
+            {
+                if (d != placement[i] && cost[i][d] != s_unsupported &&
+                    move_delta(group, d) < -epsilon)
+                {
+                    placement[i] = d;
+                    improved = true;
+                }
+            }
+            in_group[i] = false;
+        }
+
+        // Move connected runs of nodes that share a device, which single moves cannot do when
+        // every node of the run is held in place by its neighbours
+        vector<bool> visited(node_count, false);
+        for (size_t start = 0; start < node_count && !improved; start++)
+        {
+            if (visited[start])
+            {
+                continue;
+            }
+            vector<size_t> group{start};
+            visited[start] = true;
+            for (size_t k = 0; k < group.size(); k++)
+            {
+                for (const pair<size_t, size_t>& edge : edges[group[k]])
+                {
+                    if (!visited[edge.first] && placement[edge.first] == placement[start])
+                    {
+                        visited[edge.first] = true;
+                        group.push_back(edge.first);
+                    }
+                }
+            }
+            if (group.size() == 1)
+            {
+                continue;
+            }
+            for (size_t i : group)
+            {
+                in_group[i] = true;
+            }
+            for (size_t d = 0; d < device_count && !improved; d++)
+            {
+                bool supported = d != placement[start];
+                for (size_t i : group)
+                {
+                    supported = supported && cost[i][d] != s_unsupported;
+                }
+                if (supported && move_delta(group, d) < -epsilon)
+                {
+                    for (size_t i : group)
+                    {
+                        placement[i] = d;
+                    }
+                    improved = true;
+                }
+            }
+            for (size_t i : group)
+            {
+                in_group[i] = false;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < node_count; i++)
+    {
+        nodes[i]->set_placement(m_devices[placement[i]].m_placement);
+    }
+}
+
+runtime::AlignedBuffer* runtime::HybridBackend::allocate_buffer(FunctionInstance& instance,
+                                                                size_t size)
+{
+    instance.m_buffers.emplace_back(new AlignedBuffer(size, s_buffer_alignment));
+    return instance.m_buffers.back().get();
+}
+
+bool runtime::HybridBackend::compile(shared_ptr<Function> func)
+{
+    FunctionInstance& instance = m_function_map[func];
+    if (instance.m_is_compiled)
+    {
+        return true;
+    }
+    // Placement or a device's compile can throw part way; start over from nothing each time
+    instance.m_partitions.clear();
+    instance.m_buffers.clear();
+
+    // Placement and splitting rewrite the graph, so they work on a copy
+    shared_ptr<Function> clone = clone_function(*func);
+    assign_placement(clone);
+    vector<shared_ptr<Function>> sub_functions;
+    unordered_map<shared_ptr<op::Parameter>, shared_ptr<op::Result>> parameter_to_result;
+    tie(sub_functions, parameter_to_result) = split_function_by_placement(clone);
+
+    unordered_map<const Node*, size_t> input_index;
+    for (size_t i = 0; i < clone->get_parameters().size(); i++)
+    {
+        input_index[clone->get_parameters()[i].get()] = i;
+    }
+    unordered_map<const Node*, size_t> output_index;
+    for (size_t i = 0; i < clone->get_results().size(); i++)
+    {
+        output_index[clone->get_results()[i].get()] = i;
+    }
+    map<Placement, size_t> device_index;
+    for (size_t d = 0; d < m_devices.size(); d++)
+    {
+        device_index[m_devices[d].m_placement] = d;
+    }
+
+    unordered_map<const Node*, size_t> node_partition;
+    for (const shared_ptr<Function>& sub_function : sub_functions)
+    {
+        Partition partition;
+        partition.m_device = device_index.at(get_colocated_function_placement(sub_function));
+        partition.m_function = sub_function;
+        for (const shared_ptr<op::Parameter>& parameter : sub_function->get_parameters())
+        {
+            node_partition[parameter.get()] = instance.m_partitions.size();
+        }
+        instance.m_partitions.push_back(partition);
+    }
+
+    // Boundary tensors. Host memory devices alias one buffer; others get a tensor each and a
+    // copy through a staging buffer before the consumer runs.
+    unordered_map<const Node*, shared_ptr<TensorView>> boundary_tensors;
+    for (const auto& p : parameter_to_result)
+    {
+        const shared_ptr<op::Parameter>& parameter = p.first;
+        const shared_ptr<op::Result>& result = p.second;
+        Partition& consumer = instance.m_partitions[node_partition.at(parameter.get())];
+        const element::Type& type = parameter->get_element_type();
+        const Shape& shape = parameter->get_shape();
+        size_t size = parameter->get_output_tensor(0).size();
+        const Device& to = m_devices[consumer.m_device];
+        const Device& from = m_devices[device_index.at(result->get_placement())];
+        shared_ptr<TensorView> result_tensor;
+        shared_ptr<TensorView> parameter_tensor;
+        if (&from == &to)
+        {
+            result_tensor = to.m_backend->create_tensor(type, shape);
+            parameter_tensor = result_tensor;
+        }
+        else if (from.m_host_memory && to.m_host_memory)
+        {
+            void* ptr = allocate_buffer(instance, size)->get_ptr();
+            result_tensor = from.m_backend->create_tensor(type, shape, ptr);
+            parameter_tensor = to.m_backend->create_tensor(type, shape, ptr);
+        }
+        else
+        {
+            void* staging = allocate_buffer(instance, size)->get_ptr();
+            result_tensor = from.m_backend->create_tensor(type, shape);
+            parameter_tensor = to.m_backend->create_tensor(type, shape);
+            consumer.m_before.push_back([=](const TensorViews&, const TensorViews&) {
+                result_tensor->read(staging, 0, size);
+                parameter_tensor->write(staging, 0, size);
+            });
+        }
+        boundary_tensors[result.get()] = result_tensor;
+        boundary_tensors[parameter.get()] = parameter_tensor;
+    }
+
+    // The caller's tensors are used directly on the primary device and copied anywhere else
+    for (Partition& partition : instance.m_partitions)
+    {
+        const Device& device = m_devices[partition.m_device];
+        for (const shared_ptr<op::Parameter>& parameter :
+             partition.m_function->get_parameters())
+        {
+            Binding binding;
+            auto it = input_index.find(parameter.get());
+            if (it == input_index.end())
+            {
+                binding.m_tensor = boundary_tensors.at(parameter.get());
+            }
+            else if (partition.m_device == 0)
+            {
+                binding.m_index = it->second;
+            }
+            else
+            {
+                size_t index = it->second;
+                size_t size = parameter->get_output_tensor(0).size();
+                void* ptr = allocate_buffer(instance, size)->get_ptr();
+                shared_ptr<TensorView> tensor;
+                if (device.m_host_memory)
+                {
+                    tensor = device.m_backend->create_tensor(
+                        parameter->get_element_type(), parameter->get_shape(), ptr);
+                }
+                else
+                {
+                    tensor = device.m_backend->create_tensor(parameter->get_element_type(),
+                                                             parameter->get_shape());
+                }
+                bool copy = !device.m_host_memory;
+                partition.m_before.push_back(
+                    [=](const TensorViews&, const TensorViews& inputs) {
+                        inputs[index]->read(ptr, 0, size);
+                        if (copy)
+                        {
+                            tensor->write(ptr, 0, size);
+                        }
+                    });
+                binding.m_tensor = tensor;
+            }
+            partition.m_parameters.push_back(binding);
+        }
+        for (const shared_ptr<op::Result>& result : partition.m_function->get_results())
+        {
+            Binding binding;
+            auto it = output_index.find(result.get());
+            if (it == output_index.end())
+            {
+                binding.m_tensor = boundary_tensors.at(result.get());
+            }
+            else if (partition.m_device == 0)
+            {
+                binding.m_index = it->second;
+            }
+            else
+            {
+                size_t index = it->second;
+                size_t size = result->get_output_tensor(0).size();
+                void* ptr = allocate_buffer(instance, size)->get_ptr();
+                shared_ptr<TensorView> tensor;
+                if (device.m_host_memory)
+                {
+                    tensor = device.m_backend->create_tensor(
+                        result->get_element_type(), result->get_shape(), ptr);
+                }
+                else
+                {
+                    tensor = device.m_backend->create_tensor(result->get_element_type(),
+                                                             result->get_shape());
+                }
+                bool copy = !device.m_host_memory;
+                partition.m_after.push_back([=](const TensorViews& outputs, const TensorViews&) {
+                    if (copy)
+                    {
+                        tensor->read(ptr, 0, size);
+                    }
+                    outputs[index]->write(ptr, 0, size);
+                });
+                binding.m_tensor = tensor;
+            }
+            partition.m_results.push_back(binding);
+        }
+
+        device.m_backend->enable_performance_data(partition.m_function,
+                                                  instance.m_performance_counters_enabled);
+        device.m_backend->compile(partition.m_function);
+    }
+    instance.m_is_compiled = true;
+    return true;
+}
+
+bool runtime::HybridBackend::call(shared_ptr<Function> func,
+                                  const vector<shared_ptr<TensorView>>& outputs,
+                                  const vector<shared_ptr<TensorView>>& inputs)
+{
+    validate_call(func, outputs, inputs);
+    compile(func);
+    FunctionInstance& instance = m_function_map.at(func);
+
+    bool rc = true;
+    TensorViews parameter_tensors;
+    TensorViews result_tensors;
+    for (const Partition& partition : instance.m_partitions)
+    {
+        for (const Transfer& transfer : partition.m_before)
+        {
+            transfer(outputs, inputs);
+        }
+        parameter_tensors.clear();
+        for (const Binding& binding : partition.m_parameters)
+        {
+            parameter_tensors.push_back(binding.m_tensor ? binding.m_tensor
+                                                         : inputs.at(binding.m_index));
+        }
+        result_tensors.clear();
+        for (const Binding& binding : partition.m_results)
+        {
+            result_tensors.push_back(binding.m_tensor ? binding.m_tensor
+                                                      : outputs.at(binding.m_index));
+        }
+        const shared_ptr<Backend>& backend = m_devices[partition.m_device].m_backend;
+        rc = backend->call(partition.m_function, result_tensors, parameter_tensors) && rc;
+        for (const Transfer& transfer : partition.m_after)
+        {
+            transfer(outputs, inputs);
+        }
+    }
+    return rc;
+}
+
+void runtime::HybridBackend::remove_compiled_function(shared_ptr<Function> func)
+{
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end())
+    {
+        for (const Partition& partition : it->second.m_partitions)
+        {
+            m_devices[partition.m_device].m_backend->remove_compiled_function(
+                partition.m_function);
+        }
+        m_function_map.erase(it);
+    }
+}
+
+void runtime::HybridBackend::enable_performance_data(shared_ptr<Function> func, bool enable)
+{
+    FunctionInstance& instance = m_function_map[func];
+    instance.m_performance_counters_enabled = enable;
+    for (const Partition& partition : instance.m_partitions)
+    {
+        m_devices[partition.m_device].m_backend->enable_performance_data(partition.m_function,
+                                                                         enable);
+    }
+}
+
+vector<runtime::PerformanceCounter>
+    runtime::HybridBackend::get_performance_data(shared_ptr<Function> func) const
+{
+    vector<PerformanceCounter> rc;
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end())
+    {
+        for (const Partition& partition : it->second.m_partitions)
+        {
+            vector<PerformanceCounter> counters =
+                m_devices[partition.m_device].m_backend->get_performance_data(
+                    partition.m_function);
+            rc.insert(rc.end(), counters.begin(), counters.end());
+        }
+    }
+    return rc;
+}
+
+runtime::MemoryUsage runtime::HybridBackend::get_memory_usage(shared_ptr<Function> func) const
+{
+    MemoryUsage usage;
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end())
+    {
+        for (const Partition& partition : it->second.m_partitions)
+        {
+            MemoryUsage part =
+                m_devices[partition.m_device].m_backend->get_memory_usage(partition.m_function);
+            usage.temporaries += part.temporaries;
+            usage.workspaces += part.workspaces;
+            usage.constants += part.constants;
+            usage.code += part.code;
+            usage.call_frames += part.call_frames;
+        }
+        for (const unique_ptr<AlignedBuffer>& buffer : it->second.m_buffers)
+        {
+            usage.temporaries += buffer->size();
+        }
+    }
+    return usage;
+}
+
+vector<pair<Placement, shared_ptr<Function>>>
+    runtime::HybridBackend::get_partitions(shared_ptr<Function> func) const
+{
+    vector<pair<Placement, shared_ptr<Function>>> rc;
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end())
+    {
+        for (const Partition& partition : it->second.m_partitions)
+        {
+            rc.emplace_back(m_devices[partition.m_device].m_placement, partition.m_function);
+        }
+    }
+    return rc;
+}
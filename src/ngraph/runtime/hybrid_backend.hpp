@@ -0,0 +1,168 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/placement.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class HybridBackend;
+    }
+}
+
+/// @brief Runs each part of a Function on the device best suited to it.
+///
+/// Every op is given to one of the devices that support it so that the estimated cost of the
+/// ops plus the cost of moving tensors between devices is as low as a local search finds.
+/// Single ops and whole runs of ops on one device are moved while that lowers the total, so a
+/// cheap op between two ops of another device follows its neighbours rather than costing two
+/// crossings. The Function is then split with split_function_by_placement and every part is
+/// compiled on its device.
+///
+/// The first device is the primary one: create_tensor allocates there, and the caller's
+/// tensors are read and written through it. The tensors at partition boundaries are allocated
+/// once at compile time. Between two devices whose tensors are host memory, the producing
+/// Result and the consuming Parameter share one buffer, so nothing is copied during a call.
+/// Calls of one Function must therefore not overlap.
+class ngraph::runtime::HybridBackend : public Backend
+{
+public:
+    class Device
+    {
+    public:
+        /// With no backend given, the backend named by the placement is created
+        Device(Placement placement, std::shared_ptr<Backend> backend = nullptr)
+            : m_placement(placement)
+            , m_backend(backend)
+        {
+        }
+
+        Placement m_placement;
+        std::shared_ptr<Backend> m_backend;
+        /// Ops the device can run; every op if empty. Parameters, Results and Constants go
+        /// on any device.
+        std::function<bool(const Node&)> m_supports;
+        /// Estimated cost of running an op on the device, in units shared by all devices.
+        /// If empty the cost is m_cost_scale times estimate_work(node).
+        std::function<double(const Node&)> m_cost;
+        double m_cost_scale = 1.0;
+        /// The backend's tensors are plain host memory, so they can alias a buffer shared with
+        /// another such backend
+        bool m_host_memory = true;
+    };
+
+    /// @brief What the placement charges for every edge that crosses between devices.
+    class TransferCost
+    {
+    public:
+        TransferCost(double per_byte = 1.0, double per_crossing = 10000.0)
+            : m_per_byte(per_byte)
+            , m_per_crossing(per_crossing)
+        {
+        }
+
+        /// For each byte of the tensor on the edge
+        double m_per_byte;
+        /// Once per edge, for the Result copy and the extra backend call it brings
+        double m_per_crossing;
+    };
+
+    HybridBackend(const std::vector<Device>& devices,
+                  const TransferCost& transfer_cost = TransferCost());
+
+    std::shared_ptr<TensorView> create_tensor(const element::Type& element_type,
+                                              const Shape& shape) override;
+
+    std::shared_ptr<TensorView> create_tensor(const element::Type& element_type,
+                                              const Shape& shape,
+                                              void* memory_pointer) override;
+
+    bool compile(std::shared_ptr<Function> func) override;
+
+    bool call(std::shared_ptr<Function> func,
+              const std::vector<std::shared_ptr<TensorView>>& outputs,
+              const std::vector<std::shared_ptr<TensorView>>& inputs) override;
+
+    void remove_compiled_function(std::shared_ptr<Function> func) override;
+
+    void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
+    std::vector<PerformanceCounter>
+        get_performance_data(std::shared_ptr<Function> func) const override;
+
+    /// The boundary buffers count as temporaries on top of what the devices report
+    MemoryUsage get_memory_usage(std::shared_ptr<Function> func) const override;
+
+    /// @brief The parts func was split into, in the order they run.
+    std::vector<std::pair<Placement, std::shared_ptr<Function>>>
+        get_partitions(std::shared_ptr<Function> func) const;
+
+    /// @brief Rough number of arithmetic operations in node: multiply-adds for Dot and
+    ///   Convolution, output elements for everything else.
+    static double estimate_work(const Node& node);
+
+private:
+    using TensorViews = std::vector<std::shared_ptr<TensorView>>;
+    using Transfer = std::function<void(const TensorViews& outputs, const TensorViews& inputs)>;
+
+    // A tensor of a partition is either held here or is the caller's tensor at m_index
+    class Binding
+    {
+    public:
+        std::shared_ptr<TensorView> m_tensor;
+        size_t m_index = 0;
+    };
+
+    class Partition
+    {
+    public:
+        size_t m_device;
+        std::shared_ptr<Function> m_function;
+        std::vector<Binding> m_parameters;
+        std::vector<Binding> m_results;
+        // Copies into the partition's tensors before it runs and out of them after
+        std::vector<Transfer> m_before;
+        std::vector<Transfer> m_after;
+    };
+
+    class FunctionInstance
+    {
+    public:
+        std::vector<Partition> m_partitions;
+        std::vector<std::unique_ptr<AlignedBuffer>> m_buffers;
+        bool m_is_compiled = false;
+        bool m_performance_counters_enabled = false;
+    };
+
+    void assign_placement(const std::shared_ptr<Function>& func) const;
+    double get_cost(const Node& node, size_t device) const;
+    AlignedBuffer* allocate_buffer(FunctionInstance& instance, size_t size);
+
+    std::vector<Device> m_devices;
+    TransferCost m_transfer_cost;
+    std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+};
@@ -16,12 +16,16 @@
 
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_view_layout.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
 #include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -35,6 +39,12 @@ extern "C" void create_backend()
                                        make_shared<runtime::interpreter::INTBackend>());
 };
 
+runtime::interpreter::INTBackend::~INTBackend()
+{
+    // Pending asynchronous calls reference m_function_map
+    wait_for_async_calls();
+}
+
 shared_ptr<runtime::TensorView>
     runtime::interpreter::INTBackend::create_tensor(const element::Type& type, const Shape& shape)
 {
@@ -49,6 +59,7 @@ shared_ptr<runtime::TensorView> runtime::interpreter::INTBackend::create_tensor(
 
 bool runtime::interpreter::INTBackend::compile(shared_ptr<Function> function)
 {
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[function];
     if (!instance.m_is_compiled)
     {
@@ -57,6 +68,32 @@ bool runtime::interpreter::INTBackend::compile(shared_ptr<Function> function)
         pass_manager.register_pass<pass::AssignLayout<DenseTensorViewLayout>>();
         pass_manager.register_pass<pass::Liveness>();
         pass_manager.run_passes(function);
+
+        // Replay the liveness lists to find the peak of the intermediate results. Constants
+        // are copied into a tensor that lives until the call returns.
+        MemoryUsage& usage = instance.m_memory_usage;
+        size_t live = 0;
+        size_t peak = 0;
+        for (const shared_ptr<Node>& node : function->get_ordered_ops())
+        {
+            if (auto constant = dynamic_pointer_cast<op::Constant>(node))
+            {
+                constant->share_data();
+                size_t size = constant->get_output_tensor(0).size();
+                usage.constants += size;
+                live += size;
+            }
+            for (descriptor::Tensor* tensor : node->liveness_new_list)
+            {
+                live += tensor->size();
+            }
+            peak = max(peak, live);
+            for (descriptor::Tensor* tensor : node->liveness_free_list)
+            {
+                live -= tensor->size();
+            }
+        }
+        usage.temporaries = peak;
     }
 
     return true;
@@ -68,6 +105,7 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
 {
     validate_call(function, outputs, inputs);
 
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
     compile(function);
     FunctionInstance& instance = m_function_map[function];
 
@@ -90,14 +128,14 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
     }
 
     // map function params -> HostTensorView
-    unordered_map<descriptor::TensorView*, shared_ptr<runtime::HostTensorView>> tensor_map;
+    unordered_map<descriptor::Tensor*, shared_ptr<runtime::HostTensorView>> tensor_map;
     size_t input_count = 0;
     for (auto param : function->get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::TensorView* tv = param->get_output_tensor_view(i).get();
-            tensor_map.insert({tv, func_inputs[input_count++]});
+            descriptor::Tensor* tensor = &param->get_output_tensor(i);
+            tensor_map.insert({tensor, func_inputs[input_count++]});
         }
     }
 
@@ -109,8 +147,8 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::TensorView* tv = output->get_output_tensor_view(0).get();
-        tensor_map.insert({tv, func_outputs[output_count]});
+        descriptor::Tensor* tensor = &output->get_output_tensor(0);
+        tensor_map.insert({tensor, func_outputs[output_count]});
     }
 
     // for each ordered op in the graph
@@ -125,28 +163,28 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         vector<shared_ptr<runtime::HostTensorView>> op_inputs;
         for (const descriptor::Input& input : op->get_inputs())
         {
-            descriptor::TensorView* tv = input.get_output().get_tensor_view().get();
-            op_inputs.push_back(tensor_map.at(tv));
+            descriptor::Tensor* tensor = &input.get_output().get_tensor();
+            op_inputs.push_back(tensor_map.at(tensor));
         }
 
         // get op outputs from map or create
         vector<shared_ptr<runtime::HostTensorView>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
-            descriptor::TensorView* tv = op->get_output_tensor_view(i).get();
+            descriptor::Tensor* tensor = &op->get_output_tensor(i);
             shared_ptr<runtime::HostTensorView> htv;
-            if (!contains_key(tensor_map, tv))
+            if (!contains_key(tensor_map, tensor))
             {
                 // the output tensor is not in the tensor map so create a new tensor
                 const Shape& shape = op->get_output_shape(i);
                 const element::Type& type = op->get_output_element_type(i);
                 string name = op->get_output_tensor(i).get_name();
                 htv = make_shared<runtime::HostTensorView>(type, shape, name);
-                tensor_map.insert({tv, htv});
+                tensor_map.insert({tensor, htv});
             }
             else
             {
-                htv = tensor_map.at(tv);
+                htv = tensor_map.at(tensor);
             }
             op_outputs.push_back(htv);
         }
@@ -174,7 +212,14 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         {
             instance.m_timer_map[op.get()].start();
         }
-        generate_calls(type, *op, op_outputs, op_inputs);
+        if (is_reduced_precision(op_inputs) || is_reduced_precision(op_outputs))
+        {
+            generate_widened_calls(type, *op, op_outputs, op_inputs);
+        }
+        else
+        {
+            generate_calls(type, *op, op_outputs, op_inputs);
+        }
         if (instance.m_performance_counters_enabled)
         {
             instance.m_timer_map[op.get()].stop();
@@ -185,16 +230,9 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         }
 
         // delete any obsolete tensors
-        for (const descriptor::Tensor* t : op->liveness_free_list)
+        for (descriptor::Tensor* tensor : op->liveness_free_list)
         {
-            for (auto it = tensor_map.begin(); it != tensor_map.end(); ++it)
-            {
-                if (it->second->get_tensor().get_name() == t->get_name())
-                {
-                    tensor_map.erase(it);
-                    break;
-                }
-            }
+            tensor_map.erase(tensor);
         }
     }
 
@@ -259,8 +297,122 @@ void runtime::interpreter::INTBackend::generate_calls(
     }
 }
 
+bool runtime::interpreter::INTBackend::is_reduced_precision(
+    const vector<shared_ptr<HostTensorView>>& tvs)
+{
+    for (const shared_ptr<HostTensorView>& tv : tvs)
+    {
+        const element::Type& type = tv->get_tensor().get_element_type();
+        if (type == element::f16 || type == element::bf16)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// f16 and bf16 are storage formats on INTERPRETER. Each op widens its reduced precision
+// arguments into f32 temporaries, runs the f32 reference kernel so that all accumulation is done
+// in f32, and rounds its reduced precision results back to storage.
+void runtime::interpreter::INTBackend::generate_widened_calls(
+    const element::Type& type,
+    Node& op,
+    const vector<shared_ptr<HostTensorView>>& outputs,
+    const vector<shared_ptr<HostTensorView>>& inputs)
+{
+    string node_op = op.description();
+    if (node_op == "Constant" || node_op == "Result")
+    {
+        // Pure data movement, the bits are copied as they are
+        const void* source = (node_op == "Constant")
+                                 ? static_cast<const op::Constant&>(op).get_data_ptr()
+                                 : inputs[0]->get_data_ptr();
+        size_t num_bytes = outputs[0]->get_element_count() * outputs[0]->get_element_type().size();
+        memcpy(outputs[0]->get_data_ptr(), source, num_bytes);
+        return;
+    }
+    if (node_op == "FunctionCall")
+    {
+        // The called function sees the original tensors and widens per op itself
+        generate_calls(element::f32, op, outputs, inputs);
+        return;
+    }
+    if (node_op == "Reduce" || node_op == "ReduceWindow" || node_op == "SelectAndScatter")
+    {
+        throw ngraph_error("op " + op.get_name() + " does not support f16 or bf16 on INTERPRETER");
+    }
+
+    vector<shared_ptr<HostTensorView>> wide_inputs;
+    for (const shared_ptr<HostTensorView>& tv : inputs)
+    {
+        const element::Type& et = tv->get_tensor().get_element_type();
+        if (et == element::f16 || et == element::bf16)
+        {
+            auto wide = make_shared<HostTensorView>(element::f32, tv->get_shape());
+            if (et == element::f16)
+            {
+                reference::convert<float16>(tv->get_data_ptr<float16>(),
+                                            wide->get_data_ptr<float>(),
+                                            tv->get_element_count());
+            }
+            else
+            {
+                reference::convert<bfloat16>(tv->get_data_ptr<bfloat16>(),
+                                             wide->get_data_ptr<float>(),
+                                             tv->get_element_count());
+            }
+            wide_inputs.push_back(wide);
+        }
+        else
+        {
+            wide_inputs.push_back(tv);
+        }
+    }
+
+    vector<shared_ptr<HostTensorView>> wide_outputs;
+    for (const shared_ptr<HostTensorView>& tv : outputs)
+    {
+        const element::Type& et = tv->get_tensor().get_element_type();
+        if (et == element::f16 || et == element::bf16)
+        {
+            wide_outputs.push_back(make_shared<HostTensorView>(element::f32, tv->get_shape()));
+        }
+        else
+        {
+            wide_outputs.push_back(tv);
+        }
+    }
+
+    bool is_reduced_type = (type == element::f16 || type == element::bf16);
+    generate_calls(is_reduced_type ? element::f32 : type, op, wide_outputs, wide_inputs);
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        const element::Type& et = outputs[i]->get_tensor().get_element_type();
+        if (et == element::f16)
+        {
+            reference::convert<float>(wide_outputs[i]->get_data_ptr<float>(),
+                                      outputs[i]->get_data_ptr<float16>(),
+                                      outputs[i]->get_element_count());
+        }
+        else if (et == element::bf16)
+        {
+            reference::convert<float>(wide_outputs[i]->get_data_ptr<float>(),
+                                      outputs[i]->get_data_ptr<bfloat16>(),
+                                      outputs[i]->get_element_count());
+        }
+    }
+}
+
+void runtime::interpreter::INTBackend::remove_compiled_function(shared_ptr<Function> func)
+{
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
+    m_function_map.erase(func);
+}
+
 void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func, bool enable)
 {
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     instance.m_nan_check_enabled = enable;
 }
@@ -268,6 +420,7 @@ void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func,
 void runtime::interpreter::INTBackend::enable_performance_data(shared_ptr<Function> func,
                                                                bool enable)
 {
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     instance.m_performance_counters_enabled = enable;
 }
@@ -276,6 +429,7 @@ vector<runtime::PerformanceCounter>
     runtime::interpreter::INTBackend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
     const FunctionInstance& instance = m_function_map.at(func);
     for (const pair<const Node*, stopwatch> p : instance.m_timer_map)
     {
@@ -286,6 +440,14 @@ vector<runtime::PerformanceCounter>
     return rc;
 }
 
+runtime::MemoryUsage
+    runtime::interpreter::INTBackend::get_memory_usage(shared_ptr<Function> func) const
+{
+    lock_guard<recursive_mutex> lock(m_function_map_mutex);
+    auto it = m_function_map.find(func);
+    return it == m_function_map.end() ? MemoryUsage() : it->second.m_memory_usage;
+}
+
 void runtime::interpreter::INTBackend::perform_nan_check(
     const vector<shared_ptr<HostTensorView>>& tvs, const Node* op)
 {
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/max.hpp"
@@ -39,6 +41,9 @@
 #include "ngraph/op/one_hot.hpp"
 #include "ngraph/op/pad.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/quantized_dot.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/replace_slice.hpp"
@@ -92,6 +97,9 @@
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/quantized_convolution.hpp"
+#include "ngraph/runtime/reference/quantized_dot.hpp"
 #include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -131,6 +139,8 @@ namespace ngraph
 class ngraph::runtime::interpreter::INTBackend : public Backend
 {
 public:
+    ~INTBackend() override;
+
     std::shared_ptr<TensorView>
         create_tensor(const element::Type& type, const Shape& shape, void* memory_pointer) override;
 
@@ -143,21 +153,32 @@ public:
               const std::vector<std::shared_ptr<TensorView>>& outputs,
               const std::vector<std::shared_ptr<TensorView>>& intputs) override;
 
+    void remove_compiled_function(std::shared_ptr<Function> func) override;
+
     void set_nan_check(std::shared_ptr<Function> func, bool);
 
     void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
     std::vector<PerformanceCounter>
         get_performance_data(std::shared_ptr<Function> func) const override;
+    /// Temporaries are the most a call holds at once: its intermediate results plus the copy
+    /// it makes of every Constant. Nothing is kept between calls apart from the constants.
+    MemoryUsage get_memory_usage(std::shared_ptr<Function> func) const override;
 
 private:
     class FunctionInstance
     {
     public:
         bool m_is_compiled = false;
+        MemoryUsage m_memory_usage;
         bool m_nan_check_enabled = false;
         bool m_performance_counters_enabled = false;
         std::unordered_map<const Node*, stopwatch> m_timer_map;
     };
+    // Held for the whole of each method that uses m_function_map, call() included, so
+    // synchronous calls from any thread and the asynchronous worker are serialized. Recursive
+    // because call() compiles, and runs nested Functions for FunctionCall, Reduce and
+    // SelectAndScatter.
+    mutable std::recursive_mutex m_function_map_mutex;
     std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensorView>>&,
@@ -168,6 +189,12 @@ private:
                         const std::vector<std::shared_ptr<HostTensorView>>& outputs,
                         const std::vector<std::shared_ptr<HostTensorView>>& inputs);
 
+    static bool is_reduced_precision(const std::vector<std::shared_ptr<HostTensorView>>&);
+    void generate_widened_calls(const element::Type& type,
+                                Node& op,
+                                const std::vector<std::shared_ptr<HostTensorView>>& outputs,
+                                const std::vector<std::shared_ptr<HostTensorView>>& inputs);
+
     template <typename T>
     void op_engine(Node& node,
                    const std::vector<std::shared_ptr<HostTensorView>>& out,
@@ -328,8 +355,9 @@ private:
                                       out[0]->get_data_ptr<char>(),
                                       out[0]->get_element_count());
             }
-            else if (type == element::f32)
+            else if (type == element::f32 || type == element::f16 || type == element::bf16)
             {
+                // Reduced precision results are produced in a widened f32 temporary
                 reference::convert<T>(args[0]->get_data_ptr<T>(),
                                       out[0]->get_data_ptr<float>(),
                                       out[0]->get_element_count());
@@ -472,6 +500,41 @@ private:
             reference::cosh<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
         }
+        else if (node_op == "Dequantize")
+        {
+            const op::Dequantize* dq = static_cast<const op::Dequantize*>(&node);
+            element::Type input_et = args[0]->get_element_type();
+            if (input_et == element::i8)
+            {
+                reference::dequantize<int8_t, T>(args[0]->get_data_ptr<int8_t>(),
+                                                 out[0]->get_data_ptr<T>(),
+                                                 out[0]->get_element_count(),
+                                                 dq->get_scale(),
+                                                 dq->get_zero_point());
+            }
+            else if (input_et == element::u8)
+            {
+                reference::dequantize<uint8_t, T>(args[0]->get_data_ptr<uint8_t>(),
+                                                  out[0]->get_data_ptr<T>(),
+                                                  out[0]->get_element_count(),
+                                                  dq->get_scale(),
+                                                  dq->get_zero_point());
+            }
+            else if (input_et == element::i32)
+            {
+                reference::dequantize<int32_t, T>(args[0]->get_data_ptr<int32_t>(),
+                                                  out[0]->get_data_ptr<T>(),
+                                                  out[0]->get_element_count(),
+                                                  dq->get_scale(),
+                                                  dq->get_zero_point());
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "unsupported element type " << input_et << " op Dequantize";
+                throw std::runtime_error(ss.str());
+            }
+        }
         else if (node_op == "Divide")
         {
             reference::divide<T>(args[0]->get_data_ptr<T>(),
@@ -691,6 +754,108 @@ private:
                                   out[0]->get_shape(),
                                   product->get_reduction_axes());
         }
+        else if (node_op == "Quantize")
+        {
+            const op::Quantize* q = static_cast<const op::Quantize*>(&node);
+            element::Type input_et = args[0]->get_element_type();
+            if (input_et == element::f32)
+            {
+                reference::quantize<float, T>(args[0]->get_data_ptr<float>(),
+                                              out[0]->get_data_ptr<T>(),
+                                              out[0]->get_element_count(),
+                                              q->get_scale(),
+                                              q->get_zero_point());
+            }
+            else if (input_et == element::f64)
+            {
+                reference::quantize<double, T>(args[0]->get_data_ptr<double>(),
+                                               out[0]->get_data_ptr<T>(),
+                                               out[0]->get_element_count(),
+                                               q->get_scale(),
+                                               q->get_zero_point());
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "unsupported element type " << input_et << " op Quantize";
+                throw std::runtime_error(ss.str());
+            }
+        }
+        else if (node_op == "QuantizedConvolution")
+        {
+            const op::QuantizedConvolution* c =
+                static_cast<const op::QuantizedConvolution*>(&node);
+            if (args[0]->get_element_type() == element::u8)
+            {
+                reference::quantized_convolution<uint8_t, int8_t, T>(
+                    args[0]->get_data_ptr<uint8_t>(),
+                    args[1]->get_data_ptr<int8_t>(),
+                    out[0]->get_data_ptr<T>(),
+                    args[0]->get_shape(),
+                    args[1]->get_shape(),
+                    out[0]->get_shape(),
+                    c->get_window_movement_strides(),
+                    c->get_window_dilation_strides(),
+                    c->get_padding_below(),
+                    c->get_padding_above(),
+                    c->get_data_dilation_strides(),
+                    c->get_input_scale(),
+                    c->get_input_zero_point(),
+                    c->get_filters_scale(),
+                    c->get_output_scale(),
+                    c->get_output_zero_point());
+            }
+            else
+            {
+                reference::quantized_convolution<int8_t, int8_t, T>(
+                    args[0]->get_data_ptr<int8_t>(),
+                    args[1]->get_data_ptr<int8_t>(),
+                    out[0]->get_data_ptr<T>(),
+                    args[0]->get_shape(),
+                    args[1]->get_shape(),
+                    out[0]->get_shape(),
+                    c->get_window_movement_strides(),
+                    c->get_window_dilation_strides(),
+                    c->get_padding_below(),
+                    c->get_padding_above(),
+                    c->get_data_dilation_strides(),
+                    c->get_input_scale(),
+                    c->get_input_zero_point(),
+                    c->get_filters_scale(),
+                    c->get_output_scale(),
+                    c->get_output_zero_point());
+            }
+        }
+        else if (node_op == "QuantizedDot")
+        {
+            const op::QuantizedDot* dot = static_cast<const op::QuantizedDot*>(&node);
+            if (args[0]->get_element_type() == element::u8)
+            {
+                reference::quantized_dot<uint8_t, int8_t, T>(args[0]->get_data_ptr<uint8_t>(),
+                                                             args[1]->get_data_ptr<int8_t>(),
+                                                             out[0]->get_data_ptr<T>(),
+                                                             args[0]->get_shape(),
+                                                             args[1]->get_shape(),
+                                                             dot->get_input_scale(),
+                                                             dot->get_input_zero_point(),
+                                                             dot->get_weights_scale(),
+                                                             dot->get_output_scale(),
+                                                             dot->get_output_zero_point());
+            }
+            else
+            {
+                reference::quantized_dot<int8_t, int8_t, T>(args[0]->get_data_ptr<int8_t>(),
+                                                            args[1]->get_data_ptr<int8_t>(),
+                                                            out[0]->get_data_ptr<T>(),
+                                                            args[0]->get_shape(),
+                                                            args[1]->get_shape(),
+                                                            dot->get_input_scale(),
+                                                            dot->get_input_zero_point(),
+                                                            dot->get_weights_scale(),
+                                                            dot->get_output_scale(),
+                                                            dot->get_output_zero_point());
+            }
+        }
         else if (node_op == "Reduce")
         {
             op::Reduce* reduce = dynamic_cast<op::Reduce*>(&node);
@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// @brief Bytes of host memory a compiled Function holds on a backend, by purpose.
+        ///
+        /// Tensors created by the caller are not included.
+        struct MemoryUsage
+        {
+            /// Memory for intermediate results, whether pooled or allocated for each call
+            size_t temporaries = 0;
+            /// Scratch memory kept by library primitives, such as mkldnn workspaces
+            size_t workspaces = 0;
+            /// Constant data read by the Function. Buffers shared with other Functions through
+            /// ConstantStore are counted in full by each of them.
+            size_t constants = 0;
+            /// Machine code generated for the Function
+            size_t code = 0;
+            /// Bookkeeping of the call frames that execute the Function
+            size_t call_frames = 0;
+
+            size_t total() const
+            {
+                return temporaries + workspaces + constants + code + call_frames;
+            }
+        };
+    }
+}
@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename T>
+            T quantize_value(double value, double scale, int64_t zero_point)
+            {
+                double q = std::nearbyint(value / scale) + zero_point;
+                q = std::max(q, static_cast<double>(std::numeric_limits<T>::lowest()));
+                q = std::min(q, static_cast<double>(std::numeric_limits<T>::max()));
+                return static_cast<T>(q);
+            }
+
+            // Output stage shared by the quantized compute kernels: rescale the i32 accumulator
+            // to a real value, and requantize it when the output is integral.
+            template <typename T>
+            T requantize(int32_t acc, double scale, double output_scale, int64_t output_zero_point)
+            {
+                double value = static_cast<double>(acc) * scale;
+                return std::is_floating_point<T>::value
+                           ? static_cast<T>(value)
+                           : quantize_value<T>(value, output_scale, output_zero_point);
+            }
+
+            template <typename TI, typename TO>
+            void quantize(const TI* arg, TO* out, size_t count, double scale, int64_t zero_point)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    out[i] = quantize_value<TO>(arg[i], scale, zero_point);
+                }
+            }
+
+            template <typename TI, typename TO>
+            void dequantize(const TI* arg, TO* out, size_t count, double scale, int64_t zero_point)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    out[i] = static_cast<TO>((static_cast<int64_t>(arg[i]) - zero_point) * scale);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename TI, typename TW, typename TO>
+            void quantized_convolution(const TI* data_batch,
+                                       const TW* filters,
+                                       TO* out,
+                                       const Shape& data_batch_shape,
+                                       const Shape& filters_shape,
+                                       const Shape& out_shape,
+                                       const Strides& window_movement_strides,
+                                       const Strides& window_dilation_strides,
+                                       const CoordinateDiff& padding_below,
+                                       const CoordinateDiff& padding_above,
+                                       const Strides& data_dilation_strides,
+                                       double input_scale,
+                                       int64_t input_zero_point,
+                                       double filters_scale,
+                                       double output_scale,
+                                       int64_t output_zero_point)
+            {
+                // Removing the zero point up front makes padding and dilation holes, which the
+                // convolution reads as 0, stand for real zero.
+                std::vector<int32_t> data(shape_size(data_batch_shape));
+                for (size_t i = 0; i < data.size(); i++)
+                {
+                    data[i] = static_cast<int32_t>(data_batch[i]) -
+                              static_cast<int32_t>(input_zero_point);
+                }
+                std::vector<int32_t> weights(filters, filters + shape_size(filters_shape));
+                std::vector<int32_t> acc(shape_size(out_shape));
+
+                convolution<int32_t>(data.data(),
+                                     weights.data(),
+                                     acc.data(),
+                                     data_batch_shape,
+                                     filters_shape,
+                                     out_shape,
+                                     window_movement_strides,
+                                     window_dilation_strides,
+                                     padding_below,
+                                     padding_above,
+                                     data_dilation_strides,
+                                     0,
+                                     1,
+                                     1,
+                                     0,
+                                     0,
+                                     1,
+                                     false);
+
+                double scale = input_scale * filters_scale;
+                for (size_t i = 0; i < acc.size(); i++)
+                {
+                    out[i] = requantize<TO>(acc[i], scale, output_scale, output_zero_point);
+                }
+            }
+        }
+    }
+}
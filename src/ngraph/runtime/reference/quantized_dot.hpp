@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename TI, typename TW, typename TO>
+            void quantized_dot(const TI* input,
+                               const TW* weights,
+                               TO* out,
+                               const Shape& input_shape,
+                               const Shape& weights_shape,
+                               double input_scale,
+                               int64_t input_zero_point,
+                               double weights_scale,
+                               double output_scale,
+                               int64_t output_zero_point)
+            {
+                // One contracted axis, so both arguments are plain row major matrices
+                size_t k = weights_shape.front();
+                size_t m = shape_size(Shape(input_shape.begin(), input_shape.end() - 1));
+                size_t n = shape_size(Shape(weights_shape.begin() + 1, weights_shape.end()));
+                double scale = input_scale * weights_scale;
+
+                for (size_t i = 0; i < m; i++)
+                {
+                    for (size_t j = 0; j < n; j++)
+                    {
+                        int32_t acc = 0;
+                        for (size_t p = 0; p < k; p++)
+                        {
+                            acc += (static_cast<int32_t>(input[i * k + p]) -
+                                    static_cast<int32_t>(input_zero_point)) *
+                                   static_cast<int32_t>(weights[p * n + j]);
+                        }
+                        out[i * n + j] =
+                            requantize<TO>(acc, scale, output_scale, output_zero_point);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -27,14 +27,16 @@ namespace ngraph
     {
         namespace reference
         {
-            template <typename T>
+            // ReductionFunction is any callable T(T, T). Passing a lambda rather than a
+            // std::function lets the compiler inline it into the loop.
+            template <typename T, typename ReductionFunction>
             void reduce(const T* arg0,
                         const T* arg1, // TODO: really we should just pass a T here.
                         T* out,
                         const Shape& in_shape,
                         const Shape& out_shape,
                         const AxisSet& reduction_axes,
-                        std::function<T(T, T)> reduction_function)
+                        ReductionFunction reduction_function)
             {
                 CoordinateTransform output_transform(out_shape);
 
@@ -27,13 +27,13 @@ namespace ngraph
     {
         namespace reference
         {
-            template <typename T>
+            template <typename T, typename ReductionFunction>
             void reduce_window(const T* arg_reductee,
                                const T* arg_init,
                                T* out,
                                const Shape& arg_reductee_shape,
                                const Shape& out_shape,
-                               std::function<T(T, T)> reduction_function,
+                               ReductionFunction reduction_function,
                                const Shape& window_shape,
                                const Strides& window_movement_strides)
             {
@@ -27,7 +27,7 @@ namespace ngraph
     {
         namespace reference
         {
-            template <typename T>
+            template <typename T, typename SelectionFunction, typename ScatterFunction>
             void select_and_scatter(const T* arg_selectee,
                                     const T* arg_source,
                                     const T* arg_init,
@@ -35,8 +35,8 @@ namespace ngraph
                                     const Shape& arg_selectee_shape,
                                     const Shape& arg_source_shape,
                                     const Shape& out_shape,
-                                    std::function<char(T, T)> selection_function,
-                                    std::function<T(T, T)> scatter_function,
+                                    SelectionFunction selection_function,
+                                    ScatterFunction scatter_function,
                                     const Shape& window_shape,
                                     const Strides& window_movement_strides)
             {
@@ -0,0 +1,297 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <sstream>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/request_batcher.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static Shape remove_batch_axis(const Shape& shape)
+{
+    if (shape.empty())
+    {
+        throw ngraph_error(
+            "RequestBatcher requires every Parameter and Result to have a batch axis");
+    }
+    return Shape(shape.begin() + 1, shape.end());
+}
+
+static void check_tensors(const runtime::TensorViewPtrs& tensors,
+                          const vector<element::Type>& types,
+                          const vector<Shape>& shapes,
+                          const string& kind)
+{
+    if (tensors.size() != types.size())
+    {
+        stringstream ss;
+        ss << "Request " << kind << " count " << tensors.size()
+           << " does not match batched Function's count " << types.size();
+        throw ngraph_error(ss.str());
+    }
+    for (size_t i = 0; i < tensors.size(); i++)
+    {
+        if (tensors[i]->get_tensor().get_element_type() != types[i] ||
+            tensors[i]->get_shape() != shapes[i])
+        {
+            stringstream ss;
+            ss << "Request " << kind << " " << i << " {" << join(tensors[i]->get_shape())
+               << "} does not match per-sample shape {" << join(shapes[i]) << "}";
+            throw ngraph_error(ss.str());
+        }
+    }
+}
+
+double runtime::RequestBatcher::Statistics::get_average_batch_size() const
+{
+    return m_batch_count == 0 ? 0.0 : static_cast<double>(m_request_count) / m_batch_count;
+}
+
+runtime::RequestBatcher::RequestBatcher(const shared_ptr<Backend>& backend,
+                                        const FunctionBuilder& builder,
+                                        const Config& config)
+    : m_backend(backend)
+    , m_builder(builder)
+    , m_config(config)
+    , m_stop(false)
+{
+    if (m_config.m_max_batch_size == 0)
+    {
+        throw ngraph_error("RequestBatcher max_batch_size must be at least 1");
+    }
+    m_statistics.m_batch_size_histogram.resize(m_config.m_max_batch_size + 1, 0);
+
+    // Building the largest batch up front both validates the builder and records the
+    // per-sample signature that every request is checked against
+    BatchInstance& instance = get_batch_instance(m_config.m_max_batch_size);
+    for (auto& tv : instance.m_inputs)
+    {
+        m_input_types.push_back(tv->get_tensor().get_element_type());
+        m_input_shapes.push_back(remove_batch_axis(tv->get_shape()));
+    }
+    for (auto& tv : instance.m_outputs)
+    {
+        m_output_types.push_back(tv->get_tensor().get_element_type());
+        m_output_shapes.push_back(remove_batch_axis(tv->get_shape()));
+    }
+
+    m_thread = thread(&RequestBatcher::worker, this);
+}
+
+runtime::RequestBatcher::~RequestBatcher()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_request_available.notify_all();
+    m_thread.join();
+}
+
+future<void> runtime::RequestBatcher::submit(const TensorViewPtrs& outputs,
+                                             const TensorViewPtrs& inputs)
+{
+    check_tensors(inputs, m_input_types, m_input_shapes, "input");
+    check_tensors(outputs, m_output_types, m_output_shapes, "output");
+
+    Request request;
+    request.m_outputs = outputs;
+    request.m_inputs = inputs;
+    request.m_arrival = chrono::steady_clock::now();
+    future<void> result = request.m_promise.get_future();
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_stop)
+        {
+            throw ngraph_error("RequestBatcher is shutting down");
+        }
+        m_queue.push_back(move(request));
+    }
+    m_request_available.notify_one();
+    return result;
+}
+
+runtime::RequestBatcher::Statistics runtime::RequestBatcher::get_statistics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+runtime::RequestBatcher::BatchInstance& runtime::RequestBatcher::get_batch_instance(size_t size)
+{
+    auto it = m_batch_instances.find(size);
+    if (it != m_batch_instances.end())
+    {
+        return it->second;
+    }
+
+    BatchInstance instance;
+    instance.m_function = m_builder(size);
+
+    // The first instance built is the largest one, which records the per-sample signature.
+    // Every smaller one must match it, or gather and scatter would run past the tensors.
+    bool check_signature = !m_batch_instances.empty();
+    const auto& params = instance.m_function->get_parameters();
+    if (check_signature && (params.size() != m_input_types.size() ||
+                            instance.m_function->get_output_size() != m_output_types.size()))
+    {
+        throw ngraph_error("Batched Function for batch size " + to_string(size) +
+                           " has a different number of Parameters or outputs than for batch "
+                           "size " +
+                           to_string(m_config.m_max_batch_size));
+    }
+
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        auto& param = params[i];
+        const Shape& shape = param->get_shape();
+        if (shape.empty() || shape[0] != size)
+        {
+            throw ngraph_error("Batched Function Parameter '" + param->get_name() +
+                               "' does not have batch size " + to_string(size) + " on axis 0");
+        }
+        if (check_signature && (param->get_element_type() != m_input_types[i] ||
+                                remove_batch_axis(shape) != m_input_shapes[i]))
+        {
+            throw ngraph_error("Batched Function Parameter '" + param->get_name() +
+                               "' for batch size " + to_string(size) +
+                               " does not match the per-sample element type and shape {" +
+                               join(m_input_shapes[i]) + "}");
+        }
+        auto tv = m_backend->create_tensor(param->get_element_type(), shape);
+        instance.m_input_staging.emplace_back(shape_size(shape) *
+                                              param->get_element_type().size());
+        instance.m_inputs.push_back(tv);
+    }
+    for (size_t i = 0; i < instance.m_function->get_output_size(); i++)
+    {
+        const Shape& shape = instance.m_function->get_output_shape(i);
+        const element::Type& type = instance.m_function->get_output_element_type(i);
+        if (shape.empty() || shape[0] != size)
+        {
+            throw ngraph_error("Batched Function output " + to_string(i) +
+                               " does not have batch size " + to_string(size) + " on axis 0");
+        }
+        if (check_signature &&
+            (type != m_output_types[i] || remove_batch_axis(shape) != m_output_shapes[i]))
+        {
+            throw ngraph_error("Batched Function output " + to_string(i) + " for batch size " +
+                               to_string(size) +
+                               " does not match the per-sample element type and shape {" +
+                               join(m_output_shapes[i]) + "}");
+        }
+        instance.m_outputs.push_back(m_backend->create_tensor(type, shape));
+        instance.m_output_staging.emplace_back(shape_size(shape) * type.size());
+    }
+    m_backend->compile(instance.m_function);
+
+    return m_batch_instances.insert({size, move(instance)}).first->second;
+}
+
+void runtime::RequestBatcher::worker()
+{
+    while (true)
+    {
+        vector<Request> batch;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_request_available.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty())
+            {
+                // m_stop is set and all queued requests have been served
+                return;
+            }
+
+            // Hold the batch open until it fills or the oldest request reaches its deadline.
+            // On shutdown whatever is queued is dispatched immediately.
+            auto deadline = m_queue.front().m_arrival + m_config.m_max_delay;
+            m_request_available.wait_until(lock, deadline, [this]() {
+                return m_stop || m_queue.size() >= m_config.m_max_batch_size;
+            });
+
+            size_t count = min(m_queue.size(), m_config.m_max_batch_size);
+            for (size_t i = 0; i < count; i++)
+            {
+                batch.push_back(move(m_queue.front()));
+                m_queue.pop_front();
+            }
+        }
+
+        run_batch(batch);
+    }
+}
+
+void runtime::RequestBatcher::run_batch(vector<Request>& requests)
+{
+    size_t count = requests.size();
+    try
+    {
+        size_t batch_size = m_config.m_pad_to_max_batch_size ? m_config.m_max_batch_size : count;
+        BatchInstance& instance = get_batch_instance(batch_size);
+
+        // Gather. Padding rows keep whatever the previous batch left there; their results are
+        // never read.
+        for (size_t i = 0; i < instance.m_inputs.size(); i++)
+        {
+            vector<char>& staging = instance.m_input_staging[i];
+            size_t sample_bytes = staging.size() / batch_size;
+            for (size_t r = 0; r < count; r++)
+            {
+                requests[r].m_inputs[i]->read(staging.data() + r * sample_bytes, 0, sample_bytes);
+            }
+            instance.m_inputs[i]->write(staging.data(), 0, staging.size());
+        }
+
+        m_backend->call(instance.m_function, instance.m_outputs, instance.m_inputs);
+
+        // Scatter
+        for (size_t i = 0; i < instance.m_outputs.size(); i++)
+        {
+            vector<char>& staging = instance.m_output_staging[i];
+            size_t sample_bytes = staging.size() / batch_size;
+            instance.m_outputs[i]->read(staging.data(), 0, staging.size());
+            for (size_t r = 0; r < count; r++)
+            {
+                requests[r].m_outputs[i]->write(
+                    staging.data() + r * sample_bytes, 0, sample_bytes);
+            }
+        }
+    }
+    catch (...)
+    {
+        for (Request& request : requests)
+        {
+            request.m_promise.set_exception(current_exception());
+        }
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_statistics.m_request_count += count;
+        m_statistics.m_batch_count++;
+        m_statistics.m_batch_size_histogram[count]++;
+    }
+    for (Request& request : requests)
+    {
+        request.m_promise.set_value();
+    }
+}
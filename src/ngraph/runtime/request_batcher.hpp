@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+        class RequestBatcher;
+    }
+}
+
+/// @brief Coalesces single-sample requests into batched calls on a Backend.
+///
+/// Every Parameter and Result of the batched Function carries the batch on axis 0. A request
+/// supplies one tensor per Parameter and one per Result with axis 0 removed. Requests are
+/// queued and a batch is dispatched as soon as max_batch_size requests are waiting or the
+/// oldest waiting request has been queued for max_delay, whichever happens first. Inputs are
+/// gathered into the batched tensors, the backend is called once, and each sample's slice of
+/// the results is copied back into that request's output tensors.
+class ngraph::runtime::RequestBatcher
+{
+public:
+    /// @brief Builds the Function to run for a given batch size.
+    using FunctionBuilder = std::function<std::shared_ptr<Function>(size_t batch_size)>;
+
+    class Config
+    {
+    public:
+        Config(size_t max_batch_size, std::chrono::microseconds max_delay)
+            : m_max_batch_size(max_batch_size)
+            , m_max_delay(max_delay)
+        {
+        }
+
+        size_t m_max_batch_size;
+        std::chrono::microseconds m_max_delay;
+        /// If set, every batch runs the max_batch_size Function with the unused rows padded,
+        /// so only one Function is ever compiled. Otherwise a Function is built and compiled
+        /// for each distinct batch size that is dispatched.
+        bool m_pad_to_max_batch_size = false;
+    };
+
+    class Statistics
+    {
+    public:
+        size_t m_request_count = 0;
+        size_t m_batch_count = 0;
+        /// Entry i counts the batches dispatched with i requests in them.
+        std::vector<size_t> m_batch_size_histogram;
+
+        double get_average_batch_size() const;
+    };
+
+    RequestBatcher(const std::shared_ptr<Backend>& backend,
+                   const FunctionBuilder& builder,
+                   const Config& config);
+
+    /// @brief Completes all queued requests before returning.
+    ~RequestBatcher();
+
+    RequestBatcher(const RequestBatcher&) = delete;
+    RequestBatcher& operator=(const RequestBatcher&) = delete;
+
+    /// @brief Queue a single-sample request.
+    ///
+    /// The tensors must stay unmodified (inputs) and unread (outputs) until the returned future
+    /// is ready. Shape and element type mismatches are reported immediately by throwing
+    /// ngraph_error; errors raised while executing the batch are rethrown from future::get().
+    std::future<void> submit(const TensorViewPtrs& outputs, const TensorViewPtrs& inputs);
+
+    Statistics get_statistics() const;
+
+private:
+    class Request
+    {
+    public:
+        TensorViewPtrs m_outputs;
+        TensorViewPtrs m_inputs;
+        std::promise<void> m_promise;
+        std::chrono::steady_clock::time_point m_arrival;
+    };
+
+    class BatchInstance
+    {
+    public:
+        std::shared_ptr<Function> m_function;
+        TensorViewPtrs m_outputs;
+        TensorViewPtrs m_inputs;
+        std::vector<std::vector<char>> m_output_staging;
+        std::vector<std::vector<char>> m_input_staging;
+    };
+
+    void worker();
+    void run_batch(std::vector<Request>& requests);
+    BatchInstance& get_batch_instance(size_t batch_size);
+
+    std::shared_ptr<Backend> m_backend;
+    FunctionBuilder m_builder;
+    Config m_config;
+
+    // Per-sample element types and shapes, taken from the max_batch_size Function
+    std::vector<element::Type> m_input_types;
+    std::vector<Shape> m_input_shapes;
+    std::vector<element::Type> m_output_types;
+    std::vector<Shape> m_output_shapes;
+
+    std::map<size_t, BatchInstance> m_batch_instances;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_request_available;
+    std::deque<Request> m_queue;
+    Statistics m_statistics;
+    bool m_stop;
+    std::thread m_thread;
+};
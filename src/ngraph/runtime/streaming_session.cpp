@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <utility>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/streaming_session.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static void write_zeros(const shared_ptr<runtime::TensorView>& tensor)
+{
+    size_t size = tensor->get_tensor().size();
+    vector<char> zeros(size, 0);
+    tensor->write(zeros.data(), 0, size);
+}
+
+runtime::StreamingSession::StreamingSession(const shared_ptr<Backend>& backend,
+                                            const shared_ptr<Function>& function,
+                                            const vector<State>& states)
+    : m_backend(backend)
+    , m_function(function)
+    , m_input_index(function->get_parameters().size(), 0)
+    , m_output_index(function->get_output_size(), 0)
+    , m_call_inputs(function->get_parameters().size())
+    , m_call_outputs(function->get_output_size())
+    , m_step_count(0)
+{
+    for (const State& state : states)
+    {
+        if (state.m_parameter_index >= m_input_index.size() ||
+            state.m_result_index >= m_output_index.size())
+        {
+            throw ngraph_error("StreamingSession state refers to Result " +
+                               to_string(state.m_result_index) + " and Parameter " +
+                               to_string(state.m_parameter_index) +
+                               ", which the Function does not have");
+        }
+        if (m_input_index[state.m_parameter_index] < 0 || m_output_index[state.m_result_index] < 0)
+        {
+            throw ngraph_error("StreamingSession Parameter " +
+                               to_string(state.m_parameter_index) + " or Result " +
+                               to_string(state.m_result_index) + " is in more than one state");
+        }
+        m_input_index[state.m_parameter_index] = -1;
+        m_output_index[state.m_result_index] = -1;
+
+        auto parameter = function->get_parameters()[state.m_parameter_index];
+        const element::Type& type = parameter->get_element_type();
+        const Shape& shape = parameter->get_shape();
+        if (function->get_output_element_type(state.m_result_index) != type ||
+            function->get_output_shape(state.m_result_index) != shape)
+        {
+            throw ngraph_error("StreamingSession Result " + to_string(state.m_result_index) +
+                               " does not match the element type and shape of Parameter " +
+                               to_string(state.m_parameter_index));
+        }
+
+        StateInstance instance{state, {}};
+        instance.m_tensors[0] = backend->create_tensor(type, shape);
+        write_zeros(instance.m_tensors[0]);
+        instance.m_tensors[1] =
+            state.m_in_place ? instance.m_tensors[0] : backend->create_tensor(type, shape);
+        m_states.push_back(instance);
+    }
+
+    m_input_count = 0;
+    for (int& index : m_input_index)
+    {
+        if (index == 0)
+        {
+            index = static_cast<int>(m_input_count++);
+        }
+    }
+    m_output_count = 0;
+    for (int& index : m_output_index)
+    {
+        if (index == 0)
+        {
+            index = static_cast<int>(m_output_count++);
+        }
+    }
+
+    m_backend->compile(m_function);
+}
+
+bool runtime::StreamingSession::call(const TensorViewPtrs& outputs, const TensorViewPtrs& inputs)
+{
+    if (outputs.size() != m_output_count || inputs.size() != m_input_count)
+    {
+        throw ngraph_error("StreamingSession step takes " + to_string(m_output_count) +
+                           " outputs and " + to_string(m_input_count) + " inputs, got " +
+                           to_string(outputs.size()) + " and " + to_string(inputs.size()));
+    }
+    for (size_t i = 0; i < m_input_index.size(); i++)
+    {
+        if (m_input_index[i] >= 0)
+        {
+            m_call_inputs[i] = inputs[m_input_index[i]];
+        }
+    }
+    for (size_t i = 0; i < m_output_index.size(); i++)
+    {
+        if (m_output_index[i] >= 0)
+        {
+            m_call_outputs[i] = outputs[m_output_index[i]];
+        }
+    }
+    for (const StateInstance& instance : m_states)
+    {
+        m_call_inputs[instance.m_state.m_parameter_index] = instance.m_tensors[0];
+        m_call_outputs[instance.m_state.m_result_index] = instance.m_tensors[1];
+    }
+
+    bool rc = m_backend->call(m_function, m_call_outputs, m_call_inputs);
+
+    // What was written becomes what the next step reads
+    for (StateInstance& instance : m_states)
+    {
+        swap(instance.m_tensors[0], instance.m_tensors[1]);
+    }
+    m_step_count++;
+    return rc;
+}
+
+shared_ptr<runtime::TensorView> runtime::StreamingSession::get_state(size_t i) const
+{
+    return m_states.at(i).m_tensors[0];
+}
+
+void runtime::StreamingSession::reset()
+{
+    for (const StateInstance& instance : m_states)
+    {
+        write_zeros(instance.m_tensors[0]);
+    }
+    m_step_count = 0;
+}
@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+        class StreamingSession;
+    }
+}
+
+/// @brief Runs a Function step by step, carrying state from each call to the next.
+///
+/// Recurrent models take their previous hidden and cell state as Parameters and return the
+/// new state as Results. A session pairs such Results with the Parameters they feed and keeps
+/// the state in tensors of the backend, so a step only passes the remaining inputs and
+/// outputs, and the state is never copied in or out. By default each state has two tensors
+/// that swap roles after every call. An in-place state has a single tensor that is both the
+/// Parameter and the Result.
+class ngraph::runtime::StreamingSession
+{
+public:
+    using TensorViewPtrs = std::vector<std::shared_ptr<TensorView>>;
+
+    class State
+    {
+    public:
+        State(size_t result_index, size_t parameter_index, bool in_place = false)
+            : m_result_index(result_index)
+            , m_parameter_index(parameter_index)
+            , m_in_place(in_place)
+        {
+        }
+
+        size_t m_result_index;
+        size_t m_parameter_index;
+        /// Write the new state over the old one. This is only correct if each op reading the
+        /// state Parameter is done with an element before that element of the Result is
+        /// written. Elementwise updates such as c = f * c + i * g qualify; an update through
+        /// a Dot does not.
+        bool m_in_place;
+    };
+
+    /// Compiles function on backend and creates the state tensors, filled with zeros.
+    /// Throws ngraph_error if a pair differs in element type or shape, or if a Result or
+    /// Parameter is used by two states.
+    StreamingSession(const std::shared_ptr<Backend>& backend,
+                     const std::shared_ptr<Function>& function,
+                     const std::vector<State>& states);
+
+    StreamingSession(const StreamingSession&) = delete;
+    StreamingSession& operator=(const StreamingSession&) = delete;
+
+    /// @brief Run one step.
+    /// @param outputs The Function's Results that are not state, in order
+    /// @param inputs The Function's Parameters that are not state, in order
+    bool call(const TensorViewPtrs& outputs, const TensorViewPtrs& inputs);
+
+    /// @brief The tensor state i is read from by the next call. Write to it to seed the state.
+    std::shared_ptr<TensorView> get_state(size_t i) const;
+
+    /// @brief Set every state back to zeros.
+    void reset();
+
+    size_t get_step_count() const { return m_step_count; }
+private:
+    class StateInstance
+    {
+    public:
+        State m_state;
+        // One tensor for an in-place state, otherwise the one read next and the one written
+        std::shared_ptr<TensorView> m_tensors[2];
+    };
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Function> m_function;
+    std::vector<StateInstance> m_states;
+    // Position of each Parameter and Result in the caller's vectors, or -1 for a state
+    std::vector<int> m_input_index;
+    std::vector<int> m_output_index;
+    size_t m_input_count;
+    size_t m_output_count;
+    // Reused for every call so a step does not allocate
+    TensorViewPtrs m_call_inputs;
+    TensorViewPtrs m_call_outputs;
+    size_t m_step_count;
+};
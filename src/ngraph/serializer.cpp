@@ -37,6 +37,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -64,6 +65,9 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/quantized_dot.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -578,6 +582,13 @@ static shared_ptr<ngraph::Function>
             {
                 node = make_shared<op::Cosh>(args[0]);
             }
+            else if (node_op == "Dequantize")
+            {
+                auto type = read_element_type(node_js.at("type"));
+                auto scale = node_js.at("scale").get<double>();
+                auto zero_point = node_js.at("zero_point").get<int64_t>();
+                node = make_shared<op::Dequantize>(args[0], type, scale, zero_point);
+            }
             else if (node_op == "Divide")
             {
                 node = make_shared<op::Divide>(args[0], args[1]);
@@ -756,6 +767,50 @@ static shared_ptr<ngraph::Function>
                 auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
                 node = make_shared<op::Product>(args[0], reduction_axes);
             }
+            else if (node_op == "Quantize")
+            {
+                auto type = read_element_type(node_js.at("type"));
+                auto scale = node_js.at("scale").get<double>();
+                auto zero_point = node_js.at("zero_point").get<int64_t>();
+                node = make_shared<op::Quantize>(args[0], type, scale, zero_point);
+            }
+            else if (node_op == "QuantizedConvolution")
+            {
+                auto window_movement_strides =
+                    node_js.at("window_movement_strides").get<vector<size_t>>();
+                auto window_dilation_strides =
+                    node_js.at("window_dilation_strides").get<vector<size_t>>();
+                auto padding_below = node_js.at("padding_below").get<vector<std::ptrdiff_t>>();
+                auto padding_above = node_js.at("padding_above").get<vector<std::ptrdiff_t>>();
+                auto data_dilation_strides =
+                    node_js.at("data_dilation_strides").get<vector<size_t>>();
+                node = make_shared<op::QuantizedConvolution>(
+                    args[0],
+                    args[1],
+                    window_movement_strides,
+                    window_dilation_strides,
+                    padding_below,
+                    padding_above,
+                    data_dilation_strides,
+                    read_element_type(node_js.at("type")),
+                    node_js.at("input_scale").get<double>(),
+                    node_js.at("input_zero_point").get<int64_t>(),
+                    node_js.at("filters_scale").get<double>(),
+                    node_js.at("output_scale").get<double>(),
+                    node_js.at("output_zero_point").get<int64_t>());
+            }
+            else if (node_op == "QuantizedDot")
+            {
+                node = make_shared<op::QuantizedDot>(
+                    args[0],
+                    args[1],
+                    read_element_type(node_js.at("type")),
+                    node_js.at("input_scale").get<double>(),
+                    node_js.at("input_zero_point").get<int64_t>(),
+                    node_js.at("weights_scale").get<double>(),
+                    node_js.at("output_scale").get<double>(),
+                    node_js.at("output_zero_point").get<int64_t>());
+            }
             else if (node_op == "Reduce")
             {
                 auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
@@ -1100,6 +1155,13 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "Cosh")
     {
     }
+    else if (node_op == "Dequantize")
+    {
+        auto tmp = dynamic_cast<const op::Dequantize*>(&n);
+        node["type"] = write_element_type(tmp->get_element_type());
+        node["scale"] = tmp->get_scale();
+        node["zero_point"] = tmp->get_zero_point();
+    }
     else if (node_op == "Divide")
     {
     }
@@ -1212,6 +1274,38 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "Power")
     {
     }
+    else if (node_op == "Quantize")
+    {
+        auto tmp = dynamic_cast<const op::Quantize*>(&n);
+        node["type"] = write_element_type(tmp->get_element_type());
+        node["scale"] = tmp->get_scale();
+        node["zero_point"] = tmp->get_zero_point();
+    }
+    else if (node_op == "QuantizedConvolution")
+    {
+        auto tmp = dynamic_cast<const op::QuantizedConvolution*>(&n);
+        node["window_movement_strides"] = tmp->get_window_movement_strides();
+        node["window_dilation_strides"] = tmp->get_window_dilation_strides();
+        node["padding_below"] = tmp->get_padding_below();
+        node["padding_above"] = tmp->get_padding_above();
+        node["data_dilation_strides"] = tmp->get_data_dilation_strides();
+        node["type"] = write_element_type(tmp->get_element_type());
+        node["input_scale"] = tmp->get_input_scale();
+        node["input_zero_point"] = tmp->get_input_zero_point();
+        node["filters_scale"] = tmp->get_filters_scale();
+        node["output_scale"] = tmp->get_output_scale();
+        node["output_zero_point"] = tmp->get_output_zero_point();
+    }
+    else if (node_op == "QuantizedDot")
+    {
+        auto tmp = dynamic_cast<const op::QuantizedDot*>(&n);
+        node["type"] = write_element_type(tmp->get_element_type());
+        node["input_scale"] = tmp->get_input_scale();
+        node["input_zero_point"] = tmp->get_input_zero_point();
+        node["weights_scale"] = tmp->get_weights_scale();
+        node["output_scale"] = tmp->get_output_scale();
+        node["output_zero_point"] = tmp->get_output_zero_point();
+    }
     else if (node_op == "Reduce")
     {
         auto tmp = dynamic_cast<const op::Reduce*>(&n);
@@ -0,0 +1,197 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief A sequence whose elements never move once constructed, so pointers to them stay
+    ///        valid as it grows.
+    ///
+    /// This gives the pointer stability of std::deque without its fixed overhead: nothing is
+    /// allocated until the first element, and then only what the elements need. Elements live
+    /// in blocks of doubling capacity. A reserve before the first insertion sizes the first
+    /// block exactly, so a sequence of known length takes a single allocation.
+    template <typename T>
+    class StableVector
+    {
+        struct Block
+        {
+            T* data;
+            size_t capacity;
+            size_t size;
+        };
+
+        template <typename Blocks, typename Value>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            Iterator(Blocks* blocks, size_t block, size_t offset)
+                : m_blocks(blocks)
+                , m_block(block)
+                , m_offset(offset)
+            {
+            }
+
+            reference operator*() const { return (*m_blocks)[m_block].data[m_offset]; }
+            pointer operator->() const { return &**this; }
+            Iterator& operator++()
+            {
+                if (++m_offset == (*m_blocks)[m_block].size)
+                {
+                    m_block++;
+                    m_offset = 0;
+                }
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator rc = *this;
+                ++*this;
+                return rc;
+            }
+            bool operator==(const Iterator& other) const
+            {
+                return m_block == other.m_block && m_offset == other.m_offset;
+            }
+            bool operator!=(const Iterator& other) const { return !(*this == other); }
+        private:
+            Blocks* m_blocks;
+            size_t m_block;
+            size_t m_offset;
+        };
+
+    public:
+        using value_type = T;
+        using iterator = Iterator<std::vector<Block>, T>;
+        using const_iterator = Iterator<const std::vector<Block>, const T>;
+
+        StableVector() = default;
+        StableVector(const StableVector&) = delete;
+        StableVector& operator=(const StableVector&) = delete;
+        ~StableVector()
+        {
+            for (Block& block : m_blocks)
+            {
+                for (size_t i = 0; i < block.size; i++)
+                {
+                    block.data[i].~T();
+                }
+                ::operator delete(block.data);
+            }
+        }
+
+        /// \brief Sizes the first block for n elements. Has no effect once a block exists.
+        void reserve(size_t n)
+        {
+            if (m_blocks.empty() && n > 0)
+            {
+                add_block(n);
+            }
+        }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_blocks.empty() || m_blocks.back().size == m_blocks.back().capacity)
+            {
+                add_block(m_blocks.empty() ? 1 : 2 * m_blocks.back().capacity);
+            }
+            Block& block = m_blocks.back();
+            T* element = new (block.data + block.size) T(std::forward<Args>(args)...);
+            block.size++;
+            m_size++;
+            return *element;
+        }
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        T& operator[](size_t i) { return locate(i); }
+        const T& operator[](size_t i) const { return locate(i); }
+        T& at(size_t i)
+        {
+            check_index(i);
+            return locate(i);
+        }
+        const T& at(size_t i) const
+        {
+            check_index(i);
+            return locate(i);
+        }
+        T& front() { return locate(0); }
+        const T& front() const { return locate(0); }
+        T& back() { return m_blocks.back().data[m_blocks.back().size - 1]; }
+        const T& back() const { return m_blocks.back().data[m_blocks.back().size - 1]; }
+        iterator begin() { return m_size == 0 ? end() : iterator(&m_blocks, 0, 0); }
+        iterator end() { return iterator(&m_blocks, end_block(), 0); }
+        const_iterator begin() const
+        {
+            return m_size == 0 ? end() : const_iterator(&m_blocks, 0, 0);
+        }
+        const_iterator end() const { return const_iterator(&m_blocks, end_block(), 0); }
+    private:
+        void add_block(size_t capacity)
+        {
+            m_blocks.reserve(m_blocks.size() + 1);
+            T* data = static_cast<T*>(::operator new(capacity * sizeof(T)));
+            m_blocks.push_back(Block{data, capacity, 0});
+        }
+
+        // A reserved block may still be empty, and iteration must not stop inside it
+        size_t end_block() const
+        {
+            return m_blocks.empty() || m_blocks.back().size > 0 ? m_blocks.size()
+                                                                : m_blocks.size() - 1;
+        }
+
+        void check_index(size_t i) const
+        {
+            if (i >= m_size)
+            {
+                throw std::out_of_range("StableVector index out of range");
+            }
+        }
+
+        T& locate(size_t i) const
+        {
+            for (const Block& block : m_blocks)
+            {
+                if (i < block.size)
+                {
+                    return block.data[i];
+                }
+                i -= block.size;
+            }
+            return m_blocks.back().data[i];
+        }
+
+        std::vector<Block> m_blocks;
+        size_t m_size = 0;
+    };
+}
@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace ngraph
+{
+    /// \brief Brain floating point storage type: the upper 16 bits of an IEEE 754 float
+    ///        (1 sign, 8 exponent, 7 mantissa bits).
+    ///
+    /// bfloat16 keeps the float exponent range, so widening is a shift and narrowing only
+    /// rounds the mantissa. Arithmetic is done by widening to float.
+    class bfloat16
+    {
+    public:
+        bfloat16()
+            : m_value{0}
+        {
+        }
+        bfloat16(float value)
+            : m_value{round_to_nearest_even(value)}
+        {
+        }
+
+        operator float() const
+        {
+            uint32_t bits = static_cast<uint32_t>(m_value) << 16;
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        uint16_t to_bits() const { return m_value; }
+        static bfloat16 from_bits(uint16_t bits)
+        {
+            bfloat16 rc;
+            rc.m_value = bits;
+            return rc;
+        }
+
+    private:
+        static uint16_t round_to_nearest_even(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            if ((bits & 0x7fffffff) > 0x7f800000)
+            {
+                // Truncating a nan could leave an inf, so force a quiet nan
+                return static_cast<uint16_t>((bits >> 16) | 0x0040);
+            }
+            bits += 0x7fff + ((bits >> 16) & 1);
+            return static_cast<uint16_t>(bits >> 16);
+        }
+
+        uint16_t m_value;
+    };
+
+    inline std::ostream& operator<<(std::ostream& out, const bfloat16& value)
+    {
+        return out << static_cast<float>(value);
+    }
+}
@@ -29,11 +29,16 @@
 
 namespace ngraph
 {
+    class float16;
+    class bfloat16;
+
     namespace element
     {
         class Type;
 
         extern const Type boolean;
+        extern const Type f16;
+        extern const Type bf16;
         extern const Type f32;
         extern const Type f64;
         extern const Type i8;
@@ -84,6 +89,10 @@ namespace ngraph
         template <>
         const Type& from<bool>();
         template <>
+        const Type& from<float16>();
+        template <>
+        const Type& from<bfloat16>();
+        template <>
         const Type& from<float>();
         template <>
         const Type& from<double>();
@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace ngraph
+{
+    /// \brief IEEE 754 half precision storage type (1 sign, 5 exponent, 10 mantissa bits).
+    ///
+    /// float16 is a storage format only: arithmetic is done by widening to float, which the
+    /// implicit conversions below make transparent.
+    class float16
+    {
+    public:
+        float16()
+            : m_value{0}
+        {
+        }
+        float16(float value)
+            : m_value{round_to_nearest_even(value)}
+        {
+        }
+
+        operator float() const
+        {
+            uint32_t sign = static_cast<uint32_t>(m_value & 0x8000) << 16;
+            uint32_t exponent = (m_value >> 10) & 0x1f;
+            uint32_t mantissa = m_value & 0x3ff;
+            uint32_t bits;
+            if (exponent == 0x1f)
+            {
+                // inf or nan
+                bits = sign | 0x7f800000 | (mantissa << 13);
+            }
+            else if (exponent == 0)
+            {
+                // zero or subnormal, value is mantissa * 2^-24
+                float value = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+                return sign ? -value : value;
+            }
+            else
+            {
+                bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+            }
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        uint16_t to_bits() const { return m_value; }
+        static float16 from_bits(uint16_t bits)
+        {
+            float16 rc;
+            rc.m_value = bits;
+            return rc;
+        }
+
+    private:
+        static uint16_t round_to_nearest_even(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            uint32_t sign = (bits >> 16) & 0x8000;
+            uint32_t magnitude = bits & 0x7fffffff;
+            if (magnitude >= 0x7f800000)
+            {
+                // inf stays inf, nan is kept quiet
+                return static_cast<uint16_t>(sign | 0x7c00 |
+                                             (magnitude > 0x7f800000 ? 0x200 : 0));
+            }
+            if (magnitude >= 0x477ff000)
+            {
+                // 65520 and above round past the largest finite half
+                return static_cast<uint16_t>(sign | 0x7c00);
+            }
+            if (magnitude < 0x38800000)
+            {
+                // Result is subnormal. Adding 0.5 puts the half ulp (2^-24) in the float ulp
+                // position so the FPU performs the round to nearest even for us.
+                float f;
+                std::memcpy(&f, &magnitude, sizeof(f));
+                f += 0.5f;
+                uint32_t rounded;
+                std::memcpy(&rounded, &f, sizeof(rounded));
+                return static_cast<uint16_t>(sign | (rounded - 0x3f000000));
+            }
+            // Rebias the exponent from 127 to 15 and round the dropped 13 mantissa bits
+            uint32_t odd = (magnitude >> 13) & 1;
+            magnitude += 0xc8000fff + odd;
+            return static_cast<uint16_t>(sign | (magnitude >> 13));
+        }
+
+        uint16_t m_value;
+    };
+
+    inline std::ostream& operator<<(std::ostream& out, const float16& value)
+    {
+        return out << static_cast<float>(value);
+    }
+}
@@ -66,34 +66,65 @@ namespace ngraph
         return os.str();
     }
 
-    template <typename U, typename T>
-    bool contains(const U& container, const T& obj)
+    namespace detail
     {
-        bool rc = false;
-        for (auto o : container)
+        // Associative containers answer membership with find; anything else is scanned. The
+        // int/long parameter prefers the find overload whenever it compiles.
+        template <typename U, typename T>
+        auto contains(const U& container, const T& obj, int)
+            -> decltype(container.find(obj) != container.end())
+        {
+            return container.find(obj) != container.end();
+        }
+
+        template <typename U, typename T>
+        bool contains(const U& container, const T& obj, long)
         {
-            if (o == obj)
+            bool rc = false;
+            for (auto o : container)
             {
-                rc = true;
-                break;
+                if (o == obj)
+                {
+                    rc = true;
+                    break;
+                }
             }
+            return rc;
         }
-        return rc;
-    }
 
-    template <typename U, typename T>
-    bool contains_key(const U& container, const T& obj)
-    {
-        bool rc = false;
-        for (auto o : container)
+        template <typename U, typename T>
+        auto contains_key(const U& container, const T& obj, int)
+            -> decltype(container.find(obj) != container.end())
+        {
+            return container.find(obj) != container.end();
+        }
+
+        template <typename U, typename T>
+        bool contains_key(const U& container, const T& obj, long)
         {
-            if (o.first == obj)
+            bool rc = false;
+            for (auto o : container)
             {
-                rc = true;
-                break;
+                if (o.first == obj)
+                {
+                    rc = true;
+                    break;
+                }
             }
+            return rc;
         }
-        return rc;
+    }
+
+    template <typename U, typename T>
+    bool contains(const U& container, const T& obj)
+    {
+        return detail::contains(container, obj, 0);
+    }
+
+    template <typename U, typename T>
+    bool contains_key(const U& container, const T& obj)
+    {
+        return detail::contains_key(container, obj, 0);
     }
 
     template <typename U, typename T>
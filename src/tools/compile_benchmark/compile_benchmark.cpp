@@ -15,10 +15,13 @@
 *******************************************************************************/
 
 #include <fstream>
+#include <sstream>
 #include <ngraph/codegen/compiler.hpp>
 #include <ngraph/codegen/execution_engine.hpp>
 #include <ngraph/file_util.hpp>
-#include <ngraph/util.hpp>
+#include <ngraph/pass/compile_profile.hpp>
+#include <ngraph/runtime/cpu/cpu_external_function.hpp>
+#include <ngraph/serializer.hpp>
 #include <ngraph/util.hpp>
 
 using namespace std;
@@ -30,14 +33,55 @@ void help()
 DESCRIPTION
     Benchmark compile process identical to ngraph JIT.
 
+    A .json file is a serialized model, compiled by the CPU backend with every pass, emission
+    and JIT phase timed. Any other file is generated source, timed through compile and JIT.
+
 SYNOPSIS
-        compile_benchmark <filename>
+        compile_benchmark [-r|--report <report.json>] <filename>
+
+OPTIONS
+        -r|--report         Write the phase timings and graph sizes to a JSON file
 )###" << endl;
 }
 
+static pass::CompileProfile profile_model(const string& model_path)
+{
+    const string json_string = file_util::read_file_to_string(model_path);
+    stringstream ss(json_string);
+    shared_ptr<Function> f = deserialize(ss);
+
+    auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(f, false);
+    external_function->set_compile_profiling(true);
+    external_function->make_call_frame();
+    return external_function->get_compile_profile();
+}
+
+static pass::CompileProfile profile_source(const string& source_path)
+{
+    pass::CompileProfile profile;
+    stopwatch timer;
+
+    const string source_string = file_util::read_file_to_string(source_path);
+    codegen::Compiler compiler;
+    codegen::ExecutionEngine engine;
+
+    timer.start();
+    auto module = compiler.compile(source_string);
+    timer.stop();
+    profile.add_phase("compile", timer.get_microseconds());
+
+    timer.start();
+    engine.add_module(module);
+    engine.finalize();
+    timer.stop();
+    profile.add_phase("jit", timer.get_microseconds());
+    return profile;
+}
+
 int main(int argc, char** argv)
 {
     string source_path;
+    string report_path;
     for (size_t i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -45,6 +89,10 @@ int main(int argc, char** argv)
         {
             help();
         }
+        else if ((arg == "-r" || arg == "--report") && i + 1 < static_cast<size_t>(argc))
+        {
+            report_path = argv[++i];
+        }
         else
         {
             source_path = arg;
@@ -57,24 +105,17 @@ int main(int argc, char** argv)
         help();
         return 1;
     }
-    else
+
+    bool is_model =
+        source_path.size() > 5 && source_path.compare(source_path.size() - 5, 5, ".json") == 0;
+    pass::CompileProfile profile =
+        is_model ? profile_model(source_path) : profile_source(source_path);
+    profile.write_table(cout);
+
+    if (!report_path.empty())
     {
-        stopwatch timer;
-
-        const string source_string = file_util::read_file_to_string(source_path);
-        codegen::Compiler compiler;
-        codegen::ExecutionEngine engine;
-
-        timer.start();
-        auto module = compiler.compile(source_string);
-        timer.stop();
-        cout << "compile took " << timer.get_milliseconds() << "ms\n";
-
-        timer.start();
-        engine.add_module(module);
-        engine.finalize();
-        timer.stop();
-        cout << "execution engine took " << timer.get_milliseconds() << "ms\n";
+        ofstream out(report_path);
+        profile.write_json(out);
     }
 
     return 0;
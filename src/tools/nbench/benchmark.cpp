@@ -207,6 +207,10 @@ void run_benchmark(shared_ptr<Function> f,
     timer.stop();
     cout.imbue(locale(""));
     cout << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+    runtime::MemoryUsage memory = backend->get_memory_usage(f);
+    cout << "memory: " << memory.total() << " bytes (temporaries " << memory.temporaries
+         << ", workspaces " << memory.workspaces << ", constants " << memory.constants
+         << ", code " << memory.code << ", call frames " << memory.call_frames << ")" << endl;
 
     vector<shared_ptr<runtime::TensorView>> args;
     vector<bool> args_cacheable;
@@ -18,6 +18,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/util.hpp"
+#include "util/test_tools.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -34,3 +35,104 @@ TEST(backend_api, invalid_name)
 {
     ASSERT_ANY_THROW(ngraph::runtime::Backend::create("COMPLETELY-BOGUS-NAME"));
 }
+
+TEST(backend_api, async_call)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    auto result0 = backend->create_tensor(element::f32, shape);
+    auto result1 = backend->create_tensor(element::f32, shape);
+
+    auto future0 = backend->async_call(f, {result0}, {a, b});
+    auto future1 = backend->async_call(f, {result1}, {b, b});
+    EXPECT_TRUE(future0.get());
+    EXPECT_TRUE(future1.get());
+    EXPECT_EQ((vector<float>{6, 8, 10, 12}), read_vector<float>(result0));
+    EXPECT_EQ((vector<float>{10, 12, 14, 16}), read_vector<float>(result1));
+}
+
+TEST(backend_api, async_call_with_remove_compiled_function)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, op::ParameterVector{A, B});
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto D = make_shared<op::Parameter>(element::f32, shape);
+    auto g = make_shared<Function>(C * D, op::ParameterVector{C, D});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    vector<shared_ptr<runtime::TensorView>> results;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < 50; i++)
+    {
+        results.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(backend->async_call(f, {results.back()}, {a, b}));
+    }
+
+    // The worker recompiles f whenever it has been removed
+    auto product = backend->create_tensor(element::f32, shape);
+    for (size_t i = 0; i < 50; i++)
+    {
+        backend->remove_compiled_function(f);
+        EXPECT_TRUE(backend->compile(g));
+        EXPECT_TRUE(backend->call(g, {product}, {a, b}));
+        backend->remove_compiled_function(g);
+    }
+    EXPECT_EQ((vector<float>{5, 12, 21, 32}), read_vector<float>(product));
+
+    for (size_t i = 0; i < futures.size(); i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        EXPECT_EQ((vector<float>{6, 8, 10, 12}), read_vector<float>(results[i]));
+    }
+}
+
+TEST(backend_api, async_call_error)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    auto a = backend->create_tensor(element::f32, Shape{3});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    // Validation errors surface through the future rather than at submission
+    auto future = backend->async_call(f, {result}, {a});
+    EXPECT_ANY_THROW(future.get());
+}
+
+TEST(backend_api, interpreter_memory_usage)
+{
+    Shape shape{4, 4};
+    size_t tensor_size = shape_size(shape) * sizeof(float);
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 1));
+    auto f = make_shared<Function>(make_shared<op::Tanh>(A + C) * B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    EXPECT_EQ(0, backend->get_memory_usage(f).total());
+    backend->compile(f);
+    runtime::MemoryUsage usage = backend->get_memory_usage(f);
+    EXPECT_EQ(tensor_size, usage.constants);
+    // The copy of C plus the two intermediates alive while Multiply runs
+    EXPECT_EQ(3 * tensor_size, usage.temporaries);
+    EXPECT_EQ(usage.constants + usage.temporaries, usage.total());
+}
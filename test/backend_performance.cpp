@@ -14,8 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+#include <fstream>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unistd.h>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -24,8 +28,19 @@
 #include "ngraph/codegen/execution_engine.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "util/random.hpp"
@@ -137,3 +152,377 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+//
+// Compares a serving loop that stages each request's inputs and then calls the backend
+// synchronously with one that stages request i+1 while request i executes via async_call.
+//
+TEST(benchmark, async_call_pipelining)
+{
+    const size_t n_requests = 50;
+    Shape shape{256, 256};
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(
+        make_shared<op::Tanh>(make_shared<op::Dot>(make_shared<op::Dot>(A, B), B)),
+        op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> weights(shape_size(shape));
+    rng.initialize(weights);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, weights);
+
+    // Two sets of buffers so one can be staged while the other is in flight
+    vector<shared_ptr<runtime::TensorView>> inputs;
+    vector<shared_ptr<runtime::TensorView>> outputs;
+    for (size_t i = 0; i < 2; i++)
+    {
+        inputs.push_back(backend->create_tensor(element::f32, shape));
+        outputs.push_back(backend->create_tensor(element::f32, shape));
+    }
+
+    vector<float> request(shape_size(shape));
+    auto stage = [&](shared_ptr<runtime::TensorView> tv) {
+        // Stand-in for request decoding and preprocessing
+        rng.initialize(request);
+        copy_data(tv, request);
+    };
+
+    // Warm up so compilation is not part of either measurement
+    stage(inputs[0]);
+    backend->call(f, {outputs[0]}, {inputs[0], b});
+
+    stopwatch sync_timer;
+    sync_timer.start();
+    for (size_t i = 0; i < n_requests; i++)
+    {
+        stage(inputs[0]);
+        backend->call(f, {outputs[0]}, {inputs[0], b});
+    }
+    sync_timer.stop();
+
+    stopwatch async_timer;
+    async_timer.start();
+    stage(inputs[0]);
+    future<bool> in_flight = backend->async_call(f, {outputs[0]}, {inputs[0], b});
+    for (size_t i = 1; i < n_requests; i++)
+    {
+        size_t slot = i % 2;
+        stage(inputs[slot]);
+        in_flight.get();
+        in_flight = backend->async_call(f, {outputs[slot]}, {inputs[slot], b});
+    }
+    in_flight.get();
+    async_timer.stop();
+
+    std::cout << "sync: " << n_requests << " requests in " << sync_timer.get_milliseconds()
+              << "ms, async: " << n_requests << " requests in " << async_timer.get_milliseconds()
+              << "ms" << std::endl;
+
+    // The pipelined result must match a synchronous call on the same staged input
+    size_t last = (n_requests - 1) % 2;
+    auto expected = backend->create_tensor(element::f32, shape);
+    backend->call(f, {expected}, {inputs[last], b});
+    EXPECT_EQ(read_vector<float>(expected), read_vector<float>(outputs[last]));
+}
+
+//
+// Serves four models from four threads of one process, each with its own backend. It runs
+// once with every model allowed all the cores and once with the cores split between the
+// models, and prints the combined throughput of both.
+//
+TEST(benchmark, colocated_models_threading)
+{
+    const size_t n_models = 4;
+    const size_t n_requests = 20;
+    Shape data_shape{8, 16, 32, 32};
+    Shape filters_shape{16, 16, 3, 3};
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> data(shape_size(data_shape));
+    vector<float> filters(shape_size(filters_shape));
+    rng.initialize(data);
+    rng.initialize(filters);
+
+    vector<shared_ptr<runtime::Backend>> backends;
+    vector<shared_ptr<Function>> models;
+    vector<vector<shared_ptr<runtime::TensorView>>> inputs;
+    vector<shared_ptr<runtime::TensorView>> outputs;
+    for (size_t m = 0; m < n_models; m++)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, data_shape);
+        auto W = make_shared<op::Parameter>(element::f32, filters_shape);
+        auto conv1 = make_shared<op::Relu>(make_shared<op::Convolution>(
+            A, W, Strides{1, 1}, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1}));
+        auto conv2 = make_shared<op::Relu>(make_shared<op::Convolution>(
+            conv1, W, Strides{1, 1}, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1}));
+        models.push_back(make_shared<Function>(conv2, op::ParameterVector{A, W}));
+
+        auto backend = runtime::Backend::create("CPU");
+        auto a = backend->create_tensor(element::f32, data_shape);
+        auto w = backend->create_tensor(element::f32, filters_shape);
+        copy_data(a, data);
+        copy_data(w, filters);
+        backends.push_back(backend);
+        inputs.push_back({a, w});
+        outputs.push_back(backend->create_tensor(element::f32, data_shape));
+        // Compile up front so neither measurement includes it
+        backend->call(models[m], {outputs[m]}, inputs[m]);
+    }
+
+    auto serve = [&]() {
+        stopwatch timer;
+        timer.start();
+        vector<thread> clients;
+        for (size_t m = 0; m < n_models; m++)
+        {
+            clients.emplace_back([&, m]() {
+                for (size_t r = 0; r < n_requests; r++)
+                {
+                    backends[m]->call(models[m], {outputs[m]}, inputs[m]);
+                }
+            });
+        }
+        for (thread& client : clients)
+        {
+            client.join();
+        }
+        timer.stop();
+        return n_models * n_requests * 1000.0 / timer.get_milliseconds();
+    };
+
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backends[0]);
+    runtime::cpu::ThreadingConfig original = cpu_backend->get_threading_config();
+    size_t cores = max(thread::hardware_concurrency(), 1u);
+
+    runtime::cpu::ThreadingConfig all_cores;
+    all_cores.num_threads = cores;
+    cpu_backend->set_threading_config(all_cores);
+    double all_cores_throughput = serve();
+
+    runtime::cpu::ThreadingConfig split_cores;
+    split_cores.num_threads = max(cores / n_models, size_t(1));
+    cpu_backend->set_threading_config(split_cores);
+    double split_cores_throughput = serve();
+
+    std::cout << n_models << " co-located models: " << all_cores_throughput
+              << " requests/s with " << cores << " threads each, " << split_cores_throughput
+              << " requests/s with " << split_cores.num_threads << " threads each" << std::endl;
+
+    cpu_backend->set_threading_config(original);
+    EXPECT_EQ(original.num_threads, cpu_backend->get_threading_config().num_threads);
+}
+
+//
+// Runs the same 3x3 convolution over a batch of 8 64x28x28 images in f32 and as a
+// QuantizedConvolution of u8 data with i8 filters and a u8 output, and prints the throughput
+// of each in images per second.
+//
+TEST(benchmark, quantized_convolution_throughput)
+{
+    const size_t n_calls = 20;
+    Shape data_shape{8, 64, 28, 28};
+    Shape filters_shape{64, 64, 3, 3};
+    Strides strides{1, 1};
+    CoordinateDiff padding{1, 1};
+
+    auto backend = runtime::Backend::create("CPU");
+    auto images_per_second = [&](shared_ptr<Function> f,
+                                 shared_ptr<runtime::TensorView> data,
+                                 shared_ptr<runtime::TensorView> filters,
+                                 shared_ptr<runtime::TensorView> result) {
+        // Compile up front so the measurement does not include it
+        backend->call(f, {result}, {data, filters});
+        stopwatch timer;
+        timer.start();
+        for (size_t i = 0; i < n_calls; i++)
+        {
+            backend->call(f, {result}, {data, filters});
+        }
+        timer.stop();
+        return n_calls * data_shape[0] * 1000.0 / timer.get_milliseconds();
+    };
+
+    auto A = make_shared<op::Parameter>(element::f32, data_shape);
+    auto W = make_shared<op::Parameter>(element::f32, filters_shape);
+    auto conv = make_shared<op::Convolution>(A, W, strides, strides, padding, padding);
+    auto f = make_shared<Function>(conv, op::ParameterVector{A, W});
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> data(shape_size(data_shape));
+    vector<float> filters(shape_size(filters_shape));
+    rng.initialize(data);
+    rng.initialize(filters);
+    auto a = backend->create_tensor(element::f32, data_shape);
+    auto w = backend->create_tensor(element::f32, filters_shape);
+    copy_data(a, data);
+    copy_data(w, filters);
+    double f32_throughput =
+        images_per_second(f, a, w, backend->create_tensor(element::f32, data_shape));
+
+    auto QA = make_shared<op::Parameter>(element::u8, data_shape);
+    auto QW = make_shared<op::Parameter>(element::i8, filters_shape);
+    auto qconv = make_shared<op::QuantizedConvolution>(QA,
+                                                       QW,
+                                                       strides,
+                                                       strides,
+                                                       padding,
+                                                       padding,
+                                                       Strides{1, 1},
+                                                       element::u8,
+                                                       1.0 / 128,
+                                                       128,
+                                                       1.0 / 127,
+                                                       1.0 / 16,
+                                                       128);
+    auto qf = make_shared<Function>(qconv, op::ParameterVector{QA, QW});
+    vector<uint8_t> qdata(data.size());
+    vector<int8_t> qfilters(filters.size());
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        qdata[i] = static_cast<uint8_t>(lrint(data[i] * 127) + 128);
+    }
+    for (size_t i = 0; i < filters.size(); i++)
+    {
+        qfilters[i] = static_cast<int8_t>(lrint(filters[i] * 127));
+    }
+    auto qa = backend->create_tensor(element::u8, data_shape);
+    auto qw = backend->create_tensor(element::i8, filters_shape);
+    copy_data(qa, qdata);
+    copy_data(qw, qfilters);
+    double int8_throughput =
+        images_per_second(qf, qa, qw, backend->create_tensor(element::u8, data_shape));
+
+    std::cout << "3x3 convolution, 64 channels, 28x28: " << f32_throughput
+              << " images/s in f32, " << int8_throughput << " images/s in int8" << std::endl;
+}
+
+//
+// Rebuilds the call frame of one compiled graph, whose temporaries take about 128MB, under
+// three page policies: normal pages, transparent huge pages, and transparent huge pages
+// faulted in with the call frame. Prints for each the call frame setup time, the latency of
+// the first call and the mean latency of the calls after it.
+//
+TEST(benchmark, huge_page_temp_pools)
+{
+    const size_t n_calls = 10;
+    Shape shape{1024, 8192};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto t1 = A * B;
+    auto t2 = A + B;
+    auto t3 = t1 * t2;
+    auto t4 = t1 + t3;
+    auto f = make_shared<Function>(t2 * t4 + t3, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> data(shape_size(shape));
+    rng.initialize(data);
+    copy_data(a, data);
+    copy_data(b, data);
+    backend->compile(f);
+
+    using HugePages = runtime::cpu::PagePolicy::HugePages;
+    vector<pair<string, runtime::cpu::PagePolicy>> policies(3);
+    policies[0].first = "normal pages";
+    policies[1].first = "transparent huge pages";
+    policies[1].second.huge_pages = HugePages::Transparent;
+    policies[2].first = "prefaulted transparent huge pages";
+    policies[2].second.huge_pages = HugePages::Transparent;
+    policies[2].second.prefault = true;
+
+    for (auto& policy : policies)
+    {
+        stopwatch timer;
+        timer.start();
+        cpu_backend->set_page_policy(f, policy.second);
+        timer.stop();
+        double setup_ms = timer.get_milliseconds();
+
+        timer.start();
+        backend->call(f, {result}, {a, b});
+        timer.stop();
+        double first_ms = timer.get_milliseconds();
+
+        timer.start();
+        for (size_t i = 0; i < n_calls; i++)
+        {
+            backend->call(f, {result}, {a, b});
+        }
+        timer.stop();
+        double steady_ms = static_cast<double>(timer.get_milliseconds()) / n_calls;
+
+        std::cout << policy.first << ": setup " << setup_ms << "ms, first call " << first_ms
+                  << "ms, steady state " << steady_ms << "ms" << std::endl;
+    }
+}
+
+// Resident set size in bytes, or 0 where /proc is not available
+static size_t resident_bytes()
+{
+    size_t pages = 0;
+    size_t resident = 0;
+    ifstream statm("/proc/self/statm");
+    if (statm >> pages >> resident)
+    {
+        return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+    return 0;
+}
+
+//
+// Measures the metadata cost per node and the time of the generic pass pipeline on a graph of
+// 500k elementwise nodes, arranged as 1000 chains feeding a running sum so that destroying it
+// does not recurse 500k deep. Disabled by default because of its size; run with
+// --gtest_also_run_disabled_tests.
+//
+TEST(benchmark, DISABLED_graph_metadata_500k_nodes)
+{
+    const size_t n_chains = 1000;
+    const size_t chain_length = 500;
+    Shape shape{2};
+
+    size_t resident_before = resident_bytes();
+    stopwatch build_timer;
+    build_timer.start();
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> sum;
+    for (size_t c = 0; c < n_chains; c++)
+    {
+        shared_ptr<Node> x = A;
+        for (size_t i = 0; i < chain_length; i++)
+        {
+            x = (i % 2 == 0) ? static_pointer_cast<Node>(make_shared<op::Add>(x, B))
+                             : static_pointer_cast<Node>(make_shared<op::Multiply>(x, B));
+        }
+        sum = sum ? make_shared<op::Add>(sum, x) : x;
+    }
+    auto f = make_shared<Function>(sum, op::ParameterVector{A, B});
+    build_timer.stop();
+    size_t resident_after = resident_bytes();
+
+    stopwatch pass_timer;
+    pass_timer.start();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+    pass_timer.stop();
+
+    size_t n_nodes = n_chains * (chain_length + 1) - 1;
+    std::cout << n_nodes << " nodes built in " << build_timer.get_milliseconds() << "ms, "
+              << (resident_after - resident_before) / n_nodes << " bytes/node; "
+              << "liveness and memory layout took " << pass_timer.get_milliseconds() << "ms"
+              << std::endl;
+    // The nodes plus the two parameters and the result
+    EXPECT_EQ(f->get_ordered_ops().size(), n_nodes + 3);
+}
@@ -1190,6 +1190,76 @@ NGRAPH_TEST(${BACKEND_NAME}, dot3d_2d)
               read_vector<float>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, dot3d_2d_int32)
+{
+    Shape shape_a{4, 2, 3};
+    auto A = make_shared<op::Parameter>(element::i32, shape_a);
+    Shape shape_b{3, 4};
+    auto B = make_shared<op::Parameter>(element::i32, shape_b);
+    Shape shape_r{4, 2, 4};
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::i32, shape_a);
+    copy_data(a, vector<int32_t>{0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11,
+                                 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23});
+    auto b = backend->create_tensor(element::i32, shape_b);
+    copy_data(b, vector<int32_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+    auto result = backend->create_tensor(element::i32, shape_r);
+
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<int32_t>{20,  23,  26,  29,  56,  68,  80,  92,  92,  113, 134,
+                               155, 128, 158, 188, 218, 164, 203, 242, 281, 200, 248,
+                               296, 344, 236, 293, 350, 407, 272, 338, 404, 470}),
+              read_vector<int32_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dot3d_3d_two_axes_f64)
+{
+    Shape shape_a{2, 2, 3};
+    auto A = make_shared<op::Parameter>(element::f64, shape_a);
+    Shape shape_b{2, 3, 2};
+    auto B = make_shared<op::Parameter>(element::f64, shape_b);
+    Shape shape_r{2, 2};
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B, 2), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f64, shape_a);
+    copy_data(a, vector<double>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    auto b = backend->create_tensor(element::f64, shape_b);
+    copy_data(b, vector<double>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    auto result = backend->create_tensor(element::f64, shape_r);
+
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<double>{161, 182, 377, 434}), read_vector<double>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dot_outer_product_2d_1d)
+{
+    Shape shape_a{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{3};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    Shape shape_r{2, 2, 3};
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B, 0), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{1, 2, 3});
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<float>{1, 2, 3, 2, 4, 6, 3, 6, 9, 4, 8, 12}), read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, dot_scalar_tensor_arg0)
 {
     Shape shape_a{};
@@ -1296,6 +1366,148 @@ NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_vector)
     EXPECT_EQ((vector<float>{190, 486, 782, 1078}), read_vector<float>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_vector_f16)
+{
+    Shape shape_a{4, 4};
+    Shape shape_b{4};
+    auto A = make_shared<op::Parameter>(element::f16, shape_a);
+    auto B = make_shared<op::Parameter>(element::f16, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), op::ParameterVector{A, B});
+    Shape shape_r{4};
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f16, shape_a);
+    copy_data(a, vector<float16>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16});
+    auto b = backend->create_tensor(element::f16, shape_b);
+    copy_data(b, vector<float16>{17, 18, 19, 20});
+    auto result = backend->create_tensor(element::f16, shape_r);
+
+    backend->call(f, {result}, {a, b});
+    auto values = read_vector<float16>(result);
+    EXPECT_EQ((vector<float>{190, 486, 782, 1078}), (vector<float>{begin(values), end(values)}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, mlp_bf16)
+{
+    // bf16 only has 8 bits of precision: the sum of 512 ones stalls at 256 unless the Dot
+    // accumulates in f32
+    Shape shape_a{2, 512};
+    Shape shape_w{512, 2};
+    auto A = make_shared<op::Parameter>(element::bf16, shape_a);
+    auto W = make_shared<op::Parameter>(element::bf16, shape_w);
+    auto B = make_shared<op::Parameter>(element::bf16, Shape{2});
+    auto dot = make_shared<op::Dot>(A, W);
+    auto bias = make_shared<op::Broadcast>(B, Shape{2, 2}, AxisSet{0});
+    auto relu = make_shared<op::Relu>(make_shared<op::Add>(dot, bias));
+    auto f = make_shared<Function>(relu, op::ParameterVector{A, W, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::bf16, shape_a);
+    copy_data(a, vector<bfloat16>(shape_size(shape_a), 1.0f));
+    auto w = backend->create_tensor(element::bf16, shape_w);
+    vector<bfloat16> w_data;
+    for (size_t i = 0; i < 512; i++)
+    {
+        w_data.push_back(1.0f);
+        w_data.push_back(-1.0f);
+    }
+    copy_data(w, w_data);
+    auto b = backend->create_tensor(element::bf16, Shape{2});
+    copy_data(b, vector<bfloat16>{-256.0f, 1.0f});
+    auto result = backend->create_tensor(element::bf16, Shape{2, 2});
+
+    backend->call(f, {result}, {a, w, b});
+    auto values = read_vector<bfloat16>(result);
+    EXPECT_EQ((vector<float>{256, 0, 256, 0}), (vector<float>{begin(values), end(values)}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantize_dequantize)
+{
+    Shape shape{6};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto Q = make_shared<op::Quantize>(A, element::u8, 0.5, 10);
+    auto f = make_shared<Function>(
+        NodeVector{Q, make_shared<op::Dequantize>(Q, element::f32, 0.5, 10)},
+        op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{-10.0f, -0.25f, 0.25f, 0.75f, 3.0f, 200.0f});
+    auto q = backend->create_tensor(element::u8, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call(f, {q, result}, {a});
+    // Halves round to even and out of range values saturate
+    EXPECT_EQ((vector<uint8_t>{0, 10, 10, 12, 16, 255}), read_vector<uint8_t>(q));
+    EXPECT_EQ((vector<float>{-5.0f, 0.0f, 0.0f, 1.0f, 3.0f, 122.5f}),
+              read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantized_dot)
+{
+    Shape shape_a{2, 3};
+    Shape shape_w{3, 2};
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto W = make_shared<op::Parameter>(element::i8, shape_w);
+    auto f32_dot = make_shared<op::QuantizedDot>(A, W, element::f32, 0.5, 2, 0.25);
+    auto i8_dot = make_shared<op::QuantizedDot>(A, W, element::i8, 0.5, 2, 0.25, 0.5, 1);
+    auto f = make_shared<Function>(NodeVector{f32_dot, i8_dot}, op::ParameterVector{A, W});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, vector<uint8_t>{2, 4, 6, 3, 2, 1});
+    auto w = backend->create_tensor(element::i8, shape_w);
+    copy_data(w, vector<int8_t>{1, -2, 3, 4, -5, 6});
+    auto f32_result = backend->create_tensor(element::f32, Shape{2, 2});
+    auto i8_result = backend->create_tensor(element::i8, Shape{2, 2});
+
+    backend->call(f, {f32_result, i8_result}, {a, w});
+    // Accumulators are {-14, 32, 6, -8}, scaled by 0.125
+    EXPECT_EQ((vector<float>{-1.75f, 4.0f, 0.75f, -1.0f}), read_vector<float>(f32_result));
+    EXPECT_EQ((vector<int8_t>{-3, 9, 3, -1}), read_vector<int8_t>(i8_result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantized_convolution)
+{
+    Shape shape_a{1, 1, 3, 3};
+    Shape shape_b{1, 1, 2, 2};
+    auto A = make_shared<op::Parameter>(element::i8, shape_a);
+    auto B = make_shared<op::Parameter>(element::i8, shape_b);
+    auto conv = make_shared<op::QuantizedConvolution>(A,
+                                                      B,
+                                                      Strides{1, 1},
+                                                      Strides{1, 1},
+                                                      CoordinateDiff{1, 1},
+                                                      CoordinateDiff{0, 0},
+                                                      Strides{1, 1},
+                                                      element::f32,
+                                                      0.5,
+                                                      1,
+                                                      2.0);
+    auto f = make_shared<Function>(conv, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::i8, shape_a);
+    copy_data(a, vector<int8_t>{2, 3, 4, 5, 6, 7, 8, 9, 10});
+    auto b = backend->create_tensor(element::i8, shape_b);
+    copy_data(b, vector<int8_t>{1, 0, 0, -1});
+    auto result = backend->create_tensor(element::f32, Shape{1, 1, 3, 3});
+
+    backend->call(f, {result}, {a, b});
+    // Padding stands for real zero, not for the zero point
+    EXPECT_EQ((vector<float>{-1, -2, -3, -4, -4, -4, -7, -4, -4}), read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_vector_int64)
 {
     Shape shape_a{4, 4};
@@ -2001,6 +2213,26 @@ NGRAPH_TEST(${BACKEND_NAME}, convert_float32_bool)
     EXPECT_EQ((vector<char>{1, 2, 3, 4}), read_vector<char>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, convert_float32_f16_round_trip)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(
+        make_shared<op::Convert>(make_shared<op::Convert>(A, element::f16), element::f32),
+        op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1.0f, 0.1f, 65504.0f, 1e5f});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{1.0f, 0.0999755859375f, 65504.0f, INFINITY}),
+              read_vector<float>(result));
+}
+
 // Trivial case with no reduction axes.
 NGRAPH_TEST(${BACKEND_NAME}, reduce_trivial)
 {
@@ -7997,6 +8229,23 @@ NGRAPH_TEST(${BACKEND_NAME}, softmax_underflow)
     EXPECT_TRUE(test::all_close(expected, read_vector<float>(result)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, softmax_very_negative)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{1}), op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{-1e30f, -1e30f, -1e30f, -1e30f, -2e30f, -1e30f});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call(f, {result}, {a});
+    vector<float> expected{1.0f / 3, 1.0f / 3, 1.0f / 3, 0.5f, 0, 0.5f};
+    EXPECT_TRUE(test::all_close(expected, read_vector<float>(result)));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, multiple_backends)
 {
     Shape shape{2, 2};
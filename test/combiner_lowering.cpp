@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/combiner_lowering.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+template <typename T>
+static shared_ptr<Function> make_combiner()
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{});
+    return make_shared<Function>(make_shared<T>(A, B), op::ParameterVector{A, B});
+}
+
+// Runs f before and after lowering on the same inputs and checks the results agree
+static void check_lowering(const shared_ptr<Function>& f, const vector<vector<float>>& inputs)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto original = clone_function(*f);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CombinerLowering>();
+    pass_manager.run_passes(f);
+
+    vector<shared_ptr<runtime::TensorView>> args;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        auto arg = backend->create_tensor(element::f32, f->get_parameters().at(i)->get_shape());
+        copy_data(arg, inputs[i]);
+        args.push_back(arg);
+    }
+    auto expected = backend->create_tensor(element::f32, f->get_output_shape(0));
+    auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+    backend->call(original, {expected}, args);
+    backend->call(f, {result}, args);
+    EXPECT_EQ(read_vector<float>(expected), read_vector<float>(result));
+}
+
+TEST(combiner_lowering, reduce_max)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto init = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(
+        make_shared<op::Reduce>(A, init, make_combiner<op::Maximum>(), AxisSet{1}),
+        op::ParameterVector{A, init});
+
+    check_lowering(f, {{1, 7, 3, -4, -5, -6}, {-2}});
+    EXPECT_EQ(count_ops_of_type<op::Reduce>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Max>(f), 1);
+}
+
+TEST(combiner_lowering, reduce_window_max)
+{
+    // The window covers the leading axes, so the arguments are reshaped for MaxPool
+    auto A = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto init = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(make_shared<op::ReduceWindow>(A,
+                                                                 init,
+                                                                 make_combiner<op::Maximum>(),
+                                                                 Shape{2, 2},
+                                                                 Strides{1, 2}),
+                                   op::ParameterVector{A, init});
+
+    check_lowering(f, {{1, 5, 2, 0, 3, 9, 4, 8, 7, 6, 1, 2}, {4}});
+    EXPECT_EQ(count_ops_of_type<op::ReduceWindow>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::MaxPool>(f), 1);
+}
+
+TEST(combiner_lowering, select_and_scatter)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1, 1, 4, 5});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{1, 1, 2, 2});
+    auto init = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(make_shared<op::SelectAndScatter>(A,
+                                                                     B,
+                                                                     init,
+                                                                     make_combiner<op::Greater>(),
+                                                                     make_combiner<op::Add>(),
+                                                                     Shape{1, 1, 2, 3},
+                                                                     Strides{1, 1, 2, 2}),
+                                   op::ParameterVector{A, B, init});
+
+    check_lowering(f,
+                   {{7, 2, 5, 3, 8, 3, 8, 9, 3, 4, 1, 5, 7, 5, 6, 0, 6, 2, 10, 2},
+                    {2, 6, 3, 1},
+                    {0.5f}});
+    EXPECT_EQ(count_ops_of_type<op::SelectAndScatter>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::MaxPoolBackprop>(f), 1);
+}
+
+TEST(combiner_lowering, unrecognised_combiner)
+{
+    // a-b is not associative, so the Reduce must be left alone
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto init = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(
+        make_shared<op::Reduce>(A, init, make_combiner<op::Subtract>(), AxisSet{0}),
+        op::ParameterVector{A, init});
+
+    check_lowering(f, {{1, 2, 3, 4}, {10}});
+    EXPECT_EQ(count_ops_of_type<op::Reduce>(f), 1);
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/constant_store.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(constant_store, intern)
+{
+    auto& store = runtime::ConstantStore::get();
+    auto before = store.get_report();
+
+    vector<float> weights(1000);
+    iota(weights.begin(), weights.end(), 0.0f);
+    vector<float> copy = weights;
+    vector<float> other = weights;
+    other.back() = -1.0f;
+    size_t size = weights.size() * sizeof(float);
+
+    {
+        auto a = store.intern(weights.data(), size);
+        auto b = store.intern(copy.data(), size);
+        auto c = store.intern(other.data(), size);
+        EXPECT_EQ(a, b);
+        EXPECT_NE(a, c);
+        EXPECT_NE(weights.data(), a.get());
+        EXPECT_EQ(0, memcmp(a.get(), weights.data(), size));
+        EXPECT_EQ(0, reinterpret_cast<size_t>(a.get()) % 64);
+
+        // A copied handle, like the one a compiled Function keeps of its Constant's data, is
+        // not another reference
+        auto a_copy = a;
+        auto report = store.get_report();
+        EXPECT_EQ(before.buffers + 2, report.buffers);
+        EXPECT_EQ(before.bytes + 2 * size, report.bytes);
+        EXPECT_EQ(before.references + 3, report.references);
+        EXPECT_EQ(before.referenced_bytes + 3 * size, report.referenced_bytes);
+
+        // A prefix of the same bytes is a different buffer
+        EXPECT_NE(a, store.intern(weights.data(), size - sizeof(float)));
+    }
+
+    // Buffers leave the store with their last handle
+    auto after = store.get_report();
+    EXPECT_EQ(before.buffers, after.buffers);
+    EXPECT_EQ(before.bytes, after.bytes);
+}
+
+TEST(constant_store, constants_share_data)
+{
+    Shape shape{4, 4};
+    vector<float> weights(shape_size(shape));
+    iota(weights.begin(), weights.end(), 1.0f);
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto W = op::Constant::create(element::f32, shape, weights);
+        return make_shared<Function>(A * W, op::ParameterVector{A});
+    };
+    auto f = make_function();
+    auto g = make_function();
+    auto weights_of = [](const shared_ptr<Function>& function) {
+        auto product = function->get_results()[0]->get_argument(0);
+        return static_pointer_cast<op::Constant>(product->get_argument(1));
+    };
+    auto f_weights = weights_of(f);
+    auto g_weights = weights_of(g);
+    EXPECT_NE(f_weights->get_data_ptr(), g_weights->get_data_ptr());
+
+    auto shared = f_weights->share_data();
+    EXPECT_EQ(shared.get(), f_weights->get_data_ptr());
+    EXPECT_EQ(shared, g_weights->share_data());
+    EXPECT_EQ(f_weights->get_data_ptr(), g_weights->get_data_ptr());
+    EXPECT_EQ(weights, g_weights->get_vector<float>());
+
+    // The buffer outlives both Constants while a handle is held
+    f = nullptr;
+    g = nullptr;
+    f_weights = nullptr;
+    g_weights = nullptr;
+    EXPECT_EQ(0, memcmp(shared.get(), weights.data(), weights.size() * sizeof(float)));
+
+    auto empty = make_shared<op::Constant>(element::f32, Shape{0}, vector<float>{});
+    EXPECT_EQ(nullptr, empty->share_data());
+}
+
+TEST(constant_store, concurrent_share_data)
+{
+    vector<float> weights(1000);
+    iota(weights.begin(), weights.end(), 0.0f);
+    auto W = op::Constant::create(element::f32, Shape{weights.size()}, weights);
+    size_t size = weights.size() * sizeof(float);
+
+    // Backends compiling Functions that hold the same Constant, while handles to an equal
+    // buffer come and go
+    vector<shared_ptr<const void>> shared(8);
+    vector<thread> threads;
+    for (size_t i = 0; i < shared.size(); i++)
+    {
+        threads.emplace_back([&, i]() {
+            for (size_t j = 0; j < 100; j++)
+            {
+                runtime::ConstantStore::get().intern(weights.data(), size);
+            }
+            shared[i] = W->share_data();
+        });
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    for (auto& buffer : shared)
+    {
+        EXPECT_EQ(shared[0], buffer);
+    }
+    EXPECT_EQ(shared[0].get(), W->get_data_ptr());
+    EXPECT_EQ(weights, W->get_vector<float>());
+}
@@ -46,6 +46,7 @@
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
@@ -53,13 +54,17 @@
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/grouped_dot.hpp"
+#include "ngraph/runtime/cpu/op/layer_norm.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_attention_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_layer_norm_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
@@ -1563,6 +1568,93 @@ TEST(cpu_fusion, batch_norm_folding)
     EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
 }
 
+TEST(cpu_fusion, batch_norm_folding_dot_bias)
+{
+    Shape shape_input{3, 4};
+    Shape shape_weights{4, 2};
+    Shape shape_norm{2};
+
+    auto make_function = [shape_input, shape_weights, shape_norm]() {
+        auto input = std::make_shared<op::Parameter>(element::f32, shape_input);
+        auto weights = op::Constant::create(
+            element::f32, shape_weights, {0.5f, -1.0f, 2.0f, 0.25f, -1.5f, 1.0f, 0.75f, -0.5f});
+        auto bias = op::Constant::create(element::f32, shape_norm, {0.1f, -0.2f});
+        auto gamma = op::Constant::create(element::f32, shape_norm, {-0.9384f, 0.01875f});
+        auto beta = op::Constant::create(element::f32, shape_norm, {11.0f, 1.3f});
+        auto mean = op::Constant::create(element::f32, shape_norm, {0.12f, 0.31f});
+        auto var = op::Constant::create(element::f32, shape_norm, {0.01f, 0.11f});
+        auto dot = std::make_shared<op::Dot>(input, weights);
+        auto dot_bias =
+            dot + std::make_shared<op::Broadcast>(bias, dot->get_shape(), AxisSet{0});
+        auto bn = std::make_shared<op::BatchNorm>(0.001, gamma, beta, dot_bias, mean, var);
+        return make_shared<Function>(NodeVector{bn}, op::ParameterVector{input});
+    };
+
+    // The constant weights and statistics are folded into new constants
+    auto folded_f = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(folded_f);
+    ASSERT_EQ(count_ops_of_type<op::BatchNorm>(folded_f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(folded_f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(folded_f), 1);
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    vector<vector<float>> args{
+        {1.25f, 2.25f, -5.25f, 6.25f, -1.25f, 0.5f, 3.25f, -4.25f, 7.25f, 8.25f, -1.25f, 0.f}};
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+    ASSERT_EQ(count_ops_of_type<op::MatmulBias>(cpu_f), 1);
+}
+
+TEST(cpu_fusion, layer_norm_fusion)
+{
+    Shape shape{4, 3, 10};
+    Shape norm_shape{3, 10};
+    auto make_function = [shape, norm_shape]() {
+        auto x = std::make_shared<op::Parameter>(element::f32, shape);
+        auto gamma = std::make_shared<op::Parameter>(element::f32, norm_shape);
+        auto beta = std::make_shared<op::Parameter>(element::f32, norm_shape);
+        auto count = op::Constant::create(element::f32, Shape{4}, {30, 30, 30, 30});
+        AxisSet norm_axes{1, 2};
+
+        auto mean = std::make_shared<op::Sum>(x, norm_axes) / count;
+        auto centered = x - std::make_shared<op::Broadcast>(mean, shape, norm_axes);
+        auto var = std::make_shared<op::Sum>(centered * centered, norm_axes) / count;
+        auto eps = std::make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{}, {1e-5f}), Shape{4}, AxisSet{0});
+        auto rstd = op::Constant::create(element::f32, Shape{4}, {1, 1, 1, 1}) /
+                    std::make_shared<op::Sqrt>(var + eps);
+        auto norm = std::make_shared<op::Broadcast>(rstd, shape, norm_axes) * centered;
+        auto output = std::make_shared<op::Broadcast>(beta, shape, AxisSet{0}) +
+                      norm * std::make_shared<op::Broadcast>(gamma, shape, AxisSet{0});
+        return make_shared<Function>(NodeVector{output}, op::ParameterVector{x, gamma, beta});
+    };
+
+    auto fused_f = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULayerNormFusion>();
+    pass_manager.run_passes(fused_f);
+    ASSERT_EQ(count_ops_of_type<op::LayerNorm>(fused_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(fused_f), 0);
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-4.0f, 4.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
 TEST(cpu_fusion, group_convolution_fusion)
 {
     Shape shape_a{1, 32, 2, 2};
@@ -2665,3 +2757,297 @@ TEST(cpu_fusion, dot_batch_forward)
         EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
     }
 }
+
+TEST(cpu_fusion, layout_propagation_through_elementwise)
+{
+    auto make_function = []() {
+        auto data = std::make_shared<op::Parameter>(element::f32, Shape{2, 16, 8, 8});
+        auto weights0 = std::make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+        auto weights1 = std::make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+        auto conv0 = std::make_shared<op::Convolution>(data, weights0);
+        auto tanh = std::make_shared<op::Tanh>(conv0);
+        auto scaled = std::make_shared<op::Multiply>(tanh, tanh);
+        auto conv1 = std::make_shared<op::Convolution>(scaled, weights1);
+        return make_shared<Function>(NodeVector{conv1},
+                                     op::ParameterVector{data, weights0, weights1});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+
+    // The convolution result reaches the second convolution in whatever format it was produced
+    for (auto node : cpu_f->get_ordered_ops())
+    {
+        if (std::dynamic_pointer_cast<op::Tanh>(node) ||
+            std::dynamic_pointer_cast<op::Multiply>(node))
+        {
+            EXPECT_EQ(std::dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(
+                          node->get_argument(0)),
+                      nullptr);
+        }
+    }
+}
+
+TEST(cpu_fusion, constant_weights_reordered_at_compile_time)
+{
+    auto make_function = [](const vector<float>& weights_val) {
+        auto data = std::make_shared<op::Parameter>(element::f32, Shape{2, 16, 8, 8});
+        auto weights = op::Constant::create(element::f32, Shape{32, 16, 3, 3}, weights_val);
+        auto conv = std::make_shared<op::Convolution>(data, weights);
+        return make_shared<Function>(NodeVector{conv}, op::ParameterVector{data});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> weights_val(32 * 16 * 3 * 3);
+    rng.initialize(weights_val);
+    auto cpu_f = make_function(weights_val);
+    auto int_f = make_function(weights_val);
+
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+
+    for (auto node : cpu_f->get_ordered_ops())
+    {
+        if (std::dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node))
+        {
+            EXPECT_EQ(std::dynamic_pointer_cast<op::Constant>(node->get_argument(0)), nullptr);
+        }
+    }
+}
+
+TEST(cpu_fusion, attention_fusion)
+{
+    auto make_function = []() {
+        auto query = std::make_shared<op::Parameter>(element::f32, Shape{70, 16});
+        auto key = std::make_shared<op::Parameter>(element::f32, Shape{300, 16});
+        auto value = std::make_shared<op::Parameter>(element::f32, Shape{300, 8});
+        auto key_t = std::make_shared<op::Reshape>(key, AxisVector{1, 0}, Shape{16, 300});
+        auto scores = std::make_shared<op::Dot>(query, key_t);
+        auto scale = std::make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{}, {0.25f}), Shape{70, 300}, AxisSet{0, 1});
+        auto probs = std::make_shared<op::Softmax>(scores * scale, AxisSet{1});
+        auto attention = std::make_shared<op::Dot>(probs, value);
+        return make_shared<Function>(NodeVector{attention},
+                                     op::ParameterVector{query, key, value});
+    };
+
+    auto fused_f = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUAttentionFusion>();
+    pass_manager.run_passes(fused_f);
+    ASSERT_EQ(count_ops_of_type<op::Attention>(fused_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Softmax>(fused_f), 0);
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-4.0f, 4.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
+TEST(cpu_fusion, horizontal_dot_fusion)
+{
+    auto make_function = [](const vector<vector<float>>& weights_val) {
+        auto input = std::make_shared<op::Parameter>(element::f32, Shape{4, 16});
+        auto a = std::make_shared<op::Parameter>(element::f32, Shape{8, 6});
+        auto b = std::make_shared<op::Parameter>(element::f32, Shape{6, 3});
+        auto c = std::make_shared<op::Parameter>(element::f32, Shape{8, 6});
+        auto d = std::make_shared<op::Parameter>(element::f32, Shape{6, 3});
+        // Projections of one input, as for attention queries, keys and values
+        auto q = std::make_shared<op::Dot>(
+            input, op::Constant::create(element::f32, Shape{16, 8}, weights_val.at(0)));
+        auto k = std::make_shared<op::Dot>(
+            input, op::Constant::create(element::f32, Shape{16, 8}, weights_val.at(1)));
+        auto v = std::make_shared<op::Dot>(
+            input, op::Constant::create(element::f32, Shape{16, 4}, weights_val.at(2)));
+        // Independent products of the same shape
+        auto ab = std::make_shared<op::Dot>(a, b);
+        auto cd = std::make_shared<op::Dot>(c, d);
+        return make_shared<Function>(NodeVector{q + k, v, ab, cd},
+                                     op::ParameterVector{input, a, b, c, d});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> weights_val{
+        vector<float>(16 * 8), vector<float>(16 * 8), vector<float>(16 * 4)};
+    for (auto& val : weights_val)
+    {
+        rng.initialize(val);
+    }
+
+    auto fused_f = make_function(weights_val);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUHorizontalFusion>();
+    pass_manager.run_passes(fused_f);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(fused_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Slice>(fused_f), 3);
+    ASSERT_EQ(count_ops_of_type<op::GroupedDot>(fused_f), 1);
+
+    auto int_f = make_function(weights_val);
+    auto cpu_f = make_function(weights_val);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, horizontal_dot_fusion_dependent_dots)
+{
+    auto a = std::make_shared<op::Parameter>(element::f32, Shape{4, 4});
+    auto b = std::make_shared<op::Parameter>(element::f32, Shape{4, 4});
+    auto ab = std::make_shared<op::Dot>(a, b);
+    auto abb = std::make_shared<op::Dot>(ab, b);
+    auto f = make_shared<Function>(NodeVector{ab, abb}, op::ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUHorizontalFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::GroupedDot>(f), 0);
+}
+
+TEST(cpu_fusion, horizontal_dot_fusion_biased_projections)
+{
+    auto make_function = [](const vector<vector<float>>& weights_val,
+                            const vector<vector<float>>& bias_val) {
+        auto input = std::make_shared<op::Parameter>(element::f32, Shape{4, 16});
+        // Query, key and value projections of one input, each adding its own bias
+        NodeVector results;
+        for (size_t i = 0; i < weights_val.size(); i++)
+        {
+            size_t width = bias_val.at(i).size();
+            auto weights =
+                op::Constant::create(element::f32, Shape{16, width}, weights_val.at(i));
+            auto dot = std::make_shared<op::Dot>(input, weights);
+            auto bias = op::Constant::create(element::f32, Shape{width}, bias_val.at(i));
+            results.push_back(
+                dot + std::make_shared<op::Broadcast>(bias, dot->get_shape(), AxisSet{0}));
+        }
+        return make_shared<Function>(results, op::ParameterVector{input});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> weights_val{
+        vector<float>(16 * 8), vector<float>(16 * 8), vector<float>(16 * 4)};
+    vector<vector<float>> bias_val{vector<float>(8), vector<float>(8), vector<float>(4)};
+    for (auto& val : weights_val)
+    {
+        rng.initialize(val);
+    }
+    for (auto& val : bias_val)
+    {
+        rng.initialize(val);
+    }
+    vector<vector<float>> args{vector<float>(4 * 16)};
+    rng.initialize(args.at(0));
+
+    auto fused_f = make_function(weights_val, bias_val);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUHorizontalFusion>();
+    pass_manager.run_passes(fused_f);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(fused_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Add>(fused_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Slice>(fused_f), 3);
+
+    // The whole CPU pipeline turns the combined product and bias into a single MatmulBias
+    auto int_f = make_function(weights_val, bias_val);
+    auto cpu_f = make_function(weights_val, bias_val);
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    ASSERT_EQ(count_ops_of_type<op::MatmulBias>(cpu_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Slice>(cpu_f), 3);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, horizontal_dot_fusion_keeps_matmul_bias)
+{
+    auto make_function = [](const vector<vector<float>>& weights_val) {
+        auto input = std::make_shared<op::Parameter>(element::f32, Shape{4, 16});
+        NodeVector results;
+        for (size_t i = 0; i < weights_val.size(); i++)
+        {
+            auto weights = op::Constant::create(element::f32, Shape{16, 2}, weights_val.at(i));
+            auto dot = std::make_shared<op::Dot>(input, weights);
+            auto bias = op::Constant::create(element::f32, Shape{2}, {0.25f, -0.5f});
+            auto dot_bias =
+                dot + std::make_shared<op::Broadcast>(bias, dot->get_shape(), AxisSet{0});
+            if (i % 2 == 0)
+            {
+                results.push_back(dot_bias);
+            }
+            else
+            {
+                auto gamma = op::Constant::create(element::f32, Shape{2}, {-0.9384f, 0.01875f});
+                auto beta = op::Constant::create(element::f32, Shape{2}, {11.0f, 1.3f});
+                auto mean = op::Constant::create(element::f32, Shape{2}, {0.12f, 0.31f});
+                auto var = op::Constant::create(element::f32, Shape{2}, {0.01f, 0.11f});
+                results.push_back(
+                    std::make_shared<op::BatchNorm>(0.001, gamma, beta, dot_bias, mean, var));
+            }
+        }
+        return make_shared<Function>(results, op::ParameterVector{input});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> weights_val(4, vector<float>(16 * 2));
+    for (auto& val : weights_val)
+    {
+        rng.initialize(val);
+    }
+    vector<vector<float>> args{vector<float>(4 * 16)};
+    rng.initialize(args.at(0));
+
+    // The whole CPU pipeline: sibling projections with a bias share one MatmulBias, and those
+    // with a BatchNorm folded into their weights still end up as one MatmulBias each
+    auto int_f = make_function(weights_val);
+    auto cpu_f = make_function(weights_val);
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    ASSERT_EQ(count_ops_of_type<op::MatmulBias>(cpu_f), 3);
+    ASSERT_EQ(count_ops_of_type<op::BatchNorm>(cpu_f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Slice>(cpu_f), 2);
+    ASSERT_EQ(count_ops_of_type<op::GroupedDot>(cpu_f), 0);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
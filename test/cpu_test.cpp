@@ -15,7 +15,9 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <list>
 #include <memory>
@@ -31,7 +33,16 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/constant_store.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/cpu/cpu_threading.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/fast_math.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_reduced_precision.hpp"
+#include "ngraph/runtime/streaming_session.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -90,6 +101,502 @@ TEST(cpu_test, trivial_in_place_relu_fail)
               add->get_outputs().at(0).get_tensor().get_pool_offset());
 }
 
+// Distance in units in the last place between a float result and a double reference
+static double ulp_error(float actual, double expected)
+{
+    if (std::isnan(expected))
+    {
+        return std::isnan(actual) ? 0 : INFINITY;
+    }
+    if (std::isinf(expected) || expected == 0)
+    {
+        return actual == static_cast<float>(expected) ? 0 : INFINITY;
+    }
+    float rounded = static_cast<float>(expected);
+    if (std::isinf(rounded))
+    {
+        return actual == rounded ? 0 : INFINITY;
+    }
+    double ulp =
+        std::nextafter(std::fabs(rounded), INFINITY) - static_cast<double>(std::fabs(rounded));
+    if (ulp == 0)
+    {
+        ulp = std::ldexp(1.0, -149);
+    }
+    return std::fabs(actual - expected) / ulp;
+}
+
+TEST(cpu_test, fast_math_accuracy)
+{
+    namespace kernel = runtime::cpu::kernel;
+
+    // Walk the float bit patterns with a stride so every binade of both signs is covered
+    double exp_error = 0, log_error = 0, tanh_error = 0, sigmoid_error = 0;
+    for (uint64_t bits = 0; bits <= 0xffffffffu; bits += 4099)
+    {
+        uint32_t pattern = static_cast<uint32_t>(bits);
+        float x;
+        std::memcpy(&x, &pattern, sizeof(x));
+        double xd = x;
+        // Results that land in the denormal range are only accurate in absolute terms
+        if (xd > -87.0)
+        {
+            exp_error = std::max(exp_error, ulp_error(kernel::fast_expf(x), std::exp(xd)));
+            sigmoid_error = std::max(
+                sigmoid_error, ulp_error(kernel::fast_sigmoidf(x), 1.0 / (1.0 + std::exp(-xd))));
+        }
+        log_error = std::max(log_error, ulp_error(kernel::fast_logf(x), std::log(xd)));
+        tanh_error = std::max(tanh_error, ulp_error(kernel::fast_tanhf(x), std::tanh(xd)));
+    }
+    EXPECT_LE(exp_error, 2);
+    EXPECT_LE(log_error, 1);
+    EXPECT_LE(tanh_error, 2);
+    EXPECT_LE(sigmoid_error, 3);
+
+    EXPECT_EQ(kernel::fast_expf(-200.0f), 0.0f);
+    EXPECT_TRUE(std::isinf(kernel::fast_expf(200.0f)));
+    EXPECT_TRUE(std::isinf(kernel::fast_logf(0.0f)));
+    EXPECT_TRUE(std::isnan(kernel::fast_logf(-1.0f)));
+    EXPECT_EQ(kernel::fast_tanhf(-50.0f), -1.0f);
+    EXPECT_EQ(kernel::fast_sigmoidf(50.0f), 1.0f);
+}
+
+TEST(cpu_test, fast_math_function)
+{
+    Shape shape{4, 37};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto exp = make_shared<op::Exp>(A);
+        auto log = make_shared<op::Log>(B);
+        auto tanh = make_shared<op::Tanh>(A);
+        auto sigmoid = make_shared<op::Sigmoid>(A);
+        return make_shared<Function>(NodeVector{exp, log, tanh, sigmoid + tanh},
+                                     op::ParameterVector{A, B});
+    };
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng_a(-10.0f, 10.0f);
+    test::Uniform<float> rng_b(0.001f, 100.0f);
+    vector<vector<float>> args{vector<float>(shape_size(shape)), vector<float>(shape_size(shape))};
+    rng_a.initialize(args[0]);
+    rng_b.initialize(args[1]);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    cpu_backend->enable_fast_math(cpu_f, true);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(a, args[0]);
+    copy_data(b, args[1]);
+    vector<shared_ptr<runtime::TensorView>> cpu_results;
+    for (size_t i = 0; i < cpu_f->get_output_size(); i++)
+    {
+        cpu_results.push_back(backend->create_tensor(element::f32, shape));
+    }
+    backend->call(cpu_f, cpu_results, {a, b});
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(
+            read_vector<float>(cpu_results.at(i)), int_results.at(i), 1.0e-5f, 1.0e-6f));
+    }
+    EXPECT_THROW(cpu_backend->enable_fast_math(cpu_f, false), std::runtime_error);
+}
+
+TEST(cpu_test, convolution_without_mkldnn)
+{
+    // 1D, f64 and data-dilated convolutions all miss the mkldnn path. Check the forward op and
+    // both backprops against the INTERPRETER.
+    auto make_function = [](const element::Type& type,
+                            const Shape& data_shape,
+                            const Shape& filters_shape,
+                            const Strides& movement,
+                            const Strides& dilation,
+                            const CoordinateDiff& padding_below,
+                            const CoordinateDiff& padding_above,
+                            const Strides& data_dilation) {
+        auto data = make_shared<op::Parameter>(type, data_shape);
+        auto filters = make_shared<op::Parameter>(type, filters_shape);
+        auto conv = make_shared<op::Convolution>(
+            data, filters, movement, dilation, padding_below, padding_above, data_dilation);
+        auto delta = make_shared<op::Parameter>(type, conv->get_shape());
+        auto bprop_data = make_shared<op::ConvolutionBackpropData>(data_shape,
+                                                                   filters,
+                                                                   delta,
+                                                                   movement,
+                                                                   dilation,
+                                                                   padding_below,
+                                                                   padding_above,
+                                                                   data_dilation);
+        auto bprop_filters = make_shared<op::ConvolutionBackpropFilters>(data,
+                                                                         filters_shape,
+                                                                         delta,
+                                                                         movement,
+                                                                         dilation,
+                                                                         padding_below,
+                                                                         padding_above,
+                                                                         data_dilation);
+        return make_shared<Function>(NodeVector{conv, bprop_data, bprop_filters},
+                                     op::ParameterVector{data, filters, delta});
+    };
+
+    auto compare = [](const shared_ptr<Function>& cpu_f) {
+        auto int_f = clone_function(*cpu_f);
+        test::Uniform<double> rng(-1.0, 1.0);
+        vector<vector<double>> args;
+        for (auto& param : cpu_f->get_parameters())
+        {
+            vector<double> arg(shape_size(param->get_shape()));
+            rng.initialize(arg);
+            args.push_back(arg);
+        }
+        auto cpu_results = execute(cpu_f, args, "CPU");
+        auto int_results = execute(int_f, args, "INTERPRETER");
+        for (size_t i = 0; i < cpu_results.size(); i++)
+        {
+            EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-9, 1.0e-9));
+        }
+    };
+
+    compare(make_function(element::f64,
+                          Shape{2, 3, 40},
+                          Shape{4, 3, 5},
+                          Strides{2},
+                          Strides{2},
+                          CoordinateDiff{3},
+                          CoordinateDiff{1},
+                          Strides{1}));
+    compare(make_function(element::f64,
+                          Shape{2, 3, 7, 6},
+                          Shape{5, 3, 3, 2},
+                          Strides{1, 2},
+                          Strides{1, 1},
+                          CoordinateDiff{1, 0},
+                          CoordinateDiff{-1, 2},
+                          Strides{3, 2}));
+}
+
+TEST(cpu_test, threading_config)
+{
+    Shape shape{64, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B) + A, op::ParameterVector{A, B});
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    auto original = cpu_backend->get_threading_config();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args{vector<float>(shape_size(shape)), vector<float>(shape_size(shape))};
+    rng.initialize(args[0]);
+    rng.initialize(args[1]);
+    auto expected = execute(f, args, "INTERPRETER");
+
+    runtime::cpu::ThreadingConfig config;
+    config.num_threads = 2;
+    config.cpu_affinity = {0};
+    cpu_backend->set_threading_config(config);
+    EXPECT_EQ(2, cpu_backend->get_threading_config().num_threads);
+    EXPECT_EQ(2, runtime::cpu::eigen::global_thread_pool_device.numThreads());
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, args[0]);
+    copy_data(b, args[1]);
+    backend->call(f, {result}, {a, b});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), expected[0], 1.0e-4f, 1.0e-5f));
+
+    config.cpu_affinity.clear();
+    config.numa_node = 1 << 20;
+    EXPECT_THROW(cpu_backend->set_threading_config(config), ngraph_error);
+
+    cpu_backend->set_threading_config(original);
+    EXPECT_EQ(original.num_threads, cpu_backend->get_threading_config().num_threads);
+}
+
+TEST(cpu_test, numa_placement)
+{
+    // Two nodes, whatever the host has
+    runtime::cpu::simulate_numa_nodes(2);
+    ASSERT_EQ(2, runtime::cpu::get_numa_node_count());
+    EXPECT_FALSE(runtime::cpu::get_numa_node_cpus(1).empty());
+
+    Shape shape{16, 16};
+    vector<float> weights(shape_size(shape));
+    iota(weights.begin(), weights.end(), 0.0f);
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto W = op::Constant::create(element::f32, shape, weights);
+        return make_shared<Function>(make_shared<op::Dot>(A, W) + W, op::ParameterVector{A});
+    };
+    auto f = make_function();
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args{vector<float>(shape_size(shape))};
+    rng.initialize(args[0]);
+    auto expected = execute(make_function(), args, "INTERPRETER");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, args[0]);
+    runtime::cpu::NumaPlacement placement;
+    placement.node = 1;
+    cpu_backend->set_numa_placement(f, placement);
+    backend->call(f, {result}, {a});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), expected[0], 1.0e-4f, 1.0e-5f));
+
+    // Kernels started during a call bound to a node run on a pool pinned to that node, and
+    // are partitioned for its size
+    {
+        int node_threads = static_cast<int>(min(runtime::cpu::get_threading_config().num_threads,
+                                                runtime::cpu::get_numa_node_cpus(1).size()));
+        runtime::cpu::NumaNodeBinding binding(1);
+        auto& device = runtime::cpu::eigen::get_thread_pool_device();
+        EXPECT_NE(&runtime::cpu::eigen::global_thread_pool_device, &device);
+        EXPECT_EQ(node_threads, device.numThreadsInPool());
+        EXPECT_EQ(node_threads, device.numThreads());
+    }
+    EXPECT_EQ(&runtime::cpu::eigen::global_thread_pool_device,
+              &runtime::cpu::eigen::get_thread_pool_device());
+
+    // Moving a compiled function rebuilds its call frame on the other node
+    placement.node = 0;
+    cpu_backend->set_numa_placement(f, placement);
+    backend->call(f, {result}, {a});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), expected[0], 1.0e-4f, 1.0e-5f));
+
+    auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(make_function());
+    auto frame = external_function->make_call_frame(placement);
+    auto shared = external_function->get_constant_replica(0, true);
+    EXPECT_EQ(shared, external_function->get_constant_replica(0, true));
+    EXPECT_NE(shared, external_function->get_constant_replica(0, false));
+    ASSERT_EQ(1, shared->get_constant_ptrs().size());
+    EXPECT_NE(external_function->get_constant_ptrs()[0], shared->get_constant_ptrs()[0]);
+    EXPECT_EQ(0, memcmp(shared->get_constant_ptrs()[0], weights.data(), weights.size() * 4));
+
+    placement.node = 2;
+    EXPECT_THROW(cpu_backend->set_numa_placement(f, placement), ngraph_error);
+    runtime::cpu::simulate_numa_nodes(0);
+}
+
+TEST(cpu_test, huge_page_policy)
+{
+    using HugePages = runtime::cpu::PagePolicy::HugePages;
+    runtime::cpu::PagePolicy pages;
+    pages.huge_pages = HugePages::Explicit;
+    pages.prefault = true;
+    // Falls back to transparent huge pages, or to normal ones, when the system has none
+    runtime::cpu::NumaBuffer buffer(4 << 20, -1, pages);
+    ASSERT_NE(nullptr, buffer.get_ptr());
+    EXPECT_EQ(0, reinterpret_cast<size_t>(buffer.get_ptr()) % 4096);
+    pages.huge_page_threshold = 8 << 20;
+    EXPECT_EQ(HugePages::None, runtime::cpu::NumaBuffer(4 << 20, -1, pages).get_huge_pages());
+
+    Shape shape{64, 64};
+    vector<float> weights(shape_size(shape));
+    iota(weights.begin(), weights.end(), 0.0f);
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto W = op::Constant::create(element::f32, shape, weights);
+        return make_shared<Function>((A + W) * A, op::ParameterVector{A});
+    };
+    auto f = make_function();
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args{vector<float>(shape_size(shape))};
+    rng.initialize(args[0]);
+    auto expected = execute(make_function(), args, "INTERPRETER");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, args[0]);
+    pages.huge_pages = HugePages::Transparent;
+    pages.huge_page_threshold = 0;
+    cpu_backend->set_page_policy(f, pages);
+    backend->call(f, {result}, {a});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), expected[0], 1.0e-4f, 1.0e-5f));
+
+    // Rebuilding the frame of a compiled function under another policy keeps it working
+    cpu_backend->set_page_policy(f, runtime::cpu::PagePolicy());
+    backend->call(f, {result}, {a});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), expected[0], 1.0e-4f, 1.0e-5f));
+}
+
+TEST(cpu_test, constants_shared_across_functions)
+{
+    Shape shape{32, 32};
+    vector<float> weights(shape_size(shape));
+    iota(weights.begin(), weights.end(), 0.0f);
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto W = op::Constant::create(element::f32, shape, weights);
+        return make_shared<Function>(make_shared<op::Dot>(A, W), op::ParameterVector{A});
+    };
+    auto& store = runtime::ConstantStore::get();
+    auto before = store.get_report();
+
+    // Two variants of one model on two backends pay for the weights once
+    auto f = make_function();
+    auto g = make_function();
+    auto f_backend = runtime::Backend::create("CPU");
+    auto g_backend = runtime::Backend::create("CPU");
+    f_backend->compile(f);
+    g_backend->compile(g);
+    auto report = store.get_report();
+    EXPECT_EQ(before.bytes + weights.size() * sizeof(float), report.bytes);
+    EXPECT_EQ(before.references + 2, report.references);
+    EXPECT_EQ(before.referenced_bytes + 2 * weights.size() * sizeof(float),
+              report.referenced_bytes);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args{vector<float>(shape_size(shape))};
+    rng.initialize(args[0]);
+    auto expected = execute(make_function(), args, "INTERPRETER");
+    auto a = g_backend->create_tensor(element::f32, shape);
+    auto result = g_backend->create_tensor(element::f32, shape);
+    copy_data(a, args[0]);
+    f_backend->remove_compiled_function(f);
+    f = nullptr;
+    g_backend->call(g, {result}, {a});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), expected[0], 1.0e-4f, 1.0e-5f));
+}
+
+TEST(cpu_test, streaming_session)
+{
+    // A cell with a hidden state h that goes through Dots and a cell state c that is updated
+    // elementwise, so it can stay in place
+    auto make_function = []() {
+        Shape state_shape{1, 4};
+        auto X = make_shared<op::Parameter>(element::f32, Shape{1, 3});
+        auto H = make_shared<op::Parameter>(element::f32, state_shape);
+        auto C = make_shared<op::Parameter>(element::f32, state_shape);
+        vector<float> w(12);
+        vector<float> u(16);
+        iota(w.begin(), w.end(), -6.0f);
+        iota(u.begin(), u.end(), -8.0f);
+        auto W = op::Constant::create(element::f32, Shape{3, 4}, w);
+        auto U = op::Constant::create(element::f32, Shape{4, 4}, u);
+        auto half = op::Constant::create(element::f32, state_shape, {0.5, 0.5, 0.5, 0.5});
+        auto G = make_shared<op::Tanh>(make_shared<op::Dot>(X, W) + make_shared<op::Dot>(H, U));
+        auto C_next = C * half + G;
+        auto H_next = make_shared<op::Tanh>(C_next);
+        return make_shared<Function>(NodeVector{H_next, H_next, C_next},
+                                     op::ParameterVector{X, H, C});
+    };
+    vector<runtime::StreamingSession::State> states{{1, 1}, {2, 2, true}};
+
+    auto cpu = runtime::Backend::create("CPU");
+    auto interpreter = runtime::Backend::create("INTERPRETER");
+    runtime::StreamingSession cpu_session(cpu, make_function(), states);
+    runtime::StreamingSession int_session(interpreter, make_function(), states);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> step(3);
+    auto cpu_x = cpu->create_tensor(element::f32, Shape{1, 3});
+    auto cpu_y = cpu->create_tensor(element::f32, Shape{1, 4});
+    auto int_x = interpreter->create_tensor(element::f32, Shape{1, 3});
+    auto int_y = interpreter->create_tensor(element::f32, Shape{1, 4});
+    for (size_t i = 0; i < 8; i++)
+    {
+        rng.initialize(step);
+        copy_data(cpu_x, step);
+        copy_data(int_x, step);
+        cpu_session.call({cpu_y}, {cpu_x});
+        int_session.call({int_y}, {int_x});
+        EXPECT_TRUE(test::all_close(read_vector<float>(int_y), read_vector<float>(cpu_y)));
+        EXPECT_TRUE(test::all_close(read_vector<float>(int_session.get_state(1)),
+                                    read_vector<float>(cpu_session.get_state(1))));
+    }
+}
+
+TEST(cpu_test, memory_usage)
+{
+    Shape shape{32, 32};
+    size_t tensor_size = shape_size(shape) * sizeof(float);
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto W = op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 0.5f));
+    auto f = make_shared<Function>(make_shared<op::Tanh>(make_shared<op::Dot>(A, W)) + B,
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    EXPECT_EQ(0, backend->get_memory_usage(f).total());
+    backend->compile(f);
+    runtime::MemoryUsage usage = backend->get_memory_usage(f);
+    EXPECT_EQ(tensor_size, usage.constants);
+    EXPECT_GE(usage.temporaries, tensor_size);
+    EXPECT_GT(usage.call_frames, 0);
+    if (!getenv("NGRAPH_DEX"))
+    {
+        EXPECT_GT(usage.code, 0);
+    }
+    EXPECT_EQ(usage.temporaries + usage.workspaces + usage.constants + usage.code +
+                  usage.call_frames,
+              usage.total());
+
+    // A NUMA replica of the constants is counted with them
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    runtime::cpu::NumaPlacement placement;
+    placement.node = 0;
+    cpu_backend->set_numa_placement(f, placement);
+    EXPECT_LE(2 * tensor_size, backend->get_memory_usage(f).constants);
+
+    backend->remove_compiled_function(f);
+    EXPECT_EQ(0, backend->get_memory_usage(f).total());
+}
+
+TEST(cpu_test, reduced_precision_widening_kernels)
+{
+    Shape shape_a{2, 4};
+    Shape shape_w{4, 3};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::bf16, shape_a);
+        auto W = make_shared<op::Parameter>(element::bf16, shape_w);
+        auto relu = make_shared<op::Relu>(make_shared<op::Dot>(A, W));
+        auto sum = make_shared<op::Sum>(relu, AxisSet{1});
+        return make_shared<Function>(NodeVector{relu, sum}, op::ParameterVector{A, W});
+    };
+
+    // Dot and Relu read bf16 directly. Only Sum, which has no widening kernel, is computed
+    // in f32 between a widening and a narrowing Convert.
+    auto f = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUReducedPrecision>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::Convert>(f), 2);
+    for (auto node : f->get_ordered_ops())
+    {
+        if (dynamic_pointer_cast<op::Dot>(node) || dynamic_pointer_cast<op::Relu>(node))
+        {
+            EXPECT_EQ(node->get_element_type(), element::bf16);
+        }
+    }
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::bf16, shape_a);
+    copy_data(a, vector<bfloat16>{1, 2, 3, 4, 5, 6, 7, 8});
+    auto w = backend->create_tensor(element::bf16, shape_w);
+    copy_data(w, vector<bfloat16>{1, 0, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1});
+    auto relu_result = backend->create_tensor(element::bf16, Shape{2, 3});
+    auto sum_result = backend->create_tensor(element::bf16, Shape{2});
+
+    backend->call(make_function(), {relu_result, sum_result}, {a, w});
+    auto relu_values = read_vector<bfloat16>(relu_result);
+    auto sum_values = read_vector<bfloat16>(sum_result);
+    EXPECT_EQ((vector<float>{10, 0, 0, 26, 0, 0}),
+              (vector<float>{begin(relu_values), end(relu_values)}));
+    EXPECT_EQ((vector<float>{10, 26}), (vector<float>{begin(sum_values), end(sum_values)}));
+}
+
 #ifdef NGRAPH_TBB_ENABLE
 TEST(cpu_test, abc_tbb)
 {
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <fstream>
+#include <numeric>
 #include <sstream>
 
 #include <mpi.h>
@@ -23,6 +24,8 @@
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_fusion.hpp"
+#include "ngraph/pass/manager.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/random.hpp"
 
@@ -53,3 +56,142 @@ TEST(distributed_${BACKEND_NAME}, allreduce)
     backend->call(f, {result}, {a});
     EXPECT_EQ(v, read_vector<float>(result));
 }
+
+TEST(distributed_${BACKEND_NAME}, allreduce_fusion)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{4, 4});
+    auto D = make_shared<op::Parameter>(element::f64, Shape{2});
+    // The reduced B feeds a computation whose result is reduced again, so the second
+    // reduction cannot share a bucket with the first
+    auto reduce_b = make_shared<op::AllReduce>(B);
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::AllReduce>(A),
+                   reduce_b,
+                   make_shared<op::AllReduce>(C),
+                   make_shared<op::AllReduce>(reduce_b * B),
+                   make_shared<op::AllReduce>(D)},
+        op::ParameterVector{A, B, C, D});
+
+    // Everything of the same element type shares a bucket except the reduction of
+    // reduce_b * B, which depends on a member of the bucket holding reduce_b
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceFusion>();
+    pass_manager.run_passes(f);
+    size_t allreduce_count = count_ops_of_type<op::AllReduce>(f);
+    EXPECT_EQ(3, allreduce_count);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    int comm_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    float n = static_cast<float>(comm_size);
+
+    auto a = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, Shape{3});
+    copy_data(b, vector<float>{5, 6, 7});
+    auto c = backend->create_tensor(element::f32, Shape{4, 4});
+    vector<float> c_data(16);
+    iota(c_data.begin(), c_data.end(), 1.0f);
+    copy_data(c, c_data);
+    auto d = backend->create_tensor(element::f64, Shape{2});
+    copy_data(d, vector<double>{0.5, 1.5});
+
+    auto result_a = backend->create_tensor(element::f32, Shape{2, 2});
+    auto result_b = backend->create_tensor(element::f32, Shape{3});
+    auto result_c = backend->create_tensor(element::f32, Shape{4, 4});
+    auto result_bb = backend->create_tensor(element::f32, Shape{3});
+    auto result_d = backend->create_tensor(element::f64, Shape{2});
+
+    backend->call(f, {result_a, result_b, result_c, result_bb, result_d}, {a, b, c, d});
+
+    EXPECT_EQ((vector<float>{n, 2 * n, 3 * n, 4 * n}), read_vector<float>(result_a));
+    EXPECT_EQ((vector<float>{5 * n, 6 * n, 7 * n}), read_vector<float>(result_b));
+    vector<float> expected_c(c_data);
+    for (float& x : expected_c)
+    {
+        x *= n;
+    }
+    EXPECT_EQ(expected_c, read_vector<float>(result_c));
+    EXPECT_EQ((vector<float>{25 * n * n, 36 * n * n, 49 * n * n}),
+              read_vector<float>(result_bb));
+    EXPECT_EQ((vector<double>{0.5 * n, 1.5 * n}), read_vector<double>(result_d));
+}
+
+TEST(distributed_${BACKEND_NAME}, allreduce_fusion_interleaved_types)
+{
+    auto P = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto Q = make_shared<op::Parameter>(element::f64, Shape{2});
+    auto R = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto S = make_shared<op::Parameter>(element::f64, Shape{2});
+    auto reduce_p = make_shared<op::AllReduce>(P);
+    auto reduce_q = make_shared<op::AllReduce>(Q);
+    // Each of these feeds from the other element type's first reduction. Fusing both pairs
+    // would make the two fused reductions wait on each other.
+    auto reduce_r =
+        make_shared<op::AllReduce>(R + make_shared<op::Convert>(reduce_q, element::f32));
+    auto reduce_s =
+        make_shared<op::AllReduce>(S + make_shared<op::Convert>(reduce_p, element::f64));
+    auto f = make_shared<Function>(NodeVector{reduce_p, reduce_q, reduce_r, reduce_s},
+                                   op::ParameterVector{P, Q, R, S});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceFusion>();
+    pass_manager.run_passes(f);
+
+    // Whichever of reduce_r and reduce_s comes first closes the bucket it reads from, so only
+    // one pair fuses and the graph stays acyclic
+    EXPECT_EQ(3, count_ops_of_type<op::AllReduce>(f));
+    size_t node_count = 0;
+    traverse_nodes(f, [&node_count](shared_ptr<Node>) { node_count++; });
+    EXPECT_EQ(node_count, f->get_ordered_ops().size());
+}
+
+TEST(distributed_${BACKEND_NAME}, allreduce_fusion_bucket_size)
+{
+    Shape shape{2, 2};
+    NodeVector results;
+    op::ParameterVector params;
+    for (size_t i = 0; i < 4; i++)
+    {
+        auto P = make_shared<op::Parameter>(element::f32, shape);
+        params.push_back(P);
+        results.push_back(make_shared<op::AllReduce>(P));
+    }
+    auto f = make_shared<Function>(results, params);
+
+    // Each argument is 16 bytes so a 32 byte bucket holds two of them
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceFusion>(32);
+    pass_manager.run_passes(f);
+    size_t allreduce_count = count_ops_of_type<op::AllReduce>(f);
+    EXPECT_EQ(2, allreduce_count);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    int comm_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    float n = static_cast<float>(comm_size);
+
+    vector<shared_ptr<runtime::TensorView>> inputs;
+    vector<shared_ptr<runtime::TensorView>> outputs;
+    for (size_t i = 0; i < 4; i++)
+    {
+        auto input = backend->create_tensor(element::f32, shape);
+        float v = static_cast<float>(i);
+        copy_data(input, vector<float>{v, v + 1, v + 2, v + 3});
+        inputs.push_back(input);
+        outputs.push_back(backend->create_tensor(element::f32, shape));
+    }
+
+    backend->call(f, outputs, inputs);
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        float v = static_cast<float>(i);
+        EXPECT_EQ((vector<float>{v * n, (v + 1) * n, (v + 2) * n, (v + 3) * n}),
+                  read_vector<float>(outputs[i]));
+    }
+}
@@ -14,11 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
 #include <map>
 
 #include "gtest/gtest.h"
 
+#include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "ngraph/type/float16.hpp"
 
 using namespace ngraph;
 
@@ -26,6 +29,8 @@ TEST(element_type, from)
 {
     EXPECT_EQ(element::from<char>(), element::boolean);
     EXPECT_EQ(element::from<bool>(), element::boolean);
+    EXPECT_EQ(element::from<float16>(), element::f16);
+    EXPECT_EQ(element::from<bfloat16>(), element::bf16);
     EXPECT_EQ(element::from<float>(), element::f32);
     EXPECT_EQ(element::from<double>(), element::f64);
     EXPECT_EQ(element::from<int8_t>(), element::i8);
@@ -43,6 +48,10 @@ TEST(element_type, mapable)
     std::map<element::Type, std::string> test_map;
 
     test_map.insert({element::f32, "float"});
+    test_map.insert({element::f16, "float16"});
+    test_map.insert({element::bf16, "bfloat16"});
+    EXPECT_EQ(3, test_map.size());
+    EXPECT_EQ("bfloat16", test_map.at(element::bf16));
 }
 
 TEST(element_type, size)
@@ -84,3 +93,29 @@ TEST(element_type, size)
         EXPECT_EQ(2, t1.size());
     }
 }
+
+TEST(element_type, float16)
+{
+    EXPECT_EQ(2, element::f16.size());
+    EXPECT_EQ(0x3c00, float16(1.0f).to_bits());
+    EXPECT_EQ(0x7bff, float16(65504.0f).to_bits());
+    EXPECT_EQ(0x7c00, float16(65520.0f).to_bits());
+    EXPECT_EQ(0x0001, float16(5.9604644775390625e-8f).to_bits());
+    // 2049 is halfway between 2048 and 2050, ties go to the even mantissa
+    EXPECT_EQ(2048.0f, static_cast<float>(float16(2049.0f)));
+    EXPECT_EQ(2052.0f, static_cast<float>(float16(2051.0f)));
+    EXPECT_EQ(-0.5f, static_cast<float>(float16(-0.5f)));
+    EXPECT_TRUE(std::isnan(static_cast<float>(float16(NAN))));
+}
+
+TEST(element_type, bfloat16)
+{
+    EXPECT_EQ(2, element::bf16.size());
+    EXPECT_EQ(0x3f80, bfloat16(1.0f).to_bits());
+    // 257 is halfway between 256 and 258, ties go to the even mantissa
+    EXPECT_EQ(256.0f, static_cast<float>(bfloat16(257.0f)));
+    EXPECT_EQ(260.0f, static_cast<float>(bfloat16(259.0f)));
+    // bf16 keeps the f32 exponent range
+    EXPECT_FALSE(std::isinf(static_cast<float>(bfloat16(3.0e38f))));
+    EXPECT_TRUE(std::isnan(static_cast<float>(bfloat16(NAN))));
+}
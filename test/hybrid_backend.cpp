@@ -0,0 +1,203 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/hybrid_backend.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool is_compute(const shared_ptr<Node>& node)
+{
+    return !node->is_parameter() && !node->is_output() && !node->is_constant();
+}
+
+// Placement of every op in the partitions that does more than move data
+static map<string, Placement> get_op_placements(runtime::HybridBackend& backend,
+                                                shared_ptr<Function> f)
+{
+    map<string, Placement> placements;
+    for (auto& partition : backend.get_partitions(f))
+    {
+        for (auto node : partition.second->get_ordered_ops())
+        {
+            if (is_compute(node))
+            {
+                placements[node->description()] = partition.first;
+            }
+        }
+    }
+    return placements;
+}
+
+static size_t count_compute_partitions(runtime::HybridBackend& backend, shared_ptr<Function> f)
+{
+    size_t count = 0;
+    for (auto& partition : backend.get_partitions(f))
+    {
+        for (auto node : partition.second->get_ordered_ops())
+        {
+            if (is_compute(node))
+            {
+                count++;
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+TEST(hybrid_backend, cheapest_device)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B, C});
+
+    runtime::HybridBackend::Device interpreter(Placement::INTERPRETER);
+    interpreter.m_cost_scale = 10;
+    runtime::HybridBackend::Device cpu(Placement::CPU);
+    runtime::HybridBackend::TransferCost free_transfers(0, 0);
+    runtime::HybridBackend backend({interpreter, cpu}, free_transfers);
+
+    auto a = backend.create_tensor(element::f32, shape);
+    auto b = backend.create_tensor(element::f32, shape);
+    auto c = backend.create_tensor(element::f32, shape);
+    auto r = backend.create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    copy_data(c, vector<float>{9, 10, 11, 12});
+    backend.call(f, {r}, {a, b, c});
+    EXPECT_EQ((vector<float>{54, 80, 110, 144}), read_vector<float>(r));
+
+    auto placements = get_op_placements(backend, f);
+    EXPECT_EQ(Placement::CPU, placements.at("Add"));
+    EXPECT_EQ(Placement::CPU, placements.at("Multiply"));
+
+    // The boundary tensors stay in place between calls
+    size_t temporaries = backend.get_memory_usage(f).temporaries;
+    copy_data(c, vector<float>{1, 1, 1, 1});
+    backend.call(f, {r}, {a, b, c});
+    EXPECT_EQ((vector<float>{6, 8, 10, 12}), read_vector<float>(r));
+    EXPECT_EQ(temporaries, backend.get_memory_usage(f).temporaries);
+}
+
+TEST(hybrid_backend, unsupported_ops)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Negative>(A * B) + C,
+                                   op::ParameterVector{A, B, C});
+
+    runtime::HybridBackend::Device interpreter(Placement::INTERPRETER);
+    interpreter.m_cost_scale = 10;
+    runtime::HybridBackend::Device cpu(Placement::CPU);
+    cpu.m_supports = [](const Node& node) { return node.description() != "Negative"; };
+    runtime::HybridBackend::TransferCost free_transfers(0, 0);
+
+    // Boundaries either share host memory or are copied through a staging buffer
+    for (bool host_memory : {true, false})
+    {
+        cpu.m_host_memory = host_memory;
+        runtime::HybridBackend backend({interpreter, cpu}, free_transfers);
+
+        auto a = backend.create_tensor(element::f32, shape);
+        auto b = backend.create_tensor(element::f32, shape);
+        auto c = backend.create_tensor(element::f32, shape);
+        auto r = backend.create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>{5, 6, 7, 8});
+        copy_data(c, vector<float>{9, 10, 11, 12});
+        backend.call(f, {r}, {a, b, c});
+        EXPECT_EQ((vector<float>{4, -2, -10, -20}), read_vector<float>(r));
+
+        auto placements = get_op_placements(backend, f);
+        EXPECT_EQ(Placement::CPU, placements.at("Multiply"));
+        EXPECT_EQ(Placement::INTERPRETER, placements.at("Negative"));
+        EXPECT_EQ(Placement::CPU, placements.at("Add"));
+    }
+}
+
+TEST(hybrid_backend, coalesce_partitions)
+{
+    Shape shape{2, 2};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto C = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::Abs>(A * B) * C,
+                                     op::ParameterVector{A, B, C});
+    };
+
+    // Each device is cheaper for one kind of op
+    runtime::HybridBackend::Device interpreter(Placement::INTERPRETER);
+    interpreter.m_cost = [](const Node& node) { return node.description() == "Abs" ? 1 : 2; };
+    runtime::HybridBackend::Device cpu(Placement::CPU);
+    cpu.m_cost = [](const Node& node) { return node.description() == "Abs" ? 2 : 1; };
+
+    for (double per_crossing : {0.0, 100.0})
+    {
+        runtime::HybridBackend::TransferCost transfer_cost(0, per_crossing);
+        runtime::HybridBackend backend({interpreter, cpu}, transfer_cost);
+        auto f = make_function();
+
+        auto a = backend.create_tensor(element::f32, shape);
+        auto b = backend.create_tensor(element::f32, shape);
+        auto c = backend.create_tensor(element::f32, shape);
+        auto r = backend.create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, -2, 3, -4});
+        copy_data(b, vector<float>{5, 6, 7, 8});
+        copy_data(c, vector<float>{1, 2, 3, 4});
+        backend.call(f, {r}, {a, b, c});
+        EXPECT_EQ((vector<float>{5, 24, 63, 128}), read_vector<float>(r));
+
+        // With free crossings every op goes to its cheaper device; once crossings cost more
+        // than the ops save, the whole chain runs in one partition
+        EXPECT_EQ(per_crossing == 0 ? 3 : 1, count_compute_partitions(backend, f));
+    }
+}
+
+TEST(hybrid_backend, failed_compile)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, op::ParameterVector{A, B});
+
+    runtime::HybridBackend::Device interpreter(Placement::INTERPRETER);
+    interpreter.m_supports = [](const Node& node) { return node.description() != "Add"; };
+    runtime::HybridBackend::TransferCost free_transfers(0, 0);
+    runtime::HybridBackend backend({interpreter}, free_transfers);
+
+    auto a = backend.create_tensor(element::f32, shape);
+    auto b = backend.create_tensor(element::f32, shape);
+    auto r = backend.create_tensor(element::f32, shape);
+
+    // A Function that failed to compile is not taken for compiled on the next call
+    EXPECT_THROW(backend.call(f, {r}, {a, b}), ngraph_error);
+    EXPECT_THROW(backend.call(f, {r}, {a, b}), ngraph_error);
+}
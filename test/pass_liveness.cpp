@@ -48,23 +48,54 @@ TEST(liveness, constant)
     auto tmp = f->get_ordered_ops();
     vector<shared_ptr<Node>> sorted{tmp.begin(), tmp.end()};
     ASSERT_EQ(3, sorted.size());
-    EXPECT_EQ(0, sorted[0]->liveness_live_list.size());
+    EXPECT_EQ(0, pass::Liveness::get_live_tensors(tmp, sorted[0].get()).size());
     EXPECT_EQ(0, sorted[0]->liveness_new_list.size());
     EXPECT_EQ(0, sorted[0]->liveness_free_list.size());
 
     //op::Negative is live on output to op::Result
-    EXPECT_EQ(1, sorted[1]->liveness_live_list.size());
+    EXPECT_EQ(1, pass::Liveness::get_live_tensors(tmp, sorted[1].get()).size());
     //op::Negative is new
     EXPECT_EQ(1, sorted[1]->liveness_new_list.size());
     EXPECT_EQ(0, sorted[1]->liveness_free_list.size());
 
     //op::Negative is live on input to op::Result
-    EXPECT_EQ(1, sorted[2]->liveness_live_list.size());
+    EXPECT_EQ(1, pass::Liveness::get_live_tensors(tmp, sorted[2].get()).size());
     EXPECT_EQ(0, sorted[2]->liveness_new_list.size());
     //op::Negative is freed
     EXPECT_EQ(1, sorted[2]->liveness_free_list.size());
 }
 
+TEST(liveness, long_chain)
+{
+    // Each op in a chain frees the tensor of the op before it, so at most two temporaries, the
+    // input and the output of the current op, are live no matter how long the chain is
+    Shape shape{1};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> node = A;
+    for (size_t i = 0; i < 20000; i++)
+    {
+        node = make_shared<op::Negative>(node);
+    }
+    auto f = make_shared<Function>(node, op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(f);
+
+    auto ops = f->get_ordered_ops();
+    size_t live = 0;
+    size_t max_live = 0;
+    for (const shared_ptr<Node>& op : ops)
+    {
+        live += op->liveness_new_list.size();
+        max_live = max(max_live, live);
+        live -= op->liveness_free_list.size();
+    }
+    EXPECT_EQ(0, live);
+    EXPECT_EQ(2, max_live);
+    EXPECT_EQ(2, pass::Liveness::get_live_tensors(ops, node.get()).size());
+}
+
 TEST(liveness, liveness)
 {
     string image = "liveness.png";
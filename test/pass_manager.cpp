@@ -15,15 +15,22 @@
 *******************************************************************************/
 
 #include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/cse.hpp"
+#include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "nlohmann/json.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -59,3 +66,149 @@ TEST(pass_manager, module_add_function)
                                        make_shared<op::FunctionCall>(f, NodeVector{X, Y, Z}),
                                    op::ParameterVector{X, Y, Z});
 }
+
+namespace
+{
+    class RecordFunctions : public pass::FunctionPass
+    {
+    public:
+        RecordFunctions(set<shared_ptr<Function>>& functions,
+                        set<thread::id>& threads,
+                        mutex& m)
+            : m_functions(functions)
+            , m_threads(threads)
+            , m_mutex(m)
+        {
+        }
+
+        bool run_on_function(shared_ptr<Function> f) override
+        {
+            // Give the other workers a chance to pick up a function
+            this_thread::sleep_for(chrono::milliseconds(5));
+            lock_guard<mutex> lock(m_mutex);
+            m_functions.insert(f);
+            m_threads.insert(this_thread::get_id());
+            return false;
+        }
+        bool is_function_local() const override { return true; }
+    private:
+        set<shared_ptr<Function>>& m_functions;
+        set<thread::id>& m_threads;
+        mutex& m_mutex;
+    };
+
+    class FailOnCall : public pass::FunctionPass
+    {
+    public:
+        bool run_on_function(shared_ptr<Function> f) override
+        {
+            if (f->get_results().at(0)->get_argument(0)->description() == "FunctionCall")
+            {
+                throw ngraph_error("outer function");
+            }
+            return false;
+        }
+        bool is_function_local() const override { return true; }
+    };
+}
+
+// An outer function that adds up calls to `count` distinct bodies.
+static shared_ptr<Function> make_multi_function_module(size_t count)
+{
+    Shape shape{4, 4};
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> sum;
+    for (size_t i = 0; i < count; i++)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        shared_ptr<Node> body = A;
+        for (size_t j = 0; j <= i; j++)
+        {
+            body = (body + B) * A;
+        }
+        auto f = make_shared<Function>(body, op::ParameterVector{A, B});
+        auto call = make_shared<op::FunctionCall>(f, NodeVector{X, X});
+        sum = sum ? sum + call : call;
+    }
+    return make_shared<Function>(make_shared<op::FunctionCall>(
+                                     make_shared<Function>(sum, op::ParameterVector{X}),
+                                     NodeVector{X}),
+                                 op::ParameterVector{X});
+}
+
+TEST(pass_manager, function_concurrency)
+{
+    const size_t count = 8;
+    auto get_pool_sizes = [&](size_t threads) {
+        auto module = make_multi_function_module(count);
+        set<shared_ptr<Function>> functions;
+        set<thread::id> thread_ids;
+        mutex m;
+
+        pass::Manager pass_manager;
+        pass_manager.set_function_concurrency(threads);
+        pass_manager.register_pass<RecordFunctions>(functions, thread_ids, m);
+        pass_manager.register_pass<pass::Liveness>();
+        pass_manager.register_pass<pass::MemoryLayout>(64);
+        pass_manager.run_passes(module);
+
+        EXPECT_EQ(functions.size(), count + 2);
+        if (threads == 1)
+        {
+            EXPECT_EQ(thread_ids.size(), 1);
+        }
+        EXPECT_EQ(pass_manager.get_pass_names().size(), 3);
+        EXPECT_EQ(pass_manager.get_pass_times().size(), 3);
+
+        multiset<size_t> pool_sizes;
+        traverse_functions(module, [&](shared_ptr<Function> f) {
+            pool_sizes.insert(f->get_temporary_pool_size());
+        });
+        return pool_sizes;
+    };
+
+    EXPECT_EQ(get_pool_sizes(1), get_pool_sizes(4));
+}
+
+TEST(pass_manager, function_concurrency_rethrows)
+{
+    pass::Manager pass_manager;
+    pass_manager.set_function_concurrency(4);
+    pass_manager.register_pass<FailOnCall>();
+    EXPECT_THROW(pass_manager.run_passes(make_multi_function_module(8)), ngraph_error);
+}
+
+TEST(pass_manager, profile)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>((A + B) * (A + B) + C, op::ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.set_pass_profiling(true);
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(f);
+
+    auto& phases = pass_manager.get_profile().get_phases();
+    ASSERT_EQ(phases.size(), 2);
+    EXPECT_EQ(phases.at(0).name, "ngraph::pass::CommonSubexpressionElimination");
+    EXPECT_EQ(phases.at(1).name, "ngraph::pass::Liveness");
+    ASSERT_TRUE(phases.at(0).has_graph_size);
+    // A, B, C, the shared Add, Multiply, Add and Result
+    EXPECT_EQ(phases.at(0).graph_size.nodes, 7);
+    EXPECT_EQ(phases.at(0).node_delta, -1);
+    EXPECT_EQ(phases.at(0).graph_size.constant_bytes, 4 * sizeof(float));
+    EXPECT_EQ(phases.at(1).node_delta, 0);
+
+    stringstream ss;
+    pass_manager.get_profile().write_json(ss);
+    auto report = nlohmann::json::parse(ss.str());
+    ASSERT_EQ(report["phases"].size(), 2);
+    EXPECT_EQ(report["phases"][0]["name"], "ngraph::pass::CommonSubexpressionElimination");
+    EXPECT_EQ(report["phases"][0]["node_delta"], -1);
+    EXPECT_GT(report["phases"][1]["peak_rss_bytes"].get<size_t>(), 0);
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/quantization.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/calibration.hpp"
+#include "util/all_close.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// Two layer perceptron with constant weights
+static shared_ptr<Function> make_mlp(shared_ptr<op::Parameter>& X)
+{
+    X = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+    vector<float> w1(8 * 16);
+    vector<float> w2(16 * 4);
+    test::Uniform<float> rng(-1.0f, 1.0f, 1);
+    rng.initialize(w1);
+    rng.initialize(w2);
+    auto W1 = op::Constant::create(element::f32, Shape{8, 16}, w1);
+    auto W2 = op::Constant::create(element::f32, Shape{16, 4}, w2);
+    auto hidden = make_shared<op::Relu>(make_shared<op::Dot>(X, W1));
+    return make_shared<Function>(make_shared<op::Dot>(hidden, W2), op::ParameterVector{X});
+}
+
+TEST(quantization, calibrate)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto X = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto relu = make_shared<op::Relu>(X);
+    auto f = make_shared<Function>(relu, op::ParameterVector{X});
+
+    vector<vector<shared_ptr<runtime::TensorView>>> samples;
+    for (vector<float> values : {vector<float>{-1, 2, 3}, vector<float>{0.5f, -4, 1}})
+    {
+        auto x = backend->create_tensor(element::f32, Shape{3});
+        copy_data(x, values);
+        samples.push_back({x});
+    }
+
+    runtime::TensorRanges ranges = runtime::calibrate(backend, f, samples);
+    EXPECT_EQ(-4, ranges.at(X.get()).m_min);
+    EXPECT_EQ(3, ranges.at(X.get()).m_max);
+    EXPECT_EQ(0, ranges.at(relu.get()).m_min);
+    EXPECT_EQ(3, ranges.at(relu.get()).m_max);
+}
+
+TEST(quantization, mlp)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    shared_ptr<op::Parameter> X;
+    auto f = make_mlp(X);
+    auto reference = clone_function(*f);
+
+    test::Uniform<float> rng(-1.0f, 1.0f, 2);
+    vector<vector<shared_ptr<runtime::TensorView>>> samples;
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto x = backend->create_tensor(element::f32, X->get_shape());
+        rng.initialize(x);
+        samples.push_back({x});
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Quantization>(runtime::calibrate(backend, f, samples));
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::QuantizedDot>(f), 2);
+    // The Relu between the layers is folded into a u8 requantization
+    ASSERT_EQ(count_ops_of_type<op::Relu>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Quantize>(f), 1);
+
+    auto expected = backend->create_tensor(element::f32, Shape{4, 4});
+    auto result = backend->create_tensor(element::f32, Shape{4, 4});
+    for (auto& sample : samples)
+    {
+        backend->call(reference, {expected}, sample);
+        backend->call(f, {result}, sample);
+        EXPECT_TRUE(test::all_close(read_vector<float>(expected),
+                                    read_vector<float>(result),
+                                    0.05f,
+                                    0.05f));
+    }
+}
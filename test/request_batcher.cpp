@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/request_batcher.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// f(x, y) = (x * 2 + y) with a batch axis prepended to every tensor
+static shared_ptr<Function> make_batched_function(size_t batch_size)
+{
+    Shape shape{batch_size, 3};
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto Y = make_shared<op::Parameter>(element::f32, shape);
+    auto two = op::Constant::create(element::f32, shape, vector<float>(3 * batch_size, 2));
+    return make_shared<Function>(X * two + Y, op::ParameterVector{X, Y});
+}
+
+static void run_requests(runtime::RequestBatcher& batcher,
+                         shared_ptr<runtime::Backend> backend,
+                         size_t count)
+{
+    Shape sample{3};
+    vector<shared_ptr<runtime::TensorView>> results;
+    vector<future<void>> futures;
+    for (size_t i = 0; i < count; i++)
+    {
+        float v = static_cast<float>(i);
+        auto x = backend->create_tensor(element::f32, sample);
+        copy_data(x, vector<float>{v, v + 1, v + 2});
+        auto y = backend->create_tensor(element::f32, sample);
+        copy_data(y, vector<float>{1, 1, 1});
+        auto result = backend->create_tensor(element::f32, sample);
+        futures.push_back(batcher.submit({result}, {x, y}));
+        results.push_back(result);
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        futures[i].get();
+        float v = static_cast<float>(i);
+        EXPECT_EQ((vector<float>{2 * v + 1, 2 * v + 3, 2 * v + 5}),
+                  read_vector<float>(results[i]));
+    }
+}
+
+TEST(request_batcher, coalesce)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::RequestBatcher::Config config(4, chrono::seconds(10));
+    runtime::RequestBatcher batcher(backend, make_batched_function, config);
+
+    // With a long deadline every dispatched batch is full
+    run_requests(batcher, backend, 8);
+
+    auto stats = batcher.get_statistics();
+    EXPECT_EQ(8, stats.m_request_count);
+    EXPECT_EQ(2, stats.m_batch_count);
+    EXPECT_EQ(2, stats.m_batch_size_histogram[4]);
+    EXPECT_DOUBLE_EQ(4.0, stats.get_average_batch_size());
+}
+
+TEST(request_batcher, deadline)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::RequestBatcher::Config config(16, chrono::milliseconds(1));
+    runtime::RequestBatcher batcher(backend, make_batched_function, config);
+
+    // Partial batches are dispatched once the oldest request's deadline expires
+    run_requests(batcher, backend, 3);
+
+    auto stats = batcher.get_statistics();
+    EXPECT_EQ(3, stats.m_request_count);
+    EXPECT_GE(stats.m_batch_count, 1);
+    EXPECT_EQ(0, stats.m_batch_size_histogram[16]);
+}
+
+TEST(request_batcher, pad_to_max_batch_size)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    size_t built = 0;
+    auto builder = [&built](size_t batch_size) {
+        built++;
+        return make_batched_function(batch_size);
+    };
+    runtime::RequestBatcher::Config config(8, chrono::milliseconds(1));
+    config.m_pad_to_max_batch_size = true;
+    runtime::RequestBatcher batcher(backend, builder, config);
+
+    run_requests(batcher, backend, 5);
+
+    // Only the max_batch_size Function is ever built
+    EXPECT_EQ(1, built);
+    EXPECT_EQ(5, batcher.get_statistics().m_request_count);
+}
+
+TEST(request_batcher, bad_request)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::RequestBatcher::Config config(4, chrono::milliseconds(1));
+    runtime::RequestBatcher batcher(backend, make_batched_function, config);
+
+    auto x = backend->create_tensor(element::f32, Shape{4});
+    auto y = backend->create_tensor(element::f32, Shape{3});
+    auto result = backend->create_tensor(element::f32, Shape{3});
+    EXPECT_THROW(batcher.submit({result}, {x, y}), ngraph_error);
+    EXPECT_THROW(batcher.submit({result}, {y}), ngraph_error);
+}
+
+TEST(request_batcher, mismatched_batch_function)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::RequestBatcher::Config config(4, chrono::milliseconds(1));
+    // Smaller batches get a Function with a wider sample, which would overrun the requests
+    auto builder = [](size_t batch_size) {
+        Shape shape{batch_size, batch_size == 4 ? size_t(3) : size_t(5)};
+        auto X = make_shared<op::Parameter>(element::f32, shape);
+        auto Y = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(X + Y, op::ParameterVector{X, Y});
+    };
+    runtime::RequestBatcher batcher(backend, builder, config);
+
+    Shape sample{3};
+    auto x = backend->create_tensor(element::f32, sample);
+    auto y = backend->create_tensor(element::f32, sample);
+    auto result = backend->create_tensor(element::f32, sample);
+    EXPECT_THROW(batcher.submit({result}, {x, y}).get(), ngraph_error);
+}
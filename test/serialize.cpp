@@ -158,6 +158,34 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, reduced_precision)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::bf16, shape);
+    auto B = op::Constant::create(element::f16, shape, {0.5, 1.0, 2.0, 65504.0});
+    auto f = make_shared<Function>(make_shared<op::Convert>(B, element::bf16) + A,
+                                   op::ParameterVector{A});
+
+    auto g = deserialize(serialize(f));
+    ASSERT_NE(g, nullptr);
+    EXPECT_EQ(element::bf16, g->get_parameters().at(0)->get_element_type());
+    EXPECT_EQ(element::bf16, g->get_output_element_type(0));
+    bool found = false;
+    for (shared_ptr<Node> node : g->get_ops())
+    {
+        shared_ptr<op::Constant> c = dynamic_pointer_cast<op::Constant>(node);
+        if (c)
+        {
+            found = true;
+            EXPECT_EQ(element::f16, c->get_element_type());
+            auto values = c->get_vector<float16>();
+            EXPECT_EQ((vector<float>{0.5, 1, 2, 65504}),
+                      (vector<float>{begin(values), end(values)}));
+        }
+    }
+    EXPECT_TRUE(found);
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
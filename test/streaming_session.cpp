@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/streaming_session.hpp"
+#include "util/all_close.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// h' = tanh(x W + h U), returned both as the step's output and as the next state
+static shared_ptr<Function> make_rnn_cell()
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto H = make_shared<op::Parameter>(element::f32, Shape{1, 3});
+    auto W = op::Constant::create(element::f32, Shape{2, 3}, {0.1, 0.2, 0.3, 0.4, 0.5, 0.6});
+    auto U = op::Constant::create(
+        element::f32, Shape{3, 3}, {0.5, -0.1, 0.2, 0.3, 0.4, -0.2, -0.3, 0.1, 0.6});
+    auto H_next = make_shared<op::Tanh>(make_shared<op::Dot>(X, W) + make_shared<op::Dot>(H, U));
+    return make_shared<Function>(NodeVector{H_next, H_next}, op::ParameterVector{X, H});
+}
+
+TEST(streaming_session, rnn_state)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    vector<vector<float>> xs{{1, 0}, {0, 1}, {0.5, -0.5}, {-1, 2}};
+
+    // Reference: the caller passes the state in and copies it back out
+    auto f = make_rnn_cell();
+    auto x = backend->create_tensor(element::f32, Shape{1, 2});
+    auto h = backend->create_tensor(element::f32, Shape{1, 3});
+    auto y = backend->create_tensor(element::f32, Shape{1, 3});
+    auto h_next = backend->create_tensor(element::f32, Shape{1, 3});
+    copy_data(h, vector<float>{0, 0, 0});
+    vector<vector<float>> expected;
+    for (auto& step : xs)
+    {
+        copy_data(x, step);
+        backend->call(f, {y, h_next}, {x, h});
+        expected.push_back(read_vector<float>(y));
+        copy_data(h, read_vector<float>(h_next));
+    }
+
+    // Result 1 feeds Parameter 1, so a step only passes x and y
+    runtime::StreamingSession session(backend, make_rnn_cell(), {{1, 1}});
+    for (size_t i = 0; i < xs.size(); i++)
+    {
+        copy_data(x, xs[i]);
+        session.call({y}, {x});
+        EXPECT_TRUE(test::all_close(expected[i], read_vector<float>(y)));
+        EXPECT_EQ(read_vector<float>(y), read_vector<float>(session.get_state(0)));
+    }
+    EXPECT_EQ(xs.size(), session.get_step_count());
+
+    // After a reset the sequence starts over
+    session.reset();
+    copy_data(x, xs[0]);
+    session.call({y}, {x});
+    EXPECT_TRUE(test::all_close(expected[0], read_vector<float>(y)));
+}
+
+TEST(streaming_session, in_place_state)
+{
+    // c' = c + x accumulates in place; the step also returns 2c'
+    Shape shape{4};
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto two = op::Constant::create(element::f32, shape, {2, 2, 2, 2});
+    auto C_next = C + X;
+    auto f = make_shared<Function>(NodeVector{C_next * two, C_next}, op::ParameterVector{X, C});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::StreamingSession session(backend, f, {{1, 1, true}});
+    copy_data(session.get_state(0), vector<float>{10, 20, 30, 40});
+    auto state = session.get_state(0);
+
+    auto x = backend->create_tensor(element::f32, shape);
+    auto y = backend->create_tensor(element::f32, shape);
+    copy_data(x, vector<float>{1, 2, 3, 4});
+    for (size_t i = 0; i < 3; i++)
+    {
+        session.call({y}, {x});
+    }
+    EXPECT_EQ((vector<float>{13, 26, 39, 52}), read_vector<float>(session.get_state(0)));
+    EXPECT_EQ((vector<float>{26, 52, 78, 104}), read_vector<float>(y));
+    // The state never moved
+    EXPECT_EQ(state, session.get_state(0));
+}
+
+TEST(streaming_session, invalid_states)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto f = make_rnn_cell();
+    // Result 0 is [1,3] but Parameter 0 is [1,2]
+    EXPECT_THROW(runtime::StreamingSession(backend, f, {{0, 0}}), ngraph_error);
+    EXPECT_THROW(runtime::StreamingSession(backend, f, {{2, 1}}), ngraph_error);
+    EXPECT_THROW(runtime::StreamingSession(backend, f, {{0, 1}, {1, 1}}), ngraph_error);
+
+    runtime::StreamingSession session(backend, f, {{1, 1}});
+    auto x = backend->create_tensor(element::f32, Shape{1, 2});
+    auto h = backend->create_tensor(element::f32, Shape{1, 3});
+    auto y = backend->create_tensor(element::f32, Shape{1, 3});
+    EXPECT_THROW(session.call({y}, {x, h}), ngraph_error);
+}
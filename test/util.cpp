@@ -26,6 +26,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "util/all_close.hpp"
 #include "util/ndarray.hpp"
 
@@ -324,3 +325,32 @@ TEST(util, parse_string)
     EXPECT_FLOAT_EQ(-numeric_limits<double>::infinity(), parse_string<double>("-INFINITY"));
     EXPECT_TRUE(std::isnan(parse_string<double>("NaN")));
 }
+
+TEST(util, stable_vector)
+{
+    StableVector<int> v;
+    EXPECT_TRUE(v.empty());
+    EXPECT_TRUE(v.begin() == v.end());
+    v.reserve(2);
+    EXPECT_TRUE(v.begin() == v.end());
+
+    vector<int*> addresses;
+    for (int i = 0; i < 100; i++)
+    {
+        addresses.push_back(&v.emplace_back(i));
+    }
+    EXPECT_EQ(100u, v.size());
+    EXPECT_EQ(0, v.front());
+    EXPECT_EQ(99, v.back());
+    EXPECT_THROW(v.at(100), std::out_of_range);
+
+    int expected = 0;
+    for (int& x : v)
+    {
+        // Growing never moves an element
+        EXPECT_EQ(addresses.at(expected), &x);
+        EXPECT_EQ(expected, v[expected]);
+        EXPECT_EQ(expected++, x);
+    }
+    EXPECT_EQ(100, expected);
+}